@@ -1,10000 +0,0 @@
-0.82748322,
-0.71695203,
-0.00884758,
-0.50921233,
-0.30595426,
-0.68297802,
-0.40627556,
-0.24471024,
-0.84922491,
-0.24471344,
-0.82921118,
-0.72867991,
-0.19467895,
-0.39355873,
-0.41632996,
-0.43469168,
-0.31803274,
-0.26475196,
-0.38525916,
-0.47160372,
-0.74676632,
-0.15436065,
-0.97793024,
-0.89048871,
-0.85421615,
-0.44441536,
-0.90398202,
-0.72852665,
-0.19655337,
-0.88865110,
-0.22051036,
-0.30725242,
-0.55853148,
-0.37754942,
-0.86252662,
-0.87297743,
-0.54984922,
-0.05938576,
-0.21781222,
-0.68211759,
-0.89940142,
-0.99949308,
-0.69659497,
-0.15489600,
-0.48580913,
-0.54001883,
-0.01814800,
-0.96596449,
-0.58733789,
-0.96109513,
-0.06539766,
-0.20732743,
-0.96845857,
-0.78929781,
-0.15571314,
-0.21879447,
-0.96276070,
-0.39051331,
-0.73141954,
-0.19618634,
-0.39138757,
-0.59993633,
-0.70958458,
-0.59771385,
-0.21585292,
-0.14721004,
-0.50027146,
-0.07746395,
-0.75474821,
-0.46143869,
-0.32951628,
-0.01644613,
-0.86035605,
-0.84602252,
-0.33514008,
-0.42232740,
-0.21265216,
-0.85066850,
-0.06674661,
-0.81360216,
-0.71869782,
-0.47459344,
-0.30680874,
-0.27679460,
-0.88087452,
-0.41331301,
-0.27684964,
-0.39864804,
-0.40664242,
-0.76766208,
-0.08274379,
-0.32748489,
-0.97305766,
-0.72101956,
-0.02838465,
-0.92687657,
-0.15442340,
-0.23619385,
-0.74616648,
-0.78332017,
-0.42760581,
-0.41220053,
-0.83223275,
-0.62649972,
-0.18584798,
-0.27703905,
-0.75362443,
-0.17259578,
-0.99388274,
-0.60731273,
-0.81328043,
-0.94452933,
-0.61130215,
-0.36358154,
-0.69212063,
-0.89900766,
-0.63892361,
-0.77137127,
-0.76560125,
-0.51273163,
-0.07567215,
-0.57101913,
-0.39285970,
-0.33816136,
-0.61447065,
-0.92705603,
-0.66581131,
-0.36940746,
-0.42003578,
-0.90699667,
-0.47899910,
-0.96083447,
-0.82050494,
-0.29157581,
-0.42871174,
-0.73186330,
-0.68378537,
-0.87457394,
-0.72251085,
-0.31714923,
-0.06327356,
-0.66434475,
-0.07630225,
-0.74808164,
-0.13975015,
-0.02106422,
-0.22152968,
-0.59702860,
-0.42111944,
-0.21743507,
-0.45797377,
-0.54485207,
-0.59783129,
-0.17418891,
-0.18607844,
-0.74036303,
-0.26530399,
-0.60464902,
-0.51324280,
-0.95080364,
-0.85372094,
-0.18006508,
-0.75854451,
-0.97162064,
-0.96321427,
-0.01246279,
-0.44867585,
-0.27153925,
-0.78115989,
-0.57765719,
-0.29701550,
-0.38469873,
-0.77136192,
-0.10527845,
-0.70332684,
-0.38363839,
-0.51105558,
-0.43005252,
-0.53318175,
-0.04726841,
-0.95543100,
-0.05987083,
-0.43651294,
-0.54645536,
-0.83165361,
-0.21270407,
-0.83408292,
-0.04983973,
-0.71100437,
-0.63910213,
-0.68430951,
-0.73025806,
-0.32384191,
-0.23434142,
-0.79588761,
-0.48011441,
-0.34755218,
-0.46333114,
-0.96753584,
-0.03940033,
-0.34727089,
-0.57741776,
-0.37731916,
-0.06103863,
-0.77819848,
-0.97060303,
-0.87129710,
-0.72063728,
-0.46261613,
-0.47537472,
-0.57645478,
-0.33800882,
-0.38519493,
-0.00557450,
-0.97591907,
-0.94810818,
-0.62375306,
-0.91138804,
-0.87693930,
-0.30130028,
-0.14775657,
-0.26174320,
-0.81833048,
-0.59463842,
-0.15109374,
-0.46883738,
-0.08714470,
-0.90155865,
-0.20742246,
-0.15779216,
-0.66339436,
-0.63893761,
-0.02753930,
-0.27277265,
-0.25892441,
-0.23463580,
-0.38737734,
-0.21165749,
-0.61141555,
-0.05215879,
-0.36418889,
-0.17933879,
-0.81448410,
-0.06979615,
-0.31034272,
-0.54776635,
-0.73980138,
-0.42802632,
-0.83118342,
-0.73140768,
-0.21434730,
-0.27667285,
-0.77623653,
-0.08814854,
-0.47180225,
-0.68950523,
-0.67364486,
-0.47755039,
-0.20848992,
-0.49727655,
-0.50317889,
-0.82798813,
-0.96190402,
-0.38261101,
-0.46842362,
-0.95285659,
-0.14295804,
-0.34552436,
-0.92764836,
-0.92816548,
-0.64146416,
-0.90834075,
-0.70006002,
-0.88275629,
-0.69204059,
-0.21578031,
-0.28492932,
-0.45109510,
-0.78603623,
-0.63142043,
-0.56643772,
-0.23531009,
-0.97619933,
-0.99793383,
-0.42066726,
-0.64997577,
-0.62961765,
-0.84367727,
-0.16422586,
-0.91873434,
-0.83635927,
-0.46993215,
-0.46588014,
-0.01041304,
-0.98023002,
-0.39556559,
-0.55832756,
-0.46922224,
-0.97237255,
-0.80497218,
-0.95435403,
-0.95807814,
-0.79252375,
-0.83500901,
-0.31988583,
-0.81904621,
-0.53417279,
-0.11400155,
-0.97484074,
-0.76645750,
-0.28749292,
-0.63202038,
-0.23410517,
-0.16813557,
-0.36913344,
-0.83199771,
-0.19396657,
-0.58599835,
-0.41645235,
-0.01680869,
-0.93348344,
-0.05335895,
-0.09310246,
-0.18943695,
-0.89865456,
-0.07761815,
-0.30435366,
-0.67822809,
-0.64929204,
-0.05632977,
-0.86578947,
-0.16117869,
-0.87503698,
-0.42446534,
-0.96846680,
-0.49330556,
-0.35864820,
-0.09662698,
-0.93409882,
-0.44796828,
-0.46483867,
-0.66839479,
-0.46641960,
-0.67292639,
-0.68232289,
-0.80915890,
-0.18304615,
-0.10065034,
-0.98274724,
-0.62482814,
-0.54738553,
-0.52580869,
-0.63373487,
-0.56755968,
-0.13594897,
-0.28818166,
-0.58057584,
-0.85698656,
-0.31743298,
-0.71089107,
-0.88426415,
-0.71188351,
-0.14021869,
-0.34011709,
-0.01073203,
-0.32078241,
-0.70480148,
-0.09680536,
-0.94311934,
-0.72733190,
-0.03285518,
-0.31407136,
-0.78888928,
-0.73896834,
-0.71976167,
-0.08740008,
-0.69152776,
-0.30093124,
-0.44872605,
-0.18686808,
-0.89491050,
-0.36380151,
-0.69460162,
-0.85128297,
-0.14757688,
-0.37806054,
-0.63000567,
-0.60237251,
-0.79048624,
-0.75073115,
-0.97964629,
-0.65336892,
-0.50746627,
-0.46310997,
-0.37641173,
-0.45383330,
-0.37433987,
-0.70408610,
-0.24826336,
-0.79981667,
-0.14497905,
-0.56163828,
-0.21955909,
-0.54427830,
-0.22443940,
-0.24860625,
-0.58501896,
-0.06657792,
-0.20965452,
-0.72465957,
-0.83557585,
-0.39319614,
-0.38985648,
-0.05705667,
-0.46947925,
-0.35334418,
-0.75913641,
-0.11699599,
-0.47960608,
-0.05099522,
-0.13036868,
-0.00421906,
-0.52374493,
-0.70105044,
-0.45453152,
-0.95523465,
-0.30487891,
-0.39290577,
-0.03683290,
-0.42083085,
-0.18410954,
-0.01348989,
-0.80366037,
-0.38709263,
-0.03803302,
-0.79066284,
-0.25099773,
-0.58053406,
-0.76609215,
-0.16234604,
-0.60903098,
-0.44905198,
-0.86660686,
-0.54316698,
-0.61101866,
-0.17104096,
-0.97000820,
-0.24752017,
-0.59096404,
-0.65342668,
-0.87969744,
-0.39612311,
-0.29734505,
-0.05520040,
-0.13758343,
-0.64932690,
-0.24634705,
-0.22247362,
-0.07361080,
-0.65053673,
-0.70863677,
-0.56066957,
-0.59273380,
-0.03672260,
-0.11424495,
-0.34996868,
-0.09860987,
-0.90762440,
-0.82600652,
-0.07592536,
-0.72255521,
-0.91833764,
-0.17474222,
-0.31689615,
-0.22143247,
-0.52694449,
-0.16655477,
-0.11870733,
-0.22186282,
-0.85423560,
-0.55296641,
-0.30206433,
-0.22475193,
-0.71795811,
-0.99793390,
-0.41564251,
-0.79379071,
-0.26233218,
-0.72499401,
-0.01772302,
-0.12558581,
-0.64761354,
-0.90432344,
-0.73260751,
-0.03077671,
-0.74938467,
-0.20751997,
-0.11802622,
-0.74326352,
-0.39100727,
-0.99048118,
-0.07680093,
-0.50958359,
-0.89537640,
-0.43003157,
-0.17334233,
-0.96073550,
-0.98323225,
-0.66815234,
-0.31762094,
-0.01223508,
-0.09351865,
-0.69401457,
-0.93866842,
-0.86212412,
-0.87158395,
-0.41678338,
-0.33602518,
-0.83052594,
-0.91759719,
-0.35814074,
-0.37503267,
-0.50131633,
-0.07202276,
-0.74003915,
-0.21039475,
-0.93295563,
-0.68217129,
-0.02076467,
-0.78955121,
-0.10984414,
-0.65442163,
-0.64632694,
-0.81845944,
-0.14038666,
-0.35446162,
-0.86355248,
-0.53550634,
-0.08460843,
-0.05339451,
-0.26848384,
-0.44157434,
-0.79204811,
-0.57992939,
-0.13488724,
-0.54122732,
-0.17832005,
-0.74440265,
-0.13014569,
-0.85135826,
-0.09526577,
-0.60404722,
-0.32150882,
-0.15744457,
-0.55846332,
-0.04170038,
-0.00576221,
-0.42384047,
-0.26668540,
-0.31485619,
-0.81994672,
-0.16506556,
-0.51369224,
-0.43755587,
-0.77456320,
-0.14514191,
-0.85344196,
-0.74611828,
-0.07354940,
-0.98519999,
-0.02461781,
-0.70282810,
-0.75779588,
-0.30074323,
-0.31492650,
-0.80974168,
-0.52439578,
-0.90757049,
-0.86143084,
-0.15638442,
-0.59932772,
-0.66312913,
-0.42779375,
-0.05353719,
-0.75301487,
-0.22417370,
-0.78107259,
-0.17126441,
-0.07406797,
-0.61179179,
-0.49997339,
-0.34559795,
-0.02227744,
-0.29756811,
-0.68326145,
-0.24173820,
-0.62874109,
-0.52453449,
-0.37636574,
-0.96297683,
-0.94021307,
-0.76254080,
-0.51048130,
-0.28730508,
-0.77880512,
-0.40878992,
-0.33357936,
-0.20641214,
-0.26947100,
-0.35048601,
-0.74681625,
-0.97190426,
-0.27191189,
-0.42457477,
-0.55534142,
-0.60787320,
-0.50114685,
-0.28428211,
-0.50062796,
-0.16393570,
-0.87417310,
-0.22397904,
-0.15938580,
-0.13127830,
-0.39442665,
-0.58995181,
-0.65905490,
-0.12935005,
-0.88137921,
-0.07477851,
-0.34984507,
-0.88228663,
-0.23058521,
-0.30812704,
-0.72600867,
-0.18284667,
-0.01293276,
-0.92076300,
-0.22611426,
-0.87366528,
-0.23747293,
-0.19329923,
-0.81293487,
-0.92251610,
-0.13505101,
-0.49503250,
-0.42864565,
-0.54417752,
-0.74283520,
-0.80548799,
-0.45746016,
-0.82435369,
-0.10380256,
-0.69515099,
-0.88726408,
-0.61247841,
-0.46153968,
-0.88498798,
-0.72333085,
-0.62167431,
-0.60711535,
-0.15771144,
-0.19329997,
-0.74765115,
-0.13121177,
-0.82883858,
-0.00197877,
-0.91671376,
-0.51397137,
-0.02007987,
-0.97766873,
-0.02700777,
-0.01579223,
-0.96060003,
-0.76989445,
-0.01893404,
-0.19483038,
-0.01913036,
-0.92134622,
-0.33263549,
-0.18282250,
-0.21745924,
-0.34275297,
-0.35521371,
-0.43736734,
-0.18660342,
-0.10367363,
-0.87493972,
-0.73005878,
-0.50300509,
-0.68156820,
-0.09144698,
-0.22203957,
-0.39453461,
-0.04442290,
-0.80945937,
-0.38325436,
-0.77937148,
-0.77116965,
-0.75461006,
-0.09600051,
-0.83157161,
-0.71469390,
-0.45534900,
-0.55664078,
-0.80298624,
-0.43374314,
-0.64168827,
-0.55506346,
-0.71303357,
-0.82589404,
-0.62439044,
-0.25586208,
-0.90370601,
-0.15590202,
-0.49744274,
-0.63841220,
-0.75370743,
-0.11518493,
-0.39126136,
-0.33083792,
-0.60102132,
-0.23693978,
-0.46396335,
-0.21359564,
-0.85276942,
-0.84212425,
-0.91506547,
-0.31979723,
-0.99319197,
-0.74123569,
-0.39217759,
-0.33462198,
-0.37386692,
-0.57014752,
-0.16196617,
-0.94081460,
-0.27900794,
-0.86237916,
-0.26544292,
-0.99404732,
-0.35580857,
-0.05117147,
-0.80688945,
-0.57122586,
-0.85729909,
-0.72584872,
-0.56211589,
-0.26044446,
-0.21976680,
-0.09903530,
-0.45831120,
-0.18323744,
-0.64932991,
-0.20924573,
-0.60678031,
-0.91211558,
-0.08926266,
-0.53529966,
-0.73874755,
-0.53884030,
-0.53001660,
-0.72746667,
-0.12834980,
-0.91668930,
-0.76446678,
-0.76558679,
-0.99506257,
-0.00231196,
-0.96291995,
-0.16013587,
-0.93455774,
-0.42617659,
-0.56440829,
-0.49574960,
-0.15042703,
-0.31096143,
-0.69832721,
-0.77773984,
-0.30069221,
-0.31846537,
-0.18204949,
-0.97660828,
-0.91448410,
-0.19485930,
-0.94812545,
-0.41837528,
-0.13341093,
-0.37344677,
-0.58264241,
-0.55804553,
-0.44954660,
-0.90590957,
-0.87612653,
-0.90460201,
-0.77368455,
-0.49598516,
-0.41859480,
-0.44578956,
-0.44172693,
-0.46689144,
-0.12037057,
-0.05219764,
-0.15187361,
-0.80612187,
-0.46716799,
-0.23461707,
-0.78735878,
-0.36628333,
-0.83502043,
-0.81946248,
-0.57467662,
-0.24915278,
-0.27357039,
-0.85317803,
-0.68783214,
-0.37955604,
-0.82821367,
-0.96126994,
-0.49172072,
-0.55813758,
-0.51204225,
-0.60654071,
-0.22879102,
-0.51392854,
-0.18603638,
-0.73455152,
-0.73914291,
-0.51139242,
-0.32811385,
-0.82556243,
-0.97946152,
-0.95981488,
-0.87126157,
-0.40364063,
-0.28967685,
-0.30988807,
-0.89739908,
-0.05248610,
-0.34469122,
-0.76578366,
-0.19369435,
-0.21331662,
-0.95075154,
-0.63036415,
-0.43574626,
-0.91364993,
-0.46572818,
-0.71528229,
-0.17911388,
-0.96683954,
-0.16631793,
-0.35710575,
-0.74372848,
-0.76982894,
-0.30546701,
-0.88647488,
-0.20800783,
-0.46825829,
-0.93351901,
-0.23653421,
-0.15223322,
-0.80030096,
-0.54325562,
-0.83569288,
-0.27450920,
-0.83727055,
-0.67574255,
-0.48059168,
-0.83722658,
-0.59014918,
-0.12236851,
-0.32956717,
-0.95945031,
-0.05442114,
-0.92641727,
-0.50824513,
-0.58883698,
-0.57893681,
-0.36251797,
-0.49251054,
-0.25965399,
-0.67562011,
-0.55470584,
-0.72218046,
-0.23110573,
-0.83834601,
-0.18968810,
-0.79880612,
-0.13948591,
-0.85132007,
-0.55289501,
-0.76527170,
-0.34176673,
-0.79860527,
-0.91407314,
-0.39228912,
-0.41375198,
-0.89095829,
-0.29114938,
-0.31669791,
-0.55769134,
-0.65193120,
-0.75279271,
-0.39767179,
-0.35383667,
-0.11404493,
-0.60359685,
-0.33052861,
-0.74835234,
-0.18152248,
-0.63269788,
-0.05959546,
-0.42942697,
-0.70287123,
-0.06610672,
-0.79481469,
-0.40938491,
-0.83957449,
-0.17262251,
-0.45126151,
-0.19427912,
-0.28379944,
-0.78235025,
-0.00914218,
-0.81704539,
-0.73552706,
-0.24188084,
-0.07050324,
-0.15448713,
-0.15695164,
-0.97871434,
-0.52176840,
-0.24775311,
-0.44445370,
-0.87744408,
-0.89398048,
-0.51492817,
-0.42569536,
-0.46301242,
-0.95493163,
-0.54545886,
-0.03195122,
-0.74380124,
-0.25953377,
-0.21720663,
-0.81941172,
-0.75632473,
-0.78634038,
-0.25603824,
-0.53051007,
-0.74696906,
-0.97339421,
-0.27439489,
-0.75395948,
-0.62585108,
-0.64706862,
-0.85121849,
-0.43164420,
-0.45935026,
-0.67552230,
-0.45313078,
-0.33382049,
-0.88152931,
-0.97376663,
-0.05168661,
-0.13623307,
-0.09080418,
-0.62689666,
-0.39767869,
-0.82866633,
-0.12807480,
-0.22535010,
-0.95908496,
-0.27624901,
-0.22392045,
-0.76296922,
-0.49544060,
-0.72728949,
-0.67020375,
-0.65306515,
-0.61482209,
-0.96476526,
-0.80921549,
-0.73094497,
-0.11602610,
-0.40533741,
-0.26096155,
-0.63945498,
-0.89538973,
-0.10046041,
-0.47770372,
-0.72263845,
-0.12751674,
-0.63075498,
-0.16674025,
-0.02851622,
-0.39059073,
-0.37913660,
-0.26487572,
-0.64487689,
-0.88071807,
-0.98970512,
-0.34409103,
-0.71594927,
-0.09080679,
-0.17624529,
-0.68320096,
-0.39401607,
-0.14289087,
-0.93991499,
-0.87326765,
-0.21605736,
-0.20269256,
-0.07368265,
-0.49542232,
-0.57234409,
-0.72324325,
-0.78855409,
-0.30611205,
-0.15871757,
-0.81664774,
-0.95721439,
-0.84801488,
-0.93782319,
-0.68652942,
-0.93540088,
-0.07747812,
-0.01739122,
-0.35226018,
-0.48773064,
-0.21023867,
-0.60129878,
-0.15680478,
-0.41635189,
-0.88869830,
-0.40675022,
-0.55238331,
-0.87702146,
-0.69359231,
-0.66303683,
-0.08976856,
-0.59628610,
-0.99578906,
-0.98371121,
-0.22078271,
-0.64312600,
-0.34708543,
-0.77916640,
-0.06033454,
-0.77034935,
-0.28634316,
-0.33711380,
-0.61309613,
-0.19931499,
-0.64836176,
-0.36726393,
-0.78001639,
-0.25677168,
-0.76155813,
-0.30850354,
-0.58219008,
-0.19355591,
-0.97143658,
-0.43004526,
-0.24318556,
-0.27701618,
-0.57326058,
-0.04001542,
-0.59432967,
-0.71125507,
-0.04919087,
-0.09144906,
-0.54140995,
-0.41708780,
-0.10775666,
-0.87604772,
-0.28004094,
-0.57253010,
-0.55696358,
-0.53065992,
-0.39106226,
-0.74916328,
-0.66053234,
-0.11481595,
-0.36503101,
-0.69354697,
-0.92212883,
-0.32389130,
-0.02681224,
-0.65397403,
-0.85220719,
-0.16591588,
-0.71100097,
-0.49269114,
-0.45806663,
-0.17829861,
-0.62774230,
-0.14303992,
-0.84052252,
-0.37268706,
-0.37129875,
-0.66167228,
-0.91412209,
-0.14061837,
-0.85663323,
-0.61031421,
-0.57629195,
-0.80286793,
-0.43587385,
-0.29953786,
-0.58168978,
-0.79724448,
-0.25436372,
-0.72666361,
-0.48930812,
-0.39191497,
-0.65276526,
-0.70466737,
-0.96944027,
-0.99030131,
-0.41838875,
-0.31961622,
-0.05138415,
-0.82024165,
-0.94027461,
-0.17941072,
-0.35913288,
-0.47648343,
-0.13125460,
-0.05557505,
-0.55566355,
-0.82822367,
-0.64249446,
-0.09310921,
-0.40596614,
-0.12714451,
-0.14029491,
-0.29797421,
-0.17428640,
-0.30365574,
-0.00614009,
-0.05031056,
-0.28004862,
-0.98589063,
-0.04202415,
-0.63531886,
-0.55043687,
-0.83937244,
-0.98232222,
-0.81305524,
-0.57240191,
-0.57146421,
-0.10761487,
-0.25815636,
-0.86521327,
-0.43137187,
-0.33447444,
-0.35523099,
-0.92651833,
-0.09551748,
-0.93036316,
-0.54210164,
-0.21282783,
-0.88347067,
-0.71858730,
-0.72704222,
-0.13181679,
-0.01233172,
-0.41568585,
-0.48179156,
-0.35236603,
-0.57437820,
-0.33221104,
-0.59105289,
-0.69293767,
-0.89769183,
-0.55747615,
-0.69983366,
-0.37701604,
-0.72044150,
-0.97375286,
-0.79258643,
-0.84739955,
-0.76703965,
-0.80725824,
-0.30939446,
-0.12184415,
-0.65459354,
-0.06768041,
-0.04709564,
-0.87339962,
-0.79450991,
-0.80130967,
-0.44171193,
-0.36707593,
-0.84532081,
-0.02618664,
-0.40703324,
-0.87156065,
-0.91853761,
-0.16325532,
-0.03267801,
-0.72981668,
-0.74300312,
-0.90255152,
-0.04214724,
-0.69628661,
-0.48162335,
-0.97912537,
-0.84467672,
-0.77117923,
-0.15718630,
-0.84601069,
-0.18650772,
-0.73600076,
-0.88942078,
-0.00134584,
-0.59304787,
-0.43563067,
-0.31466982,
-0.61340736,
-0.15908136,
-0.31959572,
-0.01117823,
-0.12002367,
-0.10870753,
-0.18219989,
-0.70127595,
-0.50092159,
-0.40145512,
-0.70260264,
-0.96246112,
-0.77651473,
-0.48190510,
-0.46411728,
-0.21132298,
-0.19761712,
-0.35054176,
-0.11525815,
-0.83600591,
-0.77128409,
-0.19477717,
-0.65673495,
-0.97321476,
-0.70621621,
-0.07826854,
-0.13289422,
-0.64380188,
-0.47933111,
-0.38094051,
-0.15139803,
-0.11518182,
-0.52845508,
-0.17957382,
-0.05263529,
-0.56661807,
-0.32373226,
-0.54517377,
-0.68525993,
-0.79905052,
-0.18707673,
-0.19529134,
-0.35313481,
-0.94599648,
-0.19104736,
-0.15991736,
-0.66942610,
-0.58551485,
-0.31289153,
-0.14739864,
-0.62347076,
-0.01647563,
-0.83578243,
-0.23704576,
-0.04640879,
-0.01463345,
-0.31795842,
-0.00090849,
-0.91816081,
-0.83912344,
-0.03081144,
-0.15979545,
-0.96586128,
-0.00153104,
-0.86358562,
-0.98154102,
-0.51069376,
-0.18853163,
-0.67560350,
-0.22056433,
-0.27928572,
-0.94688553,
-0.45752502,
-0.17655239,
-0.11436576,
-0.18516620,
-0.69457896,
-0.40008415,
-0.10537216,
-0.87411899,
-0.67956138,
-0.22630485,
-0.16218392,
-0.54714166,
-0.32288956,
-0.39971864,
-0.12959027,
-0.92998563,
-0.29273386,
-0.97698630,
-0.39317072,
-0.34429354,
-0.14716985,
-0.13270580,
-0.19179467,
-0.96215109,
-0.25646421,
-0.24221539,
-0.70472000,
-0.22310474,
-0.40604970,
-0.64196796,
-0.94285000,
-0.99674246,
-0.28838759,
-0.96892473,
-0.06840199,
-0.20757239,
-0.69427681,
-0.33126689,
-0.07140110,
-0.65333068,
-0.00715942,
-0.16098882,
-0.22128097,
-0.30391802,
-0.96624062,
-0.42227318,
-0.42252797,
-0.05578758,
-0.52912446,
-0.00533468,
-0.72759016,
-0.75910281,
-0.24420317,
-0.11072077,
-0.82704980,
-0.89772397,
-0.00133997,
-0.25658297,
-0.87756519,
-0.35893671,
-0.03027131,
-0.45835231,
-0.41568523,
-0.24045117,
-0.72738283,
-0.83161697,
-0.84257084,
-0.30247141,
-0.50254016,
-0.83810452,
-0.01313453,
-0.29538343,
-0.81999774,
-0.69650288,
-0.70137082,
-0.90281573,
-0.25592297,
-0.26575189,
-0.34612100,
-0.95115005,
-0.57382671,
-0.99337863,
-0.87791639,
-0.00660718,
-0.73526020,
-0.12875125,
-0.15059427,
-0.20121144,
-0.90380453,
-0.85657174,
-0.34238338,
-0.23400738,
-0.30873541,
-0.60378801,
-0.52718449,
-0.38652701,
-0.61402230,
-0.57404417,
-0.63673676,
-0.04888893,
-0.88944413,
-0.43579746,
-0.35112129,
-0.46884631,
-0.70760574,
-0.74935650,
-0.12881841,
-0.64786903,
-0.43579819,
-0.14445423,
-0.89800611,
-0.76821740,
-0.41999317,
-0.99666034,
-0.12416888,
-0.02640359,
-0.29940268,
-0.33564602,
-0.22966136,
-0.16115121,
-0.27586348,
-0.06690154,
-0.07217484,
-0.65673665,
-0.97394575,
-0.04125334,
-0.95227055,
-0.87541827,
-0.00848371,
-0.25575212,
-0.46534780,
-0.18707088,
-0.96673598,
-0.68310228,
-0.06387529,
-0.67496198,
-0.28537290,
-0.93508604,
-0.02064171,
-0.31772843,
-0.45109792,
-0.96913782,
-0.73273397,
-0.86723989,
-0.11039828,
-0.88375221,
-0.85263730,
-0.80393024,
-0.73796372,
-0.81339043,
-0.11198721,
-0.22345590,
-0.99960437,
-0.72348949,
-0.81568351,
-0.00242177,
-0.03590140,
-0.68934678,
-0.15559406,
-0.14730860,
-0.17293182,
-0.81679123,
-0.10595571,
-0.17230474,
-0.37526086,
-0.22689825,
-0.59584872,
-0.33328801,
-0.69427735,
-0.67998874,
-0.50745996,
-0.29422328,
-0.50260485,
-0.53349350,
-0.48731876,
-0.92057606,
-0.44215289,
-0.96842207,
-0.57018055,
-0.38339574,
-0.96254502,
-0.98298744,
-0.21848422,
-0.33698176,
-0.27860480,
-0.21905740,
-0.50346238,
-0.19362502,
-0.59919572,
-0.70073417,
-0.30801205,
-0.95485665,
-0.58441606,
-0.33263275,
-0.55313877,
-0.72815503,
-0.42833690,
-0.92080400,
-0.44829888,
-0.05381988,
-0.04105370,
-0.78205599,
-0.20740964,
-0.74023557,
-0.81735587,
-0.75257539,
-0.70986940,
-0.92775759,
-0.30662106,
-0.48687864,
-0.63438095,
-0.82946885,
-0.01452507,
-0.36340812,
-0.76450095,
-0.05204716,
-0.38562019,
-0.05199702,
-0.45459437,
-0.81622248,
-0.21160280,
-0.41421237,
-0.30611782,
-0.54168722,
-0.58142085,
-0.00574811,
-0.26207722,
-0.65258643,
-0.91074764,
-0.25090980,
-0.65160584,
-0.74321728,
-0.46162349,
-0.64794524,
-0.00708626,
-0.08258277,
-0.95482134,
-0.26446551,
-0.55610524,
-0.41672267,
-0.60475298,
-0.91677950,
-0.77175974,
-0.30745700,
-0.69129830,
-0.12882445,
-0.71957175,
-0.56673495,
-0.07657036,
-0.76883105,
-0.22512620,
-0.23988805,
-0.18483898,
-0.35404041,
-0.12771881,
-0.31174428,
-0.67329874,
-0.44453770,
-0.20923304,
-0.69459415,
-0.30672540,
-0.01062949,
-0.80182373,
-0.03757013,
-0.64204045,
-0.46169835,
-0.31103118,
-0.45803349,
-0.51656540,
-0.33598096,
-0.51942330,
-0.40153885,
-0.70199353,
-0.83470706,
-0.40779766,
-0.16182862,
-0.56710691,
-0.82756383,
-0.53880508,
-0.49122273,
-0.85656935,
-0.97336926,
-0.28508736,
-0.70307051,
-0.09628520,
-0.41790275,
-0.91174893,
-0.55039829,
-0.82404432,
-0.59922621,
-0.14406539,
-0.22734838,
-0.95755304,
-0.78963030,
-0.67369693,
-0.02098946,
-0.86372584,
-0.99838872,
-0.70795510,
-0.25287252,
-0.16641785,
-0.91322469,
-0.47697395,
-0.81893230,
-0.68677592,
-0.73059378,
-0.60144733,
-0.47065813,
-0.56268206,
-0.33623664,
-0.34900542,
-0.35491956,
-0.93597177,
-0.21596303,
-0.34019219,
-0.52959894,
-0.27615986,
-0.44273615,
-0.87786549,
-0.94187166,
-0.57170889,
-0.22110194,
-0.90718311,
-0.80183159,
-0.87034292,
-0.55380051,
-0.40125313,
-0.49044459,
-0.19305582,
-0.74637549,
-0.26172816,
-0.19448816,
-0.40899990,
-0.82529149,
-0.66661302,
-0.30381869,
-0.91305941,
-0.73656945,
-0.69121461,
-0.26484960,
-0.60248322,
-0.97494144,
-0.83121653,
-0.61091498,
-0.07081513,
-0.07567744,
-0.71866007,
-0.33267631,
-0.50531062,
-0.39888704,
-0.10872352,
-0.68729906,
-0.81455149,
-0.94257213,
-0.46432803,
-0.34445594,
-0.98954196,
-0.91673638,
-0.80904212,
-0.43188013,
-0.10194869,
-0.17058362,
-0.08741133,
-0.30188246,
-0.10311721,
-0.38324826,
-0.79045565,
-0.97687458,
-0.63335516,
-0.47053875,
-0.26084541,
-0.92767782,
-0.50461224,
-0.85879815,
-0.81719439,
-0.14666847,
-0.42222672,
-0.73211146,
-0.18316348,
-0.88323355,
-0.11541756,
-0.37945046,
-0.28418906,
-0.16688670,
-0.94767126,
-0.10983815,
-0.00985425,
-0.67193964,
-0.17868697,
-0.46253249,
-0.93036647,
-0.27532306,
-0.65707595,
-0.32216653,
-0.38622082,
-0.11596226,
-0.64523704,
-0.81816878,
-0.92154010,
-0.48211895,
-0.13102946,
-0.28727070,
-0.40802678,
-0.40352336,
-0.08802370,
-0.98544545,
-0.23033694,
-0.63363561,
-0.47982739,
-0.92330436,
-0.94350833,
-0.57808913,
-0.23949777,
-0.01772478,
-0.27568562,
-0.47050592,
-0.05262313,
-0.28609727,
-0.53136029,
-0.65021211,
-0.84618699,
-0.54957826,
-0.45762244,
-0.60432190,
-0.71664658,
-0.37572658,
-0.47001771,
-0.21026990,
-0.19772486,
-0.22543178,
-0.93954362,
-0.17310232,
-0.49051822,
-0.56834844,
-0.97399679,
-0.46265956,
-0.52892776,
-0.46880204,
-0.75789325,
-0.25546975,
-0.19292741,
-0.36451512,
-0.08822245,
-0.16713137,
-0.27919211,
-0.65945610,
-0.05837347,
-0.59363902,
-0.02292627,
-0.21570422,
-0.67964807,
-0.20332152,
-0.22794046,
-0.89142619,
-0.57621209,
-0.57094225,
-0.54270927,
-0.71667637,
-0.19253014,
-0.95269909,
-0.45399114,
-0.60269561,
-0.01097928,
-0.02703732,
-0.36509203,
-0.72316005,
-0.89559573,
-0.34113065,
-0.62032133,
-0.20993721,
-0.13027416,
-0.79891702,
-0.83445940,
-0.76065780,
-0.33241297,
-0.82739969,
-0.86675502,
-0.53485706,
-0.39996474,
-0.79763326,
-0.74572337,
-0.59362260,
-0.05944430,
-0.86668433,
-0.90572589,
-0.36163348,
-0.35558121,
-0.22167362,
-0.10464263,
-0.00293490,
-0.41558449,
-0.75838752,
-0.90797110,
-0.14536769,
-0.09626122,
-0.18191810,
-0.40010064,
-0.55300641,
-0.75881041,
-0.06515499,
-0.92950326,
-0.18896106,
-0.17508700,
-0.32193580,
-0.33538764,
-0.43355859,
-0.36194669,
-0.72261426,
-0.80960127,
-0.38456111,
-0.41154158,
-0.21813774,
-0.73172899,
-0.39572871,
-0.70828682,
-0.96563629,
-0.93753539,
-0.39342624,
-0.06516199,
-0.64648895,
-0.63595081,
-0.31939623,
-0.61396741,
-0.52689789,
-0.59234586,
-0.20506426,
-0.81763749,
-0.71854632,
-0.51593576,
-0.11265148,
-0.03599679,
-0.91866106,
-0.64331469,
-0.92013079,
-0.95315088,
-0.02735762,
-0.49750520,
-0.17264785,
-0.70371460,
-0.88729106,
-0.59557849,
-0.59777437,
-0.29109032,
-0.77390140,
-0.08193165,
-0.85166464,
-0.83187850,
-0.68786443,
-0.73662158,
-0.08412526,
-0.86273413,
-0.56367507,
-0.29447819,
-0.40825913,
-0.43642375,
-0.71297178,
-0.05364713,
-0.75007430,
-0.00597741,
-0.46201771,
-0.47050628,
-0.51782929,
-0.12011783,
-0.25401427,
-0.10297217,
-0.75798368,
-0.16907244,
-0.91671275,
-0.12719863,
-0.90401382,
-0.93641667,
-0.75762824,
-0.43675064,
-0.44155659,
-0.65893813,
-0.17269739,
-0.87175877,
-0.57695942,
-0.07820688,
-0.03229611,
-0.99791721,
-0.34362788,
-0.67140844,
-0.16160679,
-0.86204618,
-0.59279395,
-0.99808011,
-0.43267766,
-0.01690944,
-0.15557124,
-0.12174334,
-0.95710845,
-0.86391788,
-0.14303727,
-0.15031850,
-0.87010129,
-0.62128234,
-0.99029802,
-0.72910185,
-0.40058418,
-0.07017864,
-0.79576827,
-0.66035362,
-0.03306705,
-0.28675014,
-0.70145027,
-0.55919419,
-0.26819881,
-0.43406007,
-0.10038572,
-0.87696956,
-0.00442900,
-0.92773560,
-0.92908834,
-0.59408206,
-0.30705959,
-0.42926631,
-0.08198244,
-0.50732622,
-0.70366483,
-0.63071371,
-0.75129732,
-0.51707972,
-0.23703917,
-0.44612389,
-0.61232535,
-0.51270637,
-0.41606051,
-0.24429683,
-0.81885345,
-0.23220565,
-0.39589732,
-0.56778472,
-0.39555145,
-0.63989973,
-0.52033035,
-0.42349094,
-0.07277094,
-0.46241879,
-0.12204898,
-0.68910307,
-0.74421798,
-0.14116501,
-0.18813067,
-0.64069755,
-0.99623829,
-0.30789500,
-0.27572059,
-0.18870155,
-0.13340488,
-0.43908999,
-0.90210143,
-0.79062292,
-0.74779122,
-0.11639139,
-0.38566192,
-0.73712316,
-0.60874867,
-0.51550778,
-0.09777034,
-0.82152095,
-0.55291641,
-0.31531107,
-0.75763805,
-0.28742295,
-0.57437338,
-0.84976603,
-0.40780147,
-0.68904214,
-0.94915229,
-0.73736694,
-0.86536528,
-0.11455328,
-0.18577587,
-0.90381890,
-0.85501757,
-0.03334000,
-0.82080398,
-0.16041644,
-0.21830389,
-0.66867564,
-0.90191103,
-0.86131989,
-0.91924632,
-0.10063568,
-0.35927262,
-0.02021742,
-0.32354035,
-0.56614039,
-0.13679549,
-0.17148188,
-0.28944495,
-0.52565120,
-0.61009394,
-0.52534017,
-0.53381774,
-0.58477717,
-0.77189397,
-0.27132971,
-0.94772381,
-0.86277210,
-0.49679883,
-0.34061263,
-0.91913988,
-0.32645031,
-0.68348031,
-0.01540239,
-0.53649471,
-0.67451187,
-0.88198129,
-0.93488385,
-0.10749459,
-0.04246160,
-0.46807550,
-0.51022256,
-0.08371172,
-0.97943633,
-0.89369497,
-0.99663247,
-0.15867943,
-0.44935921,
-0.81515710,
-0.12024638,
-0.77265015,
-0.34020363,
-0.91679131,
-0.60303210,
-0.00070981,
-0.02079942,
-0.09135199,
-0.00287917,
-0.93015750,
-0.90877867,
-0.26781620,
-0.79076002,
-0.87177567,
-0.53515398,
-0.65813759,
-0.90249432,
-0.12097107,
-0.10603115,
-0.66378466,
-0.98941286,
-0.34032557,
-0.22236113,
-0.37122081,
-0.41630802,
-0.13306993,
-0.23196190,
-0.35983303,
-0.06033201,
-0.06095919,
-0.32065185,
-0.32643151,
-0.17927347,
-0.14290483,
-0.15459292,
-0.40974716,
-0.82572736,
-0.67374924,
-0.50710924,
-0.08894960,
-0.67293422,
-0.20436869,
-0.55565894,
-0.94474651,
-0.45607666,
-0.67107337,
-0.11648258,
-0.02148863,
-0.06375105,
-0.68400475,
-0.77436336,
-0.67406329,
-0.82980252,
-0.31267802,
-0.20909996,
-0.78612563,
-0.59766015,
-0.48433844,
-0.38484825,
-0.27755036,
-0.57193765,
-0.31755741,
-0.44174801,
-0.75365164,
-0.52358657,
-0.48008545,
-0.82374346,
-0.68140072,
-0.22205443,
-0.38970573,
-0.69060350,
-0.81088899,
-0.68297144,
-0.77022863,
-0.20646155,
-0.49850159,
-0.76217193,
-0.59618513,
-0.47946589,
-0.06533630,
-0.26889088,
-0.97728238,
-0.66023611,
-0.78134076,
-0.09155394,
-0.75962854,
-0.21450534,
-0.43998199,
-0.38282114,
-0.95157117,
-0.65884151,
-0.23504882,
-0.37567486,
-0.36065622,
-0.09310409,
-0.98940339,
-0.19885750,
-0.97987391,
-0.48489003,
-0.10514352,
-0.85639555,
-0.41244680,
-0.11818328,
-0.22737942,
-0.22599682,
-0.53330604,
-0.56412040,
-0.33990888,
-0.64102440,
-0.53915253,
-0.91236055,
-0.25530266,
-0.57542149,
-0.30145780,
-0.40583546,
-0.85612458,
-0.10321414,
-0.83891371,
-0.45724149,
-0.60435318,
-0.46238707,
-0.83214222,
-0.50081851,
-0.48947396,
-0.04550463,
-0.32372653,
-0.24846131,
-0.26492879,
-0.72957923,
-0.83166503,
-0.64992367,
-0.80172173,
-0.80407803,
-0.94259383,
-0.30488954,
-0.83427314,
-0.18396217,
-0.55656984,
-0.40794029,
-0.39897058,
-0.71048518,
-0.11346146,
-0.57347836,
-0.28816011,
-0.25366617,
-0.01292629,
-0.92517556,
-0.26939034,
-0.42750102,
-0.82639972,
-0.18367556,
-0.68490265,
-0.41117301,
-0.53986696,
-0.07645440,
-0.36540267,
-0.38051848,
-0.02531312,
-0.89349592,
-0.93145249,
-0.00689134,
-0.12607463,
-0.31158042,
-0.98478446,
-0.57469122,
-0.59640362,
-0.52177210,
-0.25060513,
-0.97914850,
-0.23775951,
-0.53081894,
-0.89630943,
-0.29267583,
-0.68771243,
-0.21777351,
-0.07813489,
-0.95357788,
-0.65755896,
-0.31163016,
-0.37772328,
-0.77903790,
-0.54881043,
-0.71832481,
-0.99223822,
-0.93545863,
-0.61550507,
-0.65067288,
-0.51042303,
-0.18531422,
-0.74333039,
-0.05551456,
-0.72476650,
-0.29042900,
-0.65587324,
-0.85901742,
-0.70060244,
-0.80631292,
-0.03313453,
-0.97583745,
-0.21555435,
-0.85571682,
-0.96118727,
-0.97516871,
-0.02971354,
-0.22262144,
-0.14031042,
-0.54011295,
-0.63169171,
-0.08919292,
-0.90392081,
-0.71451208,
-0.15269640,
-0.38860621,
-0.44240526,
-0.21990206,
-0.42446024,
-0.16336774,
-0.61560743,
-0.26590804,
-0.66272448,
-0.16472598,
-0.15901332,
-0.33166029,
-0.60278331,
-0.20826792,
-0.88004573,
-0.37264120,
-0.71135054,
-0.57385210,
-0.14188824,
-0.85404113,
-0.70125242,
-0.80900748,
-0.68118412,
-0.64312618,
-0.34810455,
-0.89289094,
-0.13056389,
-0.85912815,
-0.35416398,
-0.90764018,
-0.11012916,
-0.96315238,
-0.11697351,
-0.20399901,
-0.35737401,
-0.09946974,
-0.01645048,
-0.94715627,
-0.90117868,
-0.88311257,
-0.13219862,
-0.64442398,
-0.44662971,
-0.53020512,
-0.40783306,
-0.55909083,
-0.62200679,
-0.53179957,
-0.62333140,
-0.26678763,
-0.39324973,
-0.95945254,
-0.00791549,
-0.58188611,
-0.12371497,
-0.01623319,
-0.47072909,
-0.54692025,
-0.07751632,
-0.91727803,
-0.57935120,
-0.44003357,
-0.11739521,
-0.29248220,
-0.85249724,
-0.77909890,
-0.72263647,
-0.25207206,
-0.95694837,
-0.28188893,
-0.23027777,
-0.78323741,
-0.96535541,
-0.67749807,
-0.20934972,
-0.47537444,
-0.40017664,
-0.12895616,
-0.82189004,
-0.92516072,
-0.39675421,
-0.38509535,
-0.91309974,
-0.84830762,
-0.17894002,
-0.72101558,
-0.48370584,
-0.43018592,
-0.13553720,
-0.97096163,
-0.17105287,
-0.98105461,
-0.28401017,
-0.79292198,
-0.18700176,
-0.88081060,
-0.08383506,
-0.83382083,
-0.84688655,
-0.50276377,
-0.55614396,
-0.77620631,
-0.97226139,
-0.65179120,
-0.85343932,
-0.26838662,
-0.54855617,
-0.18507355,
-0.45772555,
-0.50161865,
-0.29922160,
-0.88520188,
-0.15708878,
-0.10717706,
-0.22348768,
-0.07358947,
-0.51722388,
-0.74551379,
-0.95480082,
-0.99342286,
-0.45546317,
-0.17481889,
-0.58989252,
-0.75804107,
-0.39018616,
-0.20718973,
-0.50909269,
-0.01162746,
-0.73229661,
-0.94565081,
-0.42108324,
-0.79006783,
-0.62575492,
-0.17661865,
-0.60941870,
-0.19045557,
-0.12880716,
-0.03194555,
-0.53862273,
-0.27784753,
-0.61892525,
-0.29389972,
-0.90344597,
-0.75482104,
-0.77438037,
-0.99089960,
-0.98625093,
-0.42511902,
-0.46726058,
-0.01988200,
-0.85047383,
-0.47540333,
-0.34839509,
-0.42579416,
-0.85472824,
-0.71666984,
-0.28735474,
-0.18995376,
-0.33522933,
-0.86101909,
-0.36044234,
-0.38621701,
-0.63027393,
-0.49736309,
-0.94162702,
-0.66085013,
-0.86425222,
-0.87734141,
-0.86920999,
-0.28114182,
-0.85364243,
-0.59216544,
-0.40975932,
-0.48409443,
-0.84578847,
-0.68882242,
-0.27538613,
-0.03541212,
-0.33261673,
-0.63891632,
-0.86380173,
-0.80700281,
-0.82886174,
-0.22481681,
-0.95578882,
-0.48078318,
-0.62461012,
-0.20826017,
-0.15314906,
-0.98318057,
-0.86615424,
-0.09983005,
-0.97408158,
-0.88858050,
-0.91334116,
-0.85300752,
-0.65776508,
-0.81514181,
-0.95859043,
-0.17299603,
-0.55653840,
-0.70339858,
-0.04484440,
-0.04939929,
-0.99895501,
-0.54305342,
-0.22630937,
-0.00547146,
-0.93327079,
-0.57410342,
-0.64325346,
-0.34308512,
-0.18911814,
-0.45522515,
-0.68628710,
-0.09347415,
-0.93054261,
-0.12700639,
-0.37720144,
-0.42096085,
-0.18674702,
-0.37488249,
-0.63797680,
-0.82047479,
-0.06507309,
-0.46648748,
-0.25445712,
-0.33196045,
-0.05624218,
-0.37153589,
-0.23659799,
-0.92544988,
-0.35041505,
-0.72233192,
-0.60737938,
-0.79671548,
-0.51290114,
-0.22427092,
-0.67266885,
-0.35989140,
-0.59364960,
-0.60677075,
-0.96645985,
-0.74149771,
-0.40787970,
-0.82219296,
-0.92548225,
-0.51062349,
-0.03743767,
-0.80929576,
-0.57387937,
-0.25962086,
-0.67540182,
-0.79290835,
-0.70805025,
-0.36557140,
-0.95866389,
-0.94809072,
-0.81389528,
-0.79475158,
-0.87627454,
-0.85757904,
-0.77825270,
-0.10226558,
-0.76270159,
-0.29207129,
-0.56020278,
-0.53204222,
-0.22499851,
-0.42065678,
-0.03063634,
-0.66316461,
-0.86354053,
-0.80329257,
-0.97717311,
-0.08327953,
-0.38966854,
-0.94564757,
-0.03145502,
-0.50739392,
-0.20798653,
-0.93112315,
-0.66200453,
-0.65507041,
-0.07540516,
-0.82196194,
-0.54688685,
-0.09355161,
-0.50550630,
-0.56377755,
-0.35702923,
-0.70479441,
-0.02060203,
-0.92598542,
-0.72538649,
-0.55162554,
-0.20729088,
-0.41573169,
-0.35315092,
-0.22222477,
-0.41167115,
-0.71830617,
-0.42950644,
-0.61746438,
-0.78807266,
-0.66413148,
-0.46623188,
-0.23872201,
-0.41652256,
-0.45338403,
-0.46232584,
-0.88527509,
-0.08580252,
-0.85490525,
-0.33470405,
-0.45080160,
-0.80441750,
-0.36831645,
-0.42920487,
-0.86988212,
-0.43968328,
-0.19431645,
-0.67531543,
-0.61928361,
-0.87438455,
-0.98459299,
-0.65912802,
-0.77960472,
-0.23340147,
-0.32007436,
-0.33487688,
-0.04802390,
-0.80303811,
-0.40870424,
-0.67406076,
-0.58458836,
-0.97730215,
-0.84105633,
-0.36657000,
-0.52449683,
-0.46241625,
-0.22465066,
-0.06901574,
-0.29138405,
-0.04394235,
-0.58509094,
-0.26356933,
-0.70423307,
-0.10335157,
-0.60851669,
-0.69811155,
-0.73520881,
-0.88888153,
-0.86983549,
-0.13802120,
-0.07173505,
-0.61953334,
-0.47931116,
-0.81440794,
-0.39751984,
-0.31890020,
-0.59350994,
-0.35702698,
-0.07335388,
-0.09172985,
-0.72063786,
-0.79265161,
-0.98568000,
-0.75456268,
-0.65927803,
-0.41686278,
-0.30304917,
-0.19631649,
-0.86733414,
-0.07568901,
-0.45690016,
-0.94087184,
-0.04145908,
-0.18803475,
-0.78182107,
-0.97550321,
-0.97997041,
-0.97546902,
-0.28242956,
-0.78647062,
-0.11402011,
-0.87979170,
-0.94080496,
-0.56660286,
-0.88006984,
-0.59149377,
-0.62049184,
-0.98295904,
-0.96801545,
-0.58230063,
-0.03515776,
-0.57843598,
-0.24906470,
-0.47642294,
-0.44062452,
-0.63151217,
-0.91276297,
-0.69218718,
-0.29039733,
-0.37983434,
-0.83444409,
-0.47117711,
-0.70348558,
-0.98389334,
-0.96498492,
-0.66646771,
-0.30557096,
-0.22462713,
-0.73146163,
-0.72902506,
-0.11679759,
-0.59177611,
-0.47581082,
-0.65114552,
-0.23417515,
-0.17277516,
-0.49261591,
-0.26204994,
-0.03248304,
-0.35562222,
-0.12810063,
-0.48345933,
-0.79623490,
-0.94323036,
-0.70566203,
-0.10922765,
-0.52106345,
-0.18539654,
-0.09191246,
-0.43005128,
-0.71206101,
-0.09577551,
-0.68027397,
-0.14053176,
-0.29571153,
-0.05786383,
-0.00213734,
-0.94524546,
-0.12837415,
-0.00251662,
-0.25058834,
-0.46482847,
-0.87212930,
-0.96666530,
-0.17232499,
-0.48983555,
-0.82184052,
-0.43973118,
-0.86462503,
-0.52952910,
-0.31277691,
-0.51264005,
-0.54326309,
-0.62980460,
-0.81863151,
-0.85272185,
-0.51705048,
-0.27990811,
-0.16934737,
-0.69190041,
-0.56383164,
-0.51833161,
-0.62627568,
-0.94403578,
-0.48245873,
-0.77267811,
-0.38301514,
-0.32480180,
-0.23529809,
-0.83640514,
-0.71301696,
-0.22543042,
-0.67524875,
-0.62701381,
-0.19012868,
-0.01931105,
-0.74798511,
-0.24938786,
-0.26396720,
-0.60689597,
-0.80720125,
-0.33140085,
-0.34959672,
-0.38073269,
-0.97790902,
-0.10263740,
-0.79196274,
-0.60845112,
-0.10047951,
-0.29890505,
-0.09528602,
-0.35050211,
-0.42619416,
-0.56907594,
-0.03672172,
-0.39682079,
-0.01570660,
-0.85964906,
-0.27999424,
-0.21731897,
-0.20180035,
-0.16072799,
-0.83708810,
-0.65613189,
-0.60484345,
-0.15664663,
-0.42215655,
-0.30965806,
-0.64097679,
-0.69330935,
-0.52499797,
-0.61240006,
-0.36610026,
-0.58877762,
-0.44217209,
-0.47431987,
-0.94256603,
-0.29858860,
-0.28463464,
-0.77093387,
-0.12229798,
-0.42999475,
-0.93583494,
-0.56688883,
-0.07739135,
-0.07410194,
-0.05747806,
-0.24641837,
-0.38184001,
-0.03418086,
-0.53654433,
-0.56828973,
-0.67672227,
-0.65673607,
-0.16811168,
-0.70270657,
-0.01307453,
-0.65884383,
-0.34645339,
-0.47218501,
-0.42727746,
-0.25136125,
-0.17129184,
-0.51085232,
-0.83791212,
-0.52495519,
-0.39376644,
-0.16673384,
-0.61800080,
-0.49185279,
-0.15757932,
-0.81117469,
-0.20094478,
-0.06876281,
-0.04545421,
-0.96566783,
-0.39032907,
-0.84328522,
-0.91562951,
-0.04083780,
-0.90857442,
-0.05398407,
-0.01963090,
-0.34827777,
-0.35774012,
-0.42137673,
-0.45787380,
-0.72891762,
-0.54696069,
-0.09399416,
-0.52116243,
-0.91858417,
-0.94393823,
-0.38561819,
-0.54555642,
-0.41801178,
-0.43209042,
-0.41416728,
-0.17560564,
-0.68632449,
-0.01741337,
-0.64813781,
-0.27719642,
-0.75114566,
-0.89110142,
-0.37849222,
-0.45445826,
-0.26835794,
-0.11373836,
-0.62883622,
-0.67734164,
-0.98135732,
-0.74459198,
-0.89867807,
-0.71873196,
-0.04056921,
-0.12216182,
-0.35502401,
-0.60877796,
-0.14227833,
-0.79884687,
-0.34428528,
-0.81727715,
-0.54885226,
-0.54971411,
-0.57371100,
-0.38332570,
-0.12523451,
-0.42857519,
-0.42284241,
-0.95111243,
-0.83402413,
-0.50052966,
-0.11852878,
-0.96512972,
-0.86378133,
-0.56679878,
-0.60347040,
-0.33187513,
-0.66238766,
-0.79800923,
-0.35813157,
-0.72968678,
-0.40868187,
-0.76950777,
-0.40308456,
-0.67164181,
-0.00832375,
-0.12984354,
-0.34185607,
-0.38113855,
-0.25185074,
-0.58218927,
-0.03981468,
-0.37549775,
-0.01669370,
-0.45267935,
-0.00602895,
-0.44425182,
-0.78557240,
-0.10756355,
-0.01830927,
-0.97665616,
-0.43576310,
-0.60044651,
-0.24741308,
-0.81411881,
-0.84927149,
-0.62896146,
-0.96484680,
-0.06819819,
-0.31318838,
-0.37809679,
-0.42011529,
-0.27496471,
-0.85241373,
-0.25544882,
-0.85567133,
-0.91444573,
-0.57302969,
-0.95922754,
-0.28655432,
-0.03472770,
-0.54888770,
-0.67971283,
-0.47549935,
-0.80145410,
-0.79238376,
-0.35317766,
-0.17603771,
-0.21881122,
-0.49798137,
-0.32280266,
-0.87523059,
-0.36276750,
-0.34031226,
-0.21950623,
-0.85735051,
-0.07255827,
-0.46760023,
-0.57572146,
-0.85349865,
-0.70892399,
-0.28948492,
-0.26765980,
-0.94478640,
-0.95269009,
-0.47620269,
-0.52803192,
-0.89646419,
-0.09264622,
-0.66230375,
-0.60546238,
-0.41603577,
-0.54771159,
-0.28066118,
-0.71304504,
-0.32525540,
-0.72512241,
-0.69839700,
-0.61531015,
-0.64326165,
-0.01930134,
-0.05372038,
-0.87583869,
-0.37850698,
-0.11358096,
-0.21541370,
-0.96006140,
-0.45826285,
-0.81726532,
-0.14787930,
-0.78296619,
-0.96348749,
-0.71278669,
-0.44305700,
-0.59347270,
-0.08894525,
-0.86167079,
-0.39442352,
-0.04907962,
-0.13969625,
-0.61213633,
-0.33645476,
-0.82125092,
-0.40988579,
-0.37761352,
-0.74372092,
-0.91045858,
-0.78320561,
-0.52792446,
-0.98608088,
-0.44493476,
-0.31261071,
-0.85693300,
-0.59994877,
-0.36285169,
-0.17568759,
-0.82061964,
-0.66666524,
-0.98133111,
-0.31860650,
-0.15556854,
-0.35886443,
-0.82746493,
-0.26172396,
-0.56934198,
-0.09831326,
-0.60009440,
-0.00229690,
-0.31161870,
-0.95864796,
-0.01396099,
-0.19032792,
-0.20345723,
-0.23858110,
-0.01806785,
-0.33312797,
-0.19223242,
-0.96202757,
-0.82330686,
-0.23923274,
-0.16290509,
-0.86428374,
-0.79157239,
-0.86438947,
-0.87562409,
-0.47397977,
-0.73860806,
-0.07583569,
-0.70748705,
-0.51635720,
-0.15539700,
-0.25171900,
-0.15072431,
-0.63698985,
-0.82473020,
-0.61122454,
-0.80932036,
-0.56214951,
-0.00157205,
-0.48376306,
-0.75285182,
-0.58747265,
-0.66564324,
-0.51543313,
-0.16162077,
-0.37811052,
-0.75393837,
-0.40341511,
-0.76246258,
-0.06981385,
-0.28377914,
-0.28462059,
-0.96141431,
-0.62240341,
-0.26839660,
-0.51880163,
-0.31278716,
-0.31100169,
-0.60007114,
-0.06343840,
-0.04641475,
-0.31205598,
-0.15213496,
-0.23696236,
-0.04085231,
-0.02404111,
-0.30625384,
-0.55840882,
-0.45302774,
-0.51509691,
-0.29225294,
-0.29132421,
-0.77753539,
-0.44405016,
-0.24646309,
-0.62663819,
-0.78925108,
-0.53227687,
-0.89697423,
-0.39541130,
-0.58707935,
-0.86977068,
-0.70984034,
-0.85934203,
-0.55462301,
-0.97461435,
-0.45610447,
-0.93603468,
-0.93471447,
-0.49699340,
-0.06151419,
-0.46808698,
-0.97356338,
-0.57480846,
-0.32924122,
-0.52982671,
-0.19561920,
-0.33305626,
-0.91819170,
-0.08622155,
-0.00601343,
-0.30405040,
-0.98051053,
-0.20467458,
-0.67710096,
-0.40169123,
-0.24177505,
-0.09999439,
-0.41056564,
-0.11561982,
-0.59210412,
-0.95606165,
-0.56954505,
-0.93922832,
-0.98691796,
-0.69348953,
-0.56707797,
-0.83135700,
-0.07927783,
-0.73088510,
-0.88952789,
-0.89241441,
-0.85597770,
-0.21209028,
-0.75648644,
-0.77891947,
-0.49079251,
-0.05523908,
-0.65138413,
-0.45937973,
-0.96491664,
-0.59669793,
-0.68771269,
-0.90449551,
-0.41187081,
-0.45186650,
-0.28711628,
-0.19955750,
-0.48167724,
-0.91114523,
-0.06348440,
-0.29136227,
-0.06605100,
-0.11893053,
-0.55486605,
-0.11519240,
-0.73524604,
-0.01525110,
-0.72601959,
-0.16114263,
-0.57368268,
-0.93389627,
-0.99480406,
-0.07256693,
-0.72228220,
-0.63683530,
-0.26818393,
-0.55213051,
-0.88925339,
-0.68144480,
-0.03433768,
-0.97215597,
-0.27962721,
-0.48892934,
-0.37089584,
-0.92212601,
-0.75150027,
-0.00768857,
-0.41523111,
-0.28474862,
-0.83102500,
-0.53385463,
-0.72513197,
-0.52529896,
-0.35936942,
-0.01040361,
-0.05603317,
-0.34280698,
-0.69346538,
-0.03061619,
-0.79223546,
-0.07135652,
-0.20353610,
-0.94156882,
-0.27010688,
-0.84871135,
-0.85386497,
-0.90718864,
-0.18124304,
-0.29197994,
-0.01663868,
-0.79853356,
-0.05424041,
-0.50627162,
-0.87191567,
-0.95673680,
-0.53872923,
-0.43212693,
-0.36672882,
-0.64728116,
-0.37995147,
-0.77090908,
-0.91122042,
-0.60724155,
-0.08775090,
-0.46038054,
-0.04536021,
-0.02865378,
-0.16120080,
-0.43479057,
-0.45215102,
-0.10100633,
-0.40503351,
-0.62827073,
-0.34087667,
-0.60296163,
-0.58945606,
-0.01272081,
-0.52875696,
-0.71732613,
-0.57802911,
-0.70637882,
-0.20314066,
-0.77041901,
-0.07657978,
-0.43037889,
-0.83517148,
-0.80504019,
-0.58024920,
-0.36949856,
-0.31321582,
-0.38429404,
-0.42614470,
-0.91594476,
-0.39384361,
-0.59465781,
-0.71556515,
-0.49893284,
-0.95873915,
-0.15022925,
-0.31822578,
-0.96103226,
-0.56275599,
-0.56650040,
-0.44290458,
-0.26855279,
-0.67993463,
-0.57786117,
-0.32356020,
-0.60002963,
-0.25411878,
-0.99538534,
-0.82973496,
-0.15973387,
-0.32016820,
-0.72572619,
-0.36354143,
-0.02789991,
-0.39852217,
-0.75778682,
-0.58545993,
-0.98841945,
-0.69896002,
-0.48382896,
-0.09936356,
-0.21631314,
-0.32663680,
-0.63158296,
-0.87816415,
-0.99104711,
-0.52087460,
-0.04564080,
-0.05236431,
-0.84676047,
-0.58767828,
-0.99608612,
-0.62303820,
-0.57634855,
-0.89630963,
-0.02853017,
-0.14537447,
-0.55262306,
-0.95167770,
-0.38682656,
-0.10168806,
-0.05940649,
-0.83356562,
-0.82979635,
-0.41100793,
-0.39412490,
-0.69046412,
-0.40010075,
-0.77028169,
-0.61395285,
-0.84846140,
-0.40140887,
-0.92075791,
-0.24561935,
-0.31847224,
-0.01585731,
-0.52781963,
-0.31163596,
-0.64635268,
-0.81412699,
-0.73548531,
-0.29533248,
-0.78215579,
-0.30326714,
-0.42182853,
-0.60214375,
-0.66656964,
-0.96947928,
-0.79758828,
-0.02474881,
-0.76524422,
-0.56903045,
-0.67717640,
-0.64605870,
-0.37286168,
-0.62345304,
-0.63205685,
-0.97958169,
-0.17275101,
-0.37027136,
-0.06184511,
-0.09453645,
-0.31541093,
-0.77919740,
-0.26334475,
-0.74919536,
-0.76054736,
-0.06706835,
-0.29453119,
-0.95633787,
-0.88909695,
-0.06667142,
-0.02137645,
-0.64702176,
-0.28775554,
-0.99701142,
-0.78648305,
-0.57872086,
-0.98915082,
-0.17183260,
-0.65449864,
-0.06127067,
-0.62957167,
-0.03363137,
-0.29694416,
-0.31470012,
-0.07748866,
-0.95040763,
-0.88860881,
-0.32366453,
-0.62774319,
-0.78541526,
-0.73127492,
-0.37440508,
-0.74708002,
-0.85789609,
-0.58166975,
-0.16491205,
-0.74761538,
-0.09167263,
-0.85967720,
-0.88003979,
-0.35880978,
-0.97366064,
-0.01638667,
-0.89221965,
-0.22142310,
-0.57097660,
-0.11413345,
-0.30471967,
-0.43389434,
-0.22303637,
-0.67783629,
-0.78102496,
-0.46691922,
-0.00634824,
-0.89587190,
-0.80100322,
-0.47313211,
-0.11803485,
-0.76208175,
-0.44027168,
-0.22429462,
-0.97664883,
-0.93124996,
-0.61735868,
-0.81247474,
-0.36644937,
-0.49019518,
-0.92660833,
-0.42342826,
-0.63982768,
-0.70276049,
-0.04659166,
-0.93593656,
-0.96679108,
-0.40538303,
-0.04770089,
-0.24566124,
-0.33349823,
-0.96140075,
-0.49207490,
-0.46602906,
-0.64285050,
-0.69045893,
-0.34852270,
-0.20128288,
-0.73821497,
-0.35694870,
-0.02391726,
-0.38811951,
-0.56987232,
-0.62674498,
-0.18009937,
-0.70345388,
-0.25468156,
-0.76391347,
-0.89155955,
-0.64584685,
-0.25662656,
-0.85503816,
-0.04246198,
-0.98245389,
-0.03356521,
-0.43167337,
-0.00214197,
-0.06213172,
-0.49025220,
-0.60404866,
-0.10394800,
-0.16153561,
-0.03696668,
-0.29538595,
-0.52778644,
-0.45373633,
-0.00363267,
-0.06353323,
-0.11956848,
-0.87424113,
-0.88700242,
-0.06711172,
-0.65763480,
-0.60981012,
-0.21177761,
-0.42645958,
-0.89577011,
-0.47332383,
-0.55661374,
-0.03403531,
-0.17877854,
-0.87523964,
-0.43357184,
-0.03234010,
-0.35406369,
-0.33330701,
-0.37975544,
-0.23889477,
-0.55051121,
-0.71854409,
-0.89886730,
-0.35251940,
-0.61374190,
-0.41672145,
-0.41917371,
-0.08882039,
-0.69613306,
-0.47733047,
-0.57299672,
-0.07974453,
-0.58161568,
-0.56999134,
-0.76703099,
-0.20241054,
-0.86508708,
-0.95618681,
-0.54968322,
-0.50794548,
-0.86539208,
-0.49488863,
-0.95074859,
-0.81503368,
-0.61908241,
-0.47480730,
-0.45777879,
-0.88957830,
-0.91263274,
-0.34110003,
-0.71854976,
-0.88906460,
-0.45561646,
-0.97571885,
-0.63676417,
-0.18742000,
-0.83734430,
-0.59089905,
-0.98381635,
-0.51222580,
-0.91169766,
-0.55009047,
-0.36623834,
-0.19696429,
-0.15955152,
-0.16463497,
-0.57938596,
-0.58362313,
-0.88381385,
-0.70729036,
-0.84344689,
-0.02287305,
-0.58782645,
-0.94552742,
-0.57513149,
-0.03683572,
-0.83105369,
-0.99621654,
-0.52814782,
-0.84019587,
-0.04402831,
-0.24630315,
-0.67656682,
-0.37671247,
-0.52418999,
-0.01915658,
-0.72672323,
-0.31205821,
-0.95915843,
-0.08721636,
-0.36070840,
-0.87931656,
-0.40675766,
-0.23352621,
-0.81414105,
-0.49908766,
-0.67075368,
-0.62237486,
-0.79859638,
-0.69121545,
-0.97752128,
-0.04397756,
-0.58900076,
-0.56538850,
-0.69652744,
-0.99311346,
-0.65161702,
-0.19019937,
-0.86535661,
-0.84015341,
-0.35243523,
-0.17288767,
-0.08702409,
-0.36920321,
-0.49210823,
-0.24484878,
-0.38854918,
-0.19347983,
-0.50304284,
-0.60684853,
-0.46939312,
-0.88334569,
-0.80569165,
-0.56024132,
-0.17985692,
-0.95422623,
-0.26547520,
-0.82125680,
-0.61785370,
-0.95921486,
-0.21053640,
-0.43443777,
-0.59356550,
-0.03216741,
-0.00978422,
-0.82851958,
-0.50948865,
-0.87021125,
-0.66980803,
-0.92641512,
-0.36063598,
-0.96070938,
-0.97163436,
-0.67017267,
-0.89459642,
-0.47388634,
-0.90689431,
-0.15142885,
-0.07746940,
-0.14640319,
-0.69892181,
-0.00692139,
-0.10896440,
-0.56529389,
-0.62295659,
-0.06346621,
-0.39462665,
-0.31208788,
-0.69558581,
-0.06907835,
-0.40110417,
-0.68978750,
-0.16328823,
-0.93730251,
-0.49025465,
-0.74204014,
-0.68162181,
-0.98876810,
-0.76621274,
-0.59464218,
-0.30053761,
-0.56209981,
-0.84044228,
-0.80755623,
-0.67738652,
-0.96844464,
-0.15609242,
-0.21678772,
-0.35273176,
-0.88951092,
-0.70729075,
-0.45662666,
-0.90504423,
-0.40908920,
-0.69046542,
-0.77034634,
-0.79237090,
-0.84386820,
-0.09029813,
-0.97610729,
-0.11061791,
-0.44346279,
-0.26551403,
-0.86909756,
-0.50169947,
-0.42781977,
-0.23965608,
-0.03055004,
-0.23674566,
-0.12865014,
-0.08628564,
-0.10508361,
-0.03701318,
-0.43794864,
-0.47226075,
-0.57748484,
-0.09043457,
-0.34172588,
-0.56814580,
-0.97287402,
-0.18998668,
-0.93916491,
-0.19042695,
-0.41802619,
-0.13821468,
-0.30569076,
-0.07560275,
-0.91484620,
-0.63611324,
-0.63761433,
-0.91135412,
-0.04279960,
-0.12782313,
-0.30478953,
-0.63556376,
-0.63485541,
-0.46414751,
-0.00692539,
-0.76192650,
-0.87388990,
-0.74413812,
-0.04572777,
-0.96183841,
-0.77306540,
-0.66079734,
-0.64222249,
-0.69592213,
-0.81145996,
-0.25293593,
-0.04101095,
-0.16092005,
-0.89139654,
-0.99783739,
-0.48229495,
-0.85796022,
-0.36157491,
-0.96430955,
-0.17871127,
-0.05331440,
-0.47178141,
-0.30794392,
-0.37007700,
-0.86694359,
-0.46242577,
-0.12399558,
-0.72559042,
-0.34502888,
-0.73315474,
-0.04337390,
-0.17378616,
-0.68531317,
-0.79334752,
-0.81909418,
-0.07086089,
-0.76587590,
-0.38120917,
-0.71879949,
-0.93236519,
-0.54281108,
-0.62526059,
-0.86258819,
-0.81040069,
-0.51688809,
-0.51792214,
-0.49242666,
-0.13398247,
-0.37839774,
-0.43033100,
-0.60840577,
-0.40069721,
-0.95473165,
-0.34358778,
-0.20418437,
-0.19536351,
-0.80931909,
-0.59671595,
-0.86497715,
-0.10933252,
-0.21929861,
-0.95490280,
-0.55769819,
-0.85929009,
-0.22503142,
-0.17986800,
-0.19899939,
-0.88878090,
-0.00837768,
-0.08064768,
-0.58769727,
-0.20330272,
-0.80285808,
-0.60836353,
-0.39651649,
-0.16028834,
-0.43070702,
-0.63713479,
-0.17130429,
-0.23342869,
-0.99215089,
-0.10636861,
-0.27490052,
-0.15617849,
-0.08540630,
-0.61506935,
-0.27191154,
-0.83974723,
-0.06555870,
-0.30006147,
-0.77468761,
-0.38237033,
-0.84043289,
-0.74243003,
-0.30796432,
-0.40250252,
-0.98853595,
-0.04576139,
-0.27835211,
-0.70297403,
-0.43921087,
-0.34317208,
-0.03413293,
-0.17643388,
-0.30357875,
-0.49253047,
-0.97465733,
-0.14054716,
-0.92971414,
-0.35745591,
-0.65212382,
-0.49826828,
-0.30124343,
-0.24592347,
-0.17990908,
-0.45409310,
-0.53125839,
-0.50683353,
-0.12407559,
-0.73550998,
-0.77393226,
-0.04292175,
-0.39560152,
-0.38506546,
-0.55158694,
-0.19595256,
-0.31392470,
-0.28048429,
-0.01229459,
-0.54368849,
-0.38145378,
-0.11015701,
-0.80197300,
-0.79055488,
-0.39198058,
-0.65583076,
-0.50254415,
-0.27018542,
-0.30171577,
-0.91593880,
-0.95498973,
-0.28668148,
-0.11160109,
-0.46770633,
-0.24598465,
-0.69866882,
-0.60496074,
-0.64387004,
-0.00959799,
-0.64530587,
-0.33846937,
-0.33524340,
-0.75242798,
-0.13187935,
-0.43393744,
-0.97136179,
-0.05965052,
-0.00144774,
-0.40880192,
-0.77099004,
-0.58265960,
-0.14990601,
-0.98874051,
-0.80964444,
-0.67179270,
-0.69799195,
-0.20054190,
-0.69315093,
-0.66281674,
-0.50197091,
-0.86911283,
-0.05622310,
-0.07498564,
-0.88084816,
-0.66997856,
-0.49611969,
-0.03717905,
-0.64988387,
-0.61455132,
-0.92281581,
-0.28693968,
-0.89376918,
-0.13543213,
-0.00925301,
-0.48729213,
-0.37831605,
-0.42440953,
-0.40849972,
-0.41302968,
-0.48514933,
-0.03960654,
-0.19772316,
-0.77265484,
-0.69833739,
-0.87620973,
-0.84109998,
-0.50854271,
-0.31831919,
-0.64681184,
-0.52157447,
-0.51716764,
-0.76011432,
-0.03266563,
-0.06390669,
-0.05468030,
-0.28058591,
-0.69265677,
-0.32431816,
-0.85881157,
-0.73311682,
-0.27399968,
-0.46134093,
-0.57011692,
-0.59226255,
-0.87465122,
-0.20523190,
-0.64842370,
-0.80381779,
-0.88456222,
-0.08830437,
-0.82833062,
-0.36925242,
-0.78932518,
-0.99817296,
-0.56944507,
-0.38835071,
-0.70117746,
-0.81691219,
-0.26068958,
-0.34680554,
-0.82430258,
-0.72282719,
-0.06458292,
-0.20719094,
-0.12946304,
-0.17027982,
-0.39873965,
-0.95250622,
-0.97609320,
-0.81101743,
-0.11626147,
-0.45912077,
-0.24424615,
-0.80938566,
-0.48151948,
-0.14402319,
-0.83331490,
-0.82642851,
-0.60746663,
-0.73972026,
-0.15110486,
-0.85193671,
-0.11544756,
-0.97776574,
-0.83577472,
-0.26280147,
-0.76662472,
-0.21666483,
-0.52602366,
-0.00186026,
-0.13650851,
-0.57030220,
-0.97957657,
-0.75339501,
-0.93192922,
-0.35649952,
-0.13089209,
-0.74120989,
-0.51390267,
-0.46952104,
-0.20244848,
-0.77604696,
-0.50188556,
-0.01229191,
-0.58275032,
-0.97098879,
-0.82463930,
-0.07868454,
-0.23861260,
-0.98946962,
-0.66773333,
-0.22539156,
-0.25864086,
-0.98104186,
-0.80574103,
-0.22068368,
-0.25051105,
-0.51761756,
-0.52844336,
-0.33042624,
-0.71920827,
-0.02519373,
-0.79019795,
-0.42085763,
-0.06486357,
-0.98742199,
-0.47619752,
-0.90861949,
-0.77559457,
-0.72095500,
-0.98470495,
-0.26071414,
-0.65642573,
-0.59986746,
-0.33034910,
-0.37898961,
-0.04847475,
-0.01753906,
-0.35288739,
-0.72977484,
-0.25680117,
-0.30241517,
-0.42692985,
-0.71792272,
-0.48967418,
-0.29490927,
-0.90626093,
-0.30413190,
-0.75576705,
-0.69111895,
-0.69337547,
-0.44644366,
-0.91851074,
-0.12340150,
-0.02657708,
-0.22301180,
-0.54484339,
-0.16475581,
-0.44282388,
-0.52439347,
-0.43969571,
-0.18691724,
-0.44714894,
-0.63569398,
-0.30657075,
-0.03991860,
-0.84036016,
-0.77889906,
-0.76897381,
-0.84933654,
-0.21280832,
-0.49094059,
-0.58879151,
-0.68023687,
-0.32333072,
-0.49080658,
-0.13851054,
-0.48324295,
-0.43485847,
-0.90751198,
-0.40329476,
-0.40557115,
-0.89493734,
-0.94882077,
-0.16760570,
-0.30512684,
-0.79819502,
-0.73365391,
-0.56228049,
-0.44640212,
-0.24589094,
-0.51396494,
-0.60857645,
-0.80016483,
-0.98828691,
-0.04054195,
-0.34062482,
-0.50418035,
-0.43944765,
-0.49804901,
-0.98044630,
-0.10121148,
-0.97009256,
-0.42564943,
-0.22530850,
-0.84680176,
-0.70786492,
-0.84322196,
-0.27998504,
-0.42962822,
-0.53316456,
-0.02269710,
-0.62600741,
-0.20465294,
-0.24360261,
-0.40051340,
-0.15377945,
-0.51057740,
-0.91740992,
-0.62953608,
-0.88063941,
-0.54774601,
-0.92078377,
-0.37610236,
-0.69982586,
-0.33655669,
-0.32245940,
-0.19172681,
-0.13317369,
-0.89639240,
-0.82617760,
-0.75589017,
-0.91197665,
-0.66368813,
-0.85685337,
-0.14502538,
-0.65435021,
-0.48735605,
-0.56912926,
-0.06341111,
-0.16815400,
-0.72905086,
-0.60677722,
-0.88233803,
-0.79591704,
-0.35081876,
-0.86849427,
-0.81807704,
-0.36229191,
-0.92650132,
-0.52122899,
-0.02029516,
-0.55234237,
-0.02265133,
-0.39351829,
-0.81762592,
-0.77886178,
-0.93736944,
-0.47136144,
-0.85480388,
-0.23135842,
-0.42836815,
-0.03310351,
-0.69693047,
-0.66111425,
-0.16513947,
-0.80915902,
-0.38173887,
-0.14169622,
-0.65138185,
-0.60157312,
-0.69100621,
-0.11538027,
-0.69477389,
-0.53076539,
-0.25759352,
-0.24379077,
-0.76031245,
-0.60392243,
-0.84288378,
-0.86727544,
-0.19483207,
-0.84087118,
-0.64398490,
-0.12028683,
-0.92029398,
-0.27141042,
-0.63034825,
-0.20318018,
-0.89185702,
-0.70345110,
-0.95173729,
-0.61009672,
-0.97515344,
-0.56183205,
-0.12435098,
-0.88689943,
-0.99720441,
-0.32643909,
-0.70664283,
-0.84587352,
-0.97569692,
-0.42893886,
-0.25828652,
-0.91814315,
-0.13518743,
-0.17894096,
-0.80668115,
-0.81221679,
-0.97977471,
-0.36835120,
-0.29078972,
-0.33551900,
-0.42976261,
-0.46178918,
-0.57247518,
-0.25630582,
-0.01522632,
-0.97119098,
-0.66201269,
-0.83949159,
-0.86918386,
-0.29627269,
-0.25892976,
-0.21142076,
-0.17233929,
-0.30796787,
-0.75856276,
-0.45008619,
-0.36332992,
-0.91943623,
-0.91494331,
-0.08606637,
-0.51405728,
-0.74030250,
-0.57578527,
-0.92504210,
-0.96910634,
-0.85433878,
-0.05526220,
-0.89281149,
-0.63621639,
-0.54735295,
-0.80163335,
-0.92897739,
-0.54736394,
-0.08379611,
-0.81445550,
-0.33501940,
-0.89363849,
-0.85092741,
-0.34287689,
-0.37544647,
-0.72406308,
-0.55668414,
-0.64549113,
-0.94976910,
-0.82058900,
-0.81923248,
-0.78162148,
-0.59760478,
-0.82625676,
-0.45971214,
-0.32471709,
-0.31675951,
-0.90495803,
-0.76683896,
-0.89927452,
-0.09343310,
-0.29590001,
-0.35370139,
-0.68610705,
-0.69142891,
-0.92008198,
-0.88196988,
-0.27907894,
-0.97397077,
-0.49253886,
-0.71290746,
-0.35250590,
-0.35574163,
-0.11075325,
-0.75090126,
-0.36922065,
-0.77739987,
-0.35392517,
-0.27390000,
-0.43232172,
-0.96440931,
-0.00631001,
-0.96905257,
-0.10186091,
-0.35871112,
-0.33015675,
-0.82767579,
-0.95470489,
-0.92926291,
-0.85902525,
-0.38258107,
-0.33097739,
-0.98624942,
-0.57403567,
-0.52635899,
-0.94610320,
-0.46779583,
-0.19821702,
-0.39944491,
-0.87009148,
-0.85465707,
-0.10682326,
-0.99082181,
-0.01637486,
-0.80340269,
-0.69081234,
-0.85032906,
-0.90405469,
-0.85053739,
-0.40845395,
-0.40407643,
-0.78362378,
-0.97440020,
-0.76672067,
-0.79940492,
-0.44479936,
-0.83990673,
-0.85022830,
-0.11976560,
-0.40750924,
-0.97119317,
-0.55086173,
-0.39770716,
-0.56092534,
-0.97605317,
-0.61476425,
-0.88646170,
-0.01097402,
-0.00749885,
-0.68661721,
-0.24333626,
-0.83334385,
-0.57864262,
-0.70266192,
-0.07888926,
-0.22995665,
-0.69494086,
-0.78231414,
-0.87395487,
-0.21783445,
-0.09443897,
-0.85767714,
-0.70716916,
-0.08422777,
-0.05079796,
-0.67565270,
-0.82215178,
-0.80051186,
-0.45092871,
-0.96191765,
-0.82022314,
-0.71060754,
-0.55080299,
-0.80225494,
-0.60500890,
-0.00760499,
-0.56803428,
-0.79332020,
-0.97249752,
-0.66266461,
-0.82868580,
-0.03824051,
-0.33548251,
-0.31726418,
-0.42729456,
-0.04018306,
-0.74282683,
-0.48800455,
-0.18952925,
-0.09825821,
-0.17548473,
-0.40682394,
-0.26102725,
-0.60227538,
-0.14478043,
-0.37276808,
-0.40794113,
-0.91938072,
-0.50224671,
-0.64540821,
-0.45352714,
-0.92812387,
-0.36600983,
-0.20845159,
-0.67495422,
-0.19157291,
-0.19231800,
-0.76945356,
-0.52109377,
-0.59769856,
-0.38501730,
-0.16236734,
-0.88349653,
-0.79441444,
-0.39341830,
-0.18859973,
-0.56539254,
-0.47375118,
-0.00315680,
-0.23978458,
-0.98181537,
-0.45939496,
-0.07063987,
-0.09969299,
-0.00756536,
-0.24428603,
-0.05025534,
-0.45573153,
-0.93977935,
-0.31631021,
-0.67970180,
-0.15316982,
-0.35236402,
-0.11633137,
-0.94765329,
-0.23972059,
-0.69933444,
-0.29089617,
-0.34395651,
-0.28440155,
-0.10440837,
-0.16207185,
-0.06144323,
-0.41177568,
-0.76761181,
-0.20743672,
-0.14435922,
-0.76365301,
-0.45615676,
-0.13540959,
-0.33340477,
-0.54581644,
-0.13099677,
-0.20775633,
-0.10035025,
-0.18493007,
-0.85957869,
-0.20841919,
-0.89632874,
-0.31054281,
-0.62711120,
-0.10304881,
-0.48346403,
-0.22202271,
-0.98090170,
-0.32235210,
-0.18350991,
-0.67277648,
-0.51120184,
-0.16451143,
-0.11735384,
-0.71704555,
-0.37715924,
-0.33562068,
-0.85687462,
-0.52567113,
-0.85391032,
-0.54692694,
-0.03873612,
-0.48738406,
-0.02756753,
-0.90191776,
-0.95205589,
-0.37092132,
-0.52488949,
-0.93593502,
-0.17075948,
-0.05017253,
-0.45814354,
-0.14445479,
-0.51622840,
-0.21603882,
-0.71554329,
-0.51743455,
-0.55563424,
-0.47291580,
-0.22377458,
-0.46544715,
-0.59121354,
-0.36174366,
-0.13141934,
-0.18185421,
-0.08157040,
-0.99578156,
-0.47980357,
-0.91782944,
-0.52992905,
-0.62061521,
-0.02428836,
-0.28022817,
-0.66282839,
-0.01393759,
-0.37374567,
-0.45263734,
-0.24305578,
-0.65368815,
-0.01173778,
-0.76043047,
-0.18252567,
-0.76012167,
-0.36943940,
-0.50611369,
-0.84265932,
-0.59230996,
-0.27908755,
-0.72388163,
-0.16292588,
-0.45410291,
-0.18602006,
-0.59809828,
-0.70582070,
-0.39816492,
-0.30648871,
-0.75692196,
-0.84274925,
-0.65082896,
-0.62994897,
-0.49577225,
-0.34692898,
-0.78737167,
-0.89761743,
-0.77089334,
-0.79799062,
-0.57575030,
-0.72944217,
-0.75892826,
-0.01624144,
-0.30055967,
-0.33724884,
-0.71662308,
-0.44101462,
-0.28845840,
-0.84734498,
-0.60389614,
-0.12398835,
-0.84846071,
-0.45809602,
-0.62625932,
-0.31580680,
-0.80087017,
-0.73425495,
-0.73028931,
-0.87650639,
-0.72270638,
-0.85155772,
-0.48083342,
-0.35772083,
-0.50829606,
-0.10254431,
-0.55056634,
-0.26720548,
-0.08715347,
-0.46353055,
-0.55536364,
-0.65305150,
-0.62736742,
-0.98927504,
-0.92954489,
-0.43603024,
-0.54026537,
-0.73015641,
-0.23898161,
-0.13490940,
-0.57797771,
-0.02820922,
-0.72407893,
-0.20811536,
-0.74912293,
-0.30701062,
-0.11354336,
-0.82503668,
-0.42254455,
-0.77625336,
-0.16387460,
-0.24740952,
-0.32095518,
-0.03239102,
-0.95381957,
-0.09593982,
-0.71804970,
-0.58480041,
-0.02632895,
-0.98032384,
-0.17045980,
-0.15527672,
-0.89532303,
-0.25765751,
-0.38561182,
-0.65057280,
-0.46871205,
-0.15938849,
-0.91475663,
-0.75833398,
-0.82913946,
-0.06361981,
-0.56604476,
-0.42513170,
-0.05353993,
-0.07213675,
-0.13982306,
-0.62065004,
-0.45861583,
-0.31121177,
-0.05894400,
-0.98972494,
-0.40218964,
-0.08050496,
-0.84879461,
-0.22722301,
-0.65131276,
-0.50143724,
-0.51841643,
-0.39500370,
-0.52021496,
-0.83198043,
-0.34873098,
-0.44536850,
-0.49269817,
-0.24144950,
-0.43534133,
-0.87615851,
-0.47986468,
-0.25394618,
-0.17880428,
-0.26390660,
-0.33811571,
-0.15684042,
-0.76499751,
-0.61310558,
-0.93820608,
-0.20248523,
-0.85633834,
-0.88836133,
-0.23592241,
-0.56313121,
-0.87724608,
-0.87987387,
-0.66887269,
-0.93416938,
-0.15596688,
-0.36183564,
-0.97733443,
-0.80676438,
-0.66880469,
-0.85640095,
-0.71421217,
-0.05198834,
-0.95348982,
-0.13279130,
-0.07562466,
-0.33502943,
-0.65023930,
-0.76541483,
-0.00980424,
-0.00092171,
-0.99415268,
-0.17054349,
-0.29955373,
-0.55513233,
-0.58903774,
-0.28224235,
-0.47154128,
-0.70336806,
-0.40766053,
-0.07096153,
-0.44137103,
-0.92345870,
-0.77834160,
-0.53622828,
-0.89667677,
-0.19024101,
-0.66247831,
-0.28285354,
-0.69411808,
-0.84247045,
-0.33429052,
-0.81259942,
-0.24892109,
-0.65233626,
-0.16508920,
-0.28912576,
-0.60975030,
-0.78392234,
-0.87426197,
-0.05302783,
-0.49757237,
-0.28857469,
-0.85001434,
-0.69811076,
-0.83056086,
-0.56259297,
-0.00470078,
-0.87059211,
-0.11141864,
-0.54833041,
-0.40409281,
-0.22638797,
-0.63576188,
-0.29201473,
-0.30003443,
-0.85525476,
-0.97675964,
-0.08101612,
-0.47148485,
-0.37373955,
-0.16374725,
-0.25042336,
-0.22957458,
-0.16555757,
-0.21246067,
-0.35756922,
-0.05506687,
-0.42903485,
-0.97913702,
-0.34618425,
-0.35410956,
-0.55486318,
-0.41541679,
-0.50727770,
-0.97870149,
-0.87178693,
-0.27046837,
-0.35578150,
-0.01103010,
-0.44615045,
-0.05057516,
-0.91821177,
-0.14425571,
-0.42694471,
-0.28215976,
-0.56365844,
-0.69914125,
-0.41204659,
-0.53031018,
-0.76191843,
-0.44520072,
-0.08896826,
-0.96375440,
-0.77632130,
-0.76105336,
-0.53861264,
-0.09272821,
-0.44226776,
-0.13952924,
-0.23353491,
-0.51217142,
-0.64880831,
-0.03236689,
-0.47181985,
-0.71110667,
-0.60572544,
-0.80651861,
-0.20624879,
-0.74404804,
-0.13376518,
-0.82304668,
-0.51846700,
-0.37581146,
-0.39888919,
-0.76130068,
-0.02488910,
-0.06512794,
-0.61893354,
-0.41965067,
-0.36675762,
-0.18825911,
-0.83073337,
-0.69993642,
-0.87043357,
-0.42524197,
-0.49473441,
-0.65680417,
-0.14268696,
-0.30356665,
-0.35391508,
-0.68090765,
-0.02551066,
-0.53964816,
-0.94630248,
-0.63553660,
-0.29404192,
-0.85298945,
-0.28864985,
-0.28378862,
-0.36866454,
-0.41469639,
-0.67660734,
-0.52630315,
-0.62009317,
-0.14444047,
-0.02499518,
-0.67465441,
-0.40992529,
-0.82721317,
-0.42352274,
-0.63796258,
-0.54363682,
-0.05288725,
-0.50987813,
-0.31349342,
-0.90421758,
-0.02713622,
-0.02314899,
-0.57244311,
-0.33667275,
-0.68728706,
-0.11474180,
-0.80296944,
-0.27547723,
-0.23486596,
-0.84672527,
-0.89843678,
-0.08422028,
-0.48886137,
-0.77013508,
-0.67872069,
-0.12849432,
-0.04428102,
-0.38857220,
-0.43566496,
-0.61911964,
-0.38259205,
-0.00876800,
-0.21797016,
-0.09730720,
-0.31722886,
-0.63275696,
-0.49529626,
-0.66915747,
-0.91194412,
-0.74146663,
-0.00301916,
-0.57132768,
-0.22207157,
-0.79772947,
-0.15702996,
-0.66213931,
-0.18922402,
-0.78695173,
-0.55146168,
-0.07631633,
-0.20073134,
-0.79675174,
-0.34164301,
-0.97587877,
-0.24668961,
-0.00897754,
-0.37715581,
-0.72339051,
-0.31520429,
-0.23750766,
-0.39737236,
-0.77850713,
-0.34027464,
-0.73684050,
-0.41906158,
-0.59881973,
-0.10338680,
-0.78559013,
-0.03781387,
-0.72097078,
-0.75385771,
-0.95158820,
-0.51296093,
-0.97214932,
-0.42979271,
-0.60515417,
-0.40215260,
-0.18962423,
-0.49413350,
-0.84802666,
-0.67516329,
-0.23736418,
-0.02167832,
-0.47773319,
-0.65661175,
-0.74969520,
-0.11601125,
-0.07480003,
-0.75198574,
-0.55431977,
-0.93723008,
-0.86989522,
-0.44833226,
-0.20463075,
-0.26792179,
-0.38723879,
-0.37867038,
-0.39426838,
-0.46543125,
-0.71185856,
-0.06725414,
-0.95024157,
-0.67998488,
-0.26211669,
-0.47742126,
-0.23319012,
-0.75948129,
-0.71939849,
-0.43520150,
-0.57588007,
-0.55109916,
-0.85829332,
-0.63696172,
-0.78086451,
-0.33219635,
-0.41655118,
-0.92440856,
-0.45062780,
-0.96870742,
-0.42475846,
-0.92742765,
-0.81837413,
-0.72572028,
-0.57524589,
-0.77102541,
-0.68141944,
-0.84521664,
-0.88473306,
-0.13608670,
-0.14327073,
-0.19724754,
-0.34839124,
-0.11065375,
-0.32658540,
-0.96754583,
-0.19641843,
-0.99270866,
-0.46738476,
-0.33309367,
-0.73029040,
-0.02877005,
-0.01378806,
-0.59863425,
-0.50331938,
-0.13131390,
-0.06887451,
-0.10488829,
-0.50850298,
-0.14695995,
-0.02698733,
-0.75367329,
-0.55622937,
-0.33257268,
-0.06311441,
-0.54188870,
-0.98803273,
-0.54071771,
-0.24578174,
-0.19877032,
-0.40312474,
-0.55835850,
-0.70597564,
-0.73374712,
-0.79772490,
-0.83167316,
-0.52991476,
-0.67850434,
-0.98796358,
-0.60757688,
-0.81667552,
-0.32362674,
-0.67112353,
-0.11923338,
-0.74190552,
-0.66996253,
-0.61556882,
-0.42056895,
-0.97875641,
-0.25325644,
-0.35006968,
-0.06363941,
-0.16439357,
-0.98701318,
-0.93298672,
-0.92979309,
-0.22901546,
-0.92218849,
-0.98951319,
-0.50145059,
-0.33832638,
-0.57665325,
-0.54234348,
-0.34045785,
-0.41800530,
-0.73042246,
-0.96735972,
-0.77230848,
-0.91159620,
-0.74345286,
-0.16239346,
-0.76503971,
-0.73733023,
-0.77142944,
-0.54395139,
-0.80718683,
-0.17533919,
-0.20439412,
-0.45850464,
-0.36608886,
-0.84631851,
-0.58583828,
-0.81876592,
-0.97081161,
-0.65962912,
-0.86747604,
-0.39521971,
-0.79989671,
-0.11721172,
-0.99839659,
-0.64054479,
-0.74654252,
-0.50895887,
-0.03264850,
-0.25136532,
-0.02651710,
-0.62735668,
-0.63926498,
-0.69762734,
-0.38982496,
-0.54507363,
-0.04617173,
-0.94066958,
-0.35219168,
-0.73498492,
-0.98514947,
-0.78698610,
-0.97220355,
-0.98191657,
-0.53802577,
-0.09756269,
-0.75018115,
-0.08748732,
-0.42201580,
-0.21324897,
-0.34784015,
-0.72041645,
-0.77723149,
-0.59231147,
-0.21657821,
-0.73167362,
-0.90648462,
-0.10601881,
-0.91507995,
-0.45008238,
-0.19728546,
-0.53359186,
-0.59970197,
-0.34206743,
-0.35109426,
-0.83166813,
-0.50451622,
-0.68693902,
-0.68224226,
-0.60509635,
-0.65805093,
-0.71069469,
-0.64187786,
-0.36616397,
-0.57807789,
-0.62874532,
-0.07218851,
-0.54187121,
-0.26529395,
-0.98501573,
-0.15321599,
-0.21766414,
-0.68545768,
-0.88038921,
-0.31410865,
-0.79741027,
-0.01345215,
-0.68222738,
-0.18960893,
-0.00969793,
-0.22485537,
-0.11345662,
-0.26403722,
-0.88674074,
-0.25734751,
-0.55716900,
-0.18237886,
-0.73420285,
-0.29487613,
-0.21417400,
-0.84738369,
-0.81819008,
-0.76689342,
-0.46663615,
-0.88455907,
-0.45378701,
-0.83819811,
-0.28259452,
-0.26686566,
-0.41871354,
-0.77300349,
-0.81710667,
-0.78787586,
-0.48958066,
-0.03686629,
-0.79803360,
-0.33817777,
-0.96452284,
-0.98266320,
-0.58531366,
-0.84281160,
-0.39249855,
-0.86358940,
-0.39722651,
-0.58596693,
-0.69639133,
-0.83284803,
-0.86989536,
-0.40500833,
-0.00625550,
-0.75080863,
-0.22802275,
-0.86625630,
-0.42203128,
-0.46259913,
-0.01909042,
-0.31516539,
-0.29948520,
-0.07032718,
-0.77892124,
-0.12208844,
-0.61107304,
-0.44174026,
-0.10365905,
-0.25502067,
-0.81415634,
-0.09445082,
-0.13392696,
-0.78635088,
-0.42556245,
-0.46446327,
-0.97460291,
-0.80520779,
-0.22006008,
-0.93966034,
-0.58380964,
-0.12320679,
-0.42195251,
-0.94431563,
-0.12705800,
-0.02811885,
-0.83634512,
-0.77277022,
-0.95568485,
-0.83384214,
-0.84759410,
-0.82038367,
-0.73105814,
-0.06309649,
-0.01418183,
-0.60239233,
-0.09585119,
-0.23818939,
-0.40652657,
-0.41286116,
-0.72245407,
-0.32844414,
-0.43965720,
-0.56935374,
-0.58591765,
-0.73376336,
-0.36547080,
-0.91884992,
-0.66483459,
-0.09528058,
-0.76476227,
-0.75528490,
-0.48130305,
-0.96206369,
-0.71303462,
-0.57957185,
-0.38809602,
-0.85300370,
-0.37206306,
-0.08099180,
-0.46387517,
-0.59332974,
-0.90949431,
-0.98023115,
-0.61430334,
-0.84877922,
-0.28686417,
-0.79744425,
-0.17219834,
-0.79971942,
-0.03315428,
-0.85907916,
-0.11763401,
-0.82266584,
-0.97011356,
-0.35470200,
-0.72684505,
-0.95192539,
-0.80034967,
-0.69668427,
-0.14051874,
-0.41719945,
-0.36007402,
-0.64748839,
-0.01454984,
-0.94557891,
-0.90116851,
-0.25027704,
-0.66479353,
-0.91099735,
-0.96865340,
-0.89971139,
-0.84547450,
-0.17179556,
-0.63121470,
-0.07557094,
-0.68541294,
-0.58032968,
-0.83983486,
-0.05209775,
-0.18854698,
-0.21196660,
-0.56259739,
-0.01567269,
-0.67176839,
-0.08684359,
-0.34335899,
-0.75830779,
-0.61835403,
-0.28658219,
-0.86573905,
-0.13386626,
-0.49468412,
-0.58098582,
-0.44527989,
-0.70901934,
-0.07426849,
-0.49275611,
-0.72720792,
-0.23858760,
-0.19415837,
-0.44358581,
-0.49473827,
-0.30535215,
-0.76328224,
-0.21649795,
-0.35059425,
-0.13701586,
-0.09023540,
-0.94087801,
-0.87180334,
-0.31574387,
-0.78276335,
-0.76691677,
-0.77689522,
-0.62881795,
-0.51061583,
-0.79725838,
-0.88741634,
-0.82799684,
-0.14802905,
-0.94704581,
-0.59660470,
-0.86716646,
-0.49078706,
-0.51003262,
-0.98927209,
-0.42918437,
-0.75959645,
-0.50867450,
-0.49234946,
-0.28069785,
-0.35091072,
-0.24097897,
-0.77355235,
-0.69909491,
-0.38784418,
-0.05413622,
-0.30356814,
-0.92979464,
-0.15907809,
-0.05349781,
-0.51631403,
-0.11617474,
-0.16900585,
-0.58616378,
-0.52768352,
-0.37647737,
-0.20858053,
-0.12022092,
-0.06646249,
-0.05245473,
-0.11194701,
-0.78439234,
-0.05677296,
-0.26940875,
-0.84275531,
-0.15614206,
-0.45887374,
-0.88488548,
-0.81499149,
-0.64731395,
-0.33427297,
-0.03868363,
-0.08561340,
-0.04262399,
-0.69133093,
-0.33443922,
-0.97599817,
-0.74318964,
-0.56847381,
-0.39670350,
-0.09162275,
-0.57700247,
-0.25466706,
-0.12897697,
-0.15835411,
-0.35613131,
-0.18449421,
-0.66846313,
-0.81843500,
-0.15780628,
-0.44526428,
-0.34419550,
-0.81217276,
-0.99314828,
-0.33811202,
-0.98937072,
-0.13777851,
-0.68803271,
-0.45563394,
-0.12844350,
-0.89614946,
-0.61662485,
-0.84280136,
-0.47475504,
-0.60916960,
-0.03048816,
-0.98318062,
-0.37811934,
-0.90435429,
-0.09971591,
-0.68182297,
-0.18867845,
-0.20354599,
-0.12478614,
-0.56177237,
-0.50558852,
-0.11890941,
-0.02942156,
-0.88675924,
-0.43345344,
-0.87528085,
-0.23916545,
-0.59815948,
-0.16039809,
-0.59194869,
-0.38512299,
-0.88435371,
-0.66807023,
-0.22009529,
-0.63947547,
-0.53488814,
-0.69926505,
-0.16887364,
-0.47771566,
-0.04090045,
-0.67599792,
-0.22109114,
-0.57917038,
-0.36428126,
-0.51298547,
-0.67691940,
-0.29544828,
-0.81513245,
-0.78529213,
-0.65434918,
-0.10293110,
-0.62718754,
-0.51570748,
-0.07586772,
-0.03927367,
-0.34943443,
-0.26029670,
-0.56591874,
-0.67424966,
-0.03556254,
-0.40206656,
-0.50761331,
-0.32169212,
-0.80400313,
-0.62782913,
-0.30889649,
-0.99781715,
-0.24418325,
-0.53299675,
-0.98969101,
-0.84614587,
-0.07870802,
-0.43682454,
-0.16511203,
-0.44686477,
-0.80501605,
-0.88583481,
-0.95563423,
-0.44540144,
-0.62296749,
-0.74276824,
-0.69726629,
-0.54535854,
-0.51271285,
-0.72757687,
-0.78359054,
-0.82431670,
-0.36578179,
-0.46178307,
-0.81390243,
-0.10121705,
-0.61197197,
-0.11296882,
-0.78178271,
-0.04203788,
-0.76749745,
-0.99411206,
-0.57228356,
-0.39830513,
-0.76789185,
-0.94089733,
-0.29228818,
-0.48744024,
-0.75272213,
-0.95189643,
-0.46256248,
-0.93237180,
-0.49817906,
-0.82610098,
-0.18966666,
-0.79065939,
-0.52812760,
-0.69227545,
-0.96297641,
-0.81485455,
-0.20433764,
-0.02993254,
-0.55218923,
-0.02006422,
-0.07561119,
-0.67343749,
-0.94626234,
-0.63997922,
-0.03374939,
-0.04061261,
-0.79015893,
-0.64443004,
-0.19325822,
-0.58623742,
-0.52525824,
-0.25439536,
-0.70964104,
-0.71951014,
-0.81625394,
-0.95260627,
-0.27843304,
-0.73820041,
-0.15206466,
-0.70958204,
-0.96561537,
-0.65546270,
-0.68189379,
-0.03662795,
-0.48967141,
-0.38811399,
-0.87134793,
-0.12829160,
-0.43297781,
-0.36978654,
-0.62918620,
-0.33016118,
-0.86104918,
-0.61061889,
-0.24677945,
-0.18765538,
-0.41449233,
-0.59777752,
-0.40290554,
-0.77962264,
-0.09832924,
-0.85086180,
-0.50657899,
-0.40673110,
-0.11469401,
-0.62680707,
-0.87994890,
-0.95690457,
-0.94230419,
-0.39608206,
-0.94682726,
-0.57865444,
-0.38764128,
-0.44962851,
-0.90560760,
-0.61526241,
-0.60334412,
-0.83424758,
-0.89308562,
-0.91150964,
-0.56476188,
-0.40917929,
-0.75420821,
-0.26209563,
-0.65485127,
-0.77290120,
-0.74681784,
-0.52204312,
-0.78018309,
-0.29045543,
-0.95362405,
-0.04734688,
-0.14265938,
-0.04655670,
-0.45055267,
-0.07961824,
-0.14694192,
-0.41863884,
-0.74294690,
-0.80378945,
-0.98433842,
-0.39750778,
-0.27835246,
-0.54768942,
-0.31541768,
-0.68520331,
-0.06522008,
-0.46469697,
-0.62197510,
-0.90573294,
-0.63890604,
-0.87011927,
-0.46095668,
-0.50860720,
-0.06666696,
-0.35123140,
-0.86178592,
-0.57969808,
-0.59237827,
-0.95589402,
-0.00217270,
-0.49765496,
-0.67588092,
-0.13916694,
-0.12233545,
-0.58354565,
-0.87224304,
-0.20997187,
-0.55138989,
-0.31143762,
-0.61435477,
-0.00767636,
-0.03074462,
-0.31955827,
-0.83429378,
-0.24481601,
-0.51663581,
-0.41058512,
-0.14664968,
-0.92330175,
-0.88050630,
-0.10676819,
-0.89624416,
-0.45689546,
-0.29487661,
-0.15391025,
-0.78346093,
-0.69601221,
-0.51907164,
-0.96551760,
-0.05891585,
-0.63079154,
-0.39543141,
-0.67337610,
-0.93793540,
-0.73036074,
-0.94267407,
-0.06156967,
-0.25727421,
-0.88651644,
-0.89817256,
-0.01285615,
-0.88497933,
-0.07965006,
-0.80541956,
-0.31849722,
-0.32029107,
-0.82995551,
-0.91366947,
-0.96569770,
-0.72484202,
-0.18652314,
-0.43675477,
-0.83092148,
-0.97997022,
-0.20309612,
-0.63058515,
-0.66878710,
-0.40072300,
-0.65587567,
-0.79579005,
-0.61979662,
-0.21750994,
-0.65744533,
-0.00697254,
-0.74869262,
-0.76635108,
-0.42483524,
-0.14982447,
-0.85893196,
-0.53406345,
-0.36573765,
-0.43105049,
-0.51931895,
-0.23945205,
-0.66149946,
-0.76880815,
-0.18522262,
-0.87427924,
-0.83205974,
-0.62411786,
-0.61589521,
-0.93481604,
-0.10180987,
-0.40071278,
-0.55954495,
-0.86688620,
-0.12514985,
-0.21610517,
-0.10283529,
-0.77765526,
-0.44691492,
-0.84126078,
-0.57016314,
-0.58268494,
-0.66785671,
-0.23562309,
-0.52361603,
-0.42933402,
-0.40646029,
-0.22702437,
-0.99160847,
-0.12603235,
-0.58266958,
-0.52621687,
-0.14160336,
-0.97102714,
-0.89553899,
-0.68051079,
-0.63876902,
-0.65788930,
-0.59883545,
-0.10058272,
-0.25379071,
-0.18147880,
-0.64792741,
-0.23416657,
-0.44621253,
-0.84723163,
-0.34953821,
-0.86307079,
-0.61813858,
-0.25316566,
-0.16405000,
-0.11493626,
-0.78303768,
-0.11026168,
-0.65267236,
-0.78910133,
-0.50143227,
-0.39096594,
-0.57895309,
-0.09204623,
-0.93741771,
-0.80591908,
-0.65321444,
-0.55101708,
-0.22100966,
-0.25782953,
-0.19912988,
-0.59135395,
-0.17797464,
-0.35713465,
-0.73115791,
-0.85596472,
-0.94477440,
-0.58301745,
-0.02352050,
-0.24159639,
-0.42493771,
-0.55603901,
-0.01119777,
-0.07511476,
-0.75073437,
-0.73038829,
-0.21094338,
-0.98512438,
-0.45867695,
-0.79566761,
-0.97279613,
-0.17882817,
-0.22815019,
-0.76187395,
-0.85972678,
-0.81989577,
-0.52860027,
-0.32407990,
-0.91826896,
-0.50802911,
-0.21822439,
-0.10710268,
-0.70224893,
-0.43948995,
-0.18135386,
-0.71805423,
-0.01860136,
-0.43045633,
-0.32161402,
-0.47385865,
-0.53179235,
-0.52935924,
-0.11273473,
-0.01359834,
-0.71111436,
-0.75302277,
-0.19586184,
-0.06272792,
-0.32231248,
-0.14994861,
-0.45507904,
-0.61472423,
-0.23036107,
-0.48488292,
-0.28350899,
-0.04140053,
-0.76542186,
-0.58769637,
-0.37241428,
-0.87920840,
-0.47173486,
-0.16460515,
-0.71482300,
-0.65339596,
-0.40205825,
-0.51437002,
-0.76388102,
-0.85684839,
-0.93643219,
-0.37535652,
-0.52293727,
-0.09918434,
-0.70494604,
-0.07726423,
-0.13590372,
-0.92141412,
-0.98061484,
-0.76983171,
-0.06315160,
-0.50221411,
-0.86461071,
-0.51241832,
-0.83960111,
-0.80236862,
-0.94905904,
-0.34391186,
-0.81092138,
-0.97330149,
-0.58259919,
-0.86646500,
-0.36628564,
-0.30621895,
-0.67410812,
-0.63024804,
-0.54251154,
-0.62353034,
-0.31278465,
-0.84555069,
-0.52162506,
-0.59672065,
-0.80517717,
-0.37303980,
-0.55415945,
-0.83242836,
-0.73891513,
-0.05163085,
-0.60852140,
-0.68097024,
-0.02355208,
-0.40269152,
-0.63552391,
-0.35154575,
-0.09449403,
-0.49002736,
-0.94494111,
-0.15984266,
-0.71467999,
-0.41218969,
-0.39192022,
-0.47626672,
-0.07847981,
-0.94158952,
-0.44739578,
-0.86558429,
-0.80747693,
-0.84464153,
-0.03880969,
-0.48073960,
-0.87040618,
-0.42431293,
-0.14368702,
-0.90828653,
-0.87087446,
-0.19035178,
-0.80515227,
-0.71136020,
-0.28229779,
-0.60744828,
-0.89339459,
-0.98438102,
-0.61945608,
-0.11947011,
-0.11761271,
-0.57436328,
-0.17729634,
-0.11376457,
-0.25626879,
-0.46293362,
-0.77771653,
-0.78994056,
-0.87350022,
-0.97053210,
-0.88642623,
-0.94178491,
-0.11445919,
-0.90944611,
-0.93077730,
-0.94247742,
-0.42039280,
-0.14067376,
-0.31454882,
-0.79215194,
-0.42710806,
-0.30956486,
-0.15853095,
-0.26246304,
-0.89565672,
-0.59549075,
-0.76977311,
-0.47677087,
-0.38614247,
-0.23266197,
-0.60253525,
-0.35358023,
-0.67771597,
-0.87007374,
-0.10029067,
-0.05348363,
-0.22423371,
-0.58422109,
-0.44688301,
-0.61688935,
-0.37235845,
-0.14684265,
-0.26548173,
-0.99697389,
-0.07926894,
-0.95945780,
-0.91887053,
-0.43756052,
-0.79955807,
-0.90556421,
-0.57959693,
-0.11270259,
-0.13610482,
-0.76844382,
-0.56278322,
-0.98162788,
-0.28454552,
-0.52537190,
-0.66325732,
-0.82238284,
-0.98358964,
-0.21484058,
-0.69407603,
-0.98618775,
-0.10255413,
-0.51331664,
-0.08762383,
-0.51860734,
-0.45314329,
-0.65942315,
-0.03154168,
-0.79779251,
-0.11345763,
-0.50728862,
-0.46396887,
-0.41675059,
-0.16743758,
-0.82998341,
-0.83105564,
-0.40746827,
-0.96171954,
-0.37438296,
-0.18231175,
-0.49355217,
-0.24316305,
-0.10334938,
-0.57926364,
-0.96201197,
-0.94385457,
-0.24693284,
-0.45307433,
-0.88668484,
-0.53247342,
-0.53054926,
-0.22968699,
-0.69006744,
-0.53576689,
-0.23554325,
-0.81344245,
-0.88890854,
-0.78612013,
-0.77742002,
-0.50502568,
-0.41511729,
-0.15791859,
-0.46164722,
-0.25522686,
-0.60564937,
-0.81857196,
-0.80341637,
-0.24638749,
-0.69001996,
-0.37201280,
-0.49807992,
-0.65269638,
-0.08006429,
-0.23276154,
-0.77316901,
-0.69357744,
-0.44126647,
-0.38854221,
-0.77577830,
-0.41797035,
-0.47540762,
-0.63597371,
-0.35338721,
-0.49118788,
-0.17793356,
-0.16262141,
-0.31631547,
-0.42313982,
-0.90635285,
-0.08883215,
-0.72602152,
-0.92285254,
-0.78307561,
-0.99758914,
-0.89437558,
-0.85581844,
-0.74868372,
-0.66973991,
-0.04366519,
-0.15718829,
-0.25494948,
-0.31754337,
-0.83257851,
-0.32630560,
-0.07316988,
-0.07935739,
-0.11177437,
-0.49828183,
-0.20899074,
-0.84176721,
-0.48279501,
-0.04661764,
-0.35674678,
-0.07856904,
-0.29901954,
-0.46198846,
-0.07878698,
-0.91825372,
-0.94430469,
-0.78991480,
-0.97363177,
-0.29254969,
-0.57499784,
-0.38248728,
-0.64308509,
-0.44759869,
-0.26831040,
-0.45340530,
-0.77995622,
-0.41678682,
-0.63118017,
-0.11930189,
-0.92172884,
-0.28096482,
-0.33569833,
-0.85205404,
-0.94946871,
-0.67627310,
-0.42310852,
-0.55159419,
-0.97185016,
-0.98573519,
-0.43846910,
-0.66406914,
-0.90715176,
-0.49799992,
-0.19088220,
-0.13790095,
-0.81799944,
-0.75260492,
-0.59121353,
-0.97417480,
-0.77676070,
-0.96911380,
-0.95135143,
-0.63241332,
-0.19983053,
-0.10687645,
-0.15309691,
-0.83267550,
-0.05623931,
-0.13954553,
-0.14437061,
-0.27204811,
-0.62534190,
-0.30119967,
-0.09451157,
-0.91267218,
-0.69294888,
-0.38457188,
-0.60437235,
-0.23283469,
-0.80828358,
-0.74313041,
-0.46832888,
-0.64446298,
-0.57668760,
-0.49750732,
-0.69215097,
-0.26983320,
-0.90677532,
-0.48875172,
-0.67798773,
-0.58634584,
-0.26542206,
-0.42975186,
-0.15659711,
-0.97043721,
-0.17074264,
-0.56836643,
-0.85859915,
-0.18767031,
-0.20215444,
-0.92587126,
-0.45002828,
-0.92865734,
-0.02287994,
-0.77954615,
-0.08780669,
-0.35317463,
-0.17350812,
-0.47958800,
-0.62646322,
-0.96896454,
-0.45432786,
-0.61998638,
-0.28891266,
-0.21210141,
-0.15292626,
-0.04164826,
-0.99952831,
-0.12359255,
-0.80286763,
-0.58967868,
-0.57119828,
-0.47453566,
-0.20662893,
-0.65995338,
-0.67618343,
-0.42166537,
-0.74046602,
-0.04462396,
-0.39545173,
-0.47290577,
-0.10607283,
-0.70956469,
-0.86841519,
-0.05546692,
-0.36727449,
-0.38136464,
-0.09059403,
-0.00021333,
-0.66356150,
-0.92422928,
-0.48364078,
-0.58228237,
-0.80220439,
-0.01039899,
-0.72087972,
-0.83052794,
-0.94741077,
-0.12013511,
-0.10090042,
-0.13552604,
-0.19041667,
-0.55626771,
-0.92868244,
-0.27945302,
-0.33310219,
-0.75085731,
-0.84761899,
-0.14953199,
-0.18211779,
-0.16397278,
-0.16159819,
-0.40946121,
-0.87757542,
-0.47971513,
-0.62280004,
-0.19530567,
-0.46019534,
-0.85729899,
-0.75051966,
-0.09902530,
-0.95559212,
-0.66946820,
-0.71044228,
-0.47481464,
-0.04362959,
-0.09713054,
-0.24992441,
-0.18280718,
-0.98182668,
-0.07480672,
-0.32850699,
-0.01794205,
-0.75248601,
-0.07350623,
-0.58840749,
-0.28756373,
-0.81011452,
-0.30845415,
-0.37395880,
-0.41738182,
-0.64926636,
-0.57674529,
-0.09612152,
-0.32321829,
-0.92502388,
-0.91262692,
-0.04419373,
-0.04981627,
-0.69732753,
-0.17510553,
-0.31518484,
-0.83978216,
-0.33256431,
-0.88972487,
-0.36605559,
-0.03100194,
-0.01241484,
-0.82207784,
-0.17824838,
-0.20307439,
-0.84472137,
-0.35202287,
-0.20481362,
-0.13731639,
-0.07294097,
-0.69026390,
-0.47431547,
-0.87405947,
-0.49057691,
-0.74691859,
-0.44636153,
-0.21204430,
-0.30156378,
-0.47265515,
-0.79221025,
-0.28405418,
-0.30662629,
-0.38326936,
-0.34450006,
-0.79732518,
-0.36087418,
-0.20935468,
-0.79008536,
-0.61023130,
-0.81690482,
-0.98762774,
-0.26395052,
-0.02938085,
-0.81511969,
-0.57316816,
-0.50969017,
-0.23704197,
-0.99457241,
-0.73739347,
-0.14831113,
-0.07781085,
-0.01667779,
-0.02446210,
-0.30461843,
-0.45624214,
-0.85324240,
-0.46615510,
-0.65073326,
-0.63936142,
-0.19331858,
-0.57760115,
-0.14109125,
-0.65179955,
-0.19235944,
-0.16377661,
-0.37531647,
-0.67603850,
-0.70123692,
-0.17839368,
-0.88152213,
-0.32440212,
-0.81388119,
-0.60785977,
-0.60552699,
-0.32678907,
-0.36845947,
-0.37759465,
-0.14006463,
-0.48375005,
-0.56684880,
-0.84741068,
-0.97051818,
-0.52003144,
-0.70241921,
-0.46578825,
-0.13483786,
-0.70827355,
-0.39319856,
-0.54259283,
-0.84830256,
-0.20494108,
-0.94046363,
-0.41376383,
-0.80062570,
-0.18851995,
-0.00625909,
-0.97870873,
-0.27158181,
-0.40918095,
-0.02144116,
-0.54261336,
-0.76732229,
-0.02973490,
-0.29714502,
-0.62128587,
-0.20978977,
-0.69834076,
-0.80713082,
-0.01728458,
-0.07237146,
-0.78140095,
-0.09940348,
-0.55371270,
-0.98477436,
-0.84367982,
-0.10572703,
-0.04406265,
-0.99074882,
-0.23005535,
-0.22180285,
-0.64215772,
-0.79955912,
-0.80024879,
-0.22567822,
-0.42888892,
-0.86987672,
-0.57527333,
-0.72582338,
-0.83564081,
-0.19577353,
-0.70588108,
-0.37594005,
-0.15310397,
-0.09285404,
-0.50063625,
-0.95325586,
-0.19302800,
-0.01959020,
-0.47467787,
-0.30646439,
-0.31896672,
-0.53347812,
-0.63967893,
-0.87072977,
-0.70285191,
-0.33944480,
-0.02839949,
-0.20759664,
-0.74694417,
-0.23727742,
-0.21072149,
-0.67102107,
-0.20806472,
-0.57072226,
-0.05307812,
-0.86890441,
-0.26358206,
-0.54842878,
-0.12822553,
-0.31805021,
-0.25696663,
-0.54936660,
-0.47839137,
-0.66577751,
-0.57952486,
-0.86708423,
-0.91057484,
-0.05065394,
-0.48222322,
-0.19940044,
-0.90380561,
-0.88194555,
-0.97362212,
-0.19507510,
-0.64073715,
-0.25174203,
-0.43392345,
-0.53802304,
-0.09201560,
-0.39619080,
-0.19786790,
-0.04822998,
-0.51296245,
-0.68165090,
-0.48694108,
-0.93478864,
-0.14105924,
-0.89584890,
-0.64719136,
-0.73664125,
-0.45655743,
-0.52272167,
-0.51835549,
-0.26402296,
-0.28666817,
-0.43702866,
-0.03047622,
-0.18723104,
-0.80886872,
-0.70976457,
-0.30165947,
-0.65564790,
-0.89493168,
-0.45712825,
-0.35302815,
-0.91367641,
-0.40296181,
-0.86648226,
-0.12825104,
-0.78387468,
-0.61724700,
-0.70814453,
-0.13842016,
-0.25410919,
-0.01755681,
-0.78669722,
-0.01414903,
-0.35643594,
-0.50886515,
-0.42464202,
-0.23756393,
-0.82387891,
-0.77772274,
-0.62252014,
-0.82081967,
-0.72292384,
-0.35382319,
-0.21401730,
-0.69911172,
-0.50702079,
-0.12980521,
-0.69375236,
-0.88450255,
-0.45179744,
-0.75846429,
-0.77277765,
-0.48592599,
-0.36434331,
-0.80556900,
-0.68381092,
-0.92666991,
-0.04778139,
-0.25658562,
-0.47400080,
-0.33553745,
-0.67649921,
-0.17674197,
-0.96783217,
-0.35078795,
-0.82392728,
-0.26892566,
-0.12068658,
-0.49912481,
-0.66402159,
-0.88708161,
-0.33573151,
-0.40559164,
-0.92848026,
-0.55380050,
-0.01541596,
-0.45197491,
-0.39384667,
-0.11381746,
-0.27846286,
-0.94774794,
-0.81970477,
-0.66835386,
-0.17154406,
-0.10439503,
-0.80847679,
-0.42471823,
-0.73162488,
-0.10866625,
-0.15667293,
-0.97274299,
-0.39139958,
-0.94277574,
-0.72602474,
-0.66775027,
-0.97493003,
-0.03124073,
-0.01827306,
-0.31896354,
-0.10088852,
-0.64783422,
-0.11114953,
-0.43822232,
-0.12255222,
-0.06201876,
-0.02589244,
-0.53268435,
-0.70512007,
-0.03212900,
-0.14266426,
-0.97272291,
-0.19434810,
-0.44158633,
-0.77669196,
-0.08795529,
-0.46051623,
-0.62562823,
-0.18199534,
-0.31034509,
-0.76972256,
-0.52390483,
-0.26225582,
-0.63823349,
-0.46046687,
-0.30312643,
-0.23561701,
-0.45642214,
-0.96881547,
-0.01315232,
-0.23550959,
-0.08661688,
-0.03807737,
-0.18848471,
-0.63479659,
-0.11627655,
-0.04105770,
-0.85787311,
-0.41016942,
-0.53053412,
-0.91241215,
-0.22063183,
-0.37301220,
-0.87778248,
-0.35423977,
-0.09374385,
-0.45882438,
-0.07743296,
-0.43135286,
-0.48467316,
-0.54398439,
-0.32949608,
-0.66794128,
-0.33745254,
-0.29443685,
-0.98777735,
-0.93150002,
-0.46621870,
-0.62452902,
-0.99712788,
-0.16501246,
-0.51049586,
-0.95652236,
-0.54566767,
-0.72403128,
-0.28420063,
-0.37664412,
-0.83898488,
-0.25296831,
-0.81411408,
-0.21008632,
-0.75000821,
-0.12547033,
-0.03515541,
-0.42178340,
-0.95315709,
-0.50544646,
-0.96034399,
-0.99944903,
-0.02591882,
-0.68483450,
-0.51623561,
-0.92539590,
-0.95870747,
-0.62900623,
-0.13712686,
-0.46400409,
-0.51354587,
-0.15933157,
-0.84419204,
-0.97438449,
-0.65099066,
-0.98511776,
-0.30567025,
-0.48197814,
-0.82633006,
-0.96580494,
-0.96870135,
-0.63591063,
-0.96176875,
-0.02876112,
-0.84811514,
-0.46683302,
-0.76197741,
-0.97648735,
-0.39212014,
-0.63067991,
-0.98118611,
-0.65404181,
-0.99536238,
-0.57822070,
-0.94129575,
-0.37177980,
-0.92129397,
-0.20847048,
-0.09428503,
-0.61338024,
-0.49879980,
-0.42704365,
-0.40209962,
-0.59311705,
-0.88073227,
-0.18562692,
-0.19389487,
-0.72110528,
-0.55710000,
-0.97687512,
-0.84731696,
-0.29928879,
-0.48244639,
-0.06513604,
-0.47518629,
-0.98862580,
-0.45300702,
-0.73240088,
-0.40558137,
-0.38127119,
-0.34332123,
-0.09661346,
-0.79123358,
-0.17878045,
-0.38054928,
-0.70990617,
-0.99902747,
-0.95276725,
-0.64213937,
-0.85673825,
-0.96588081,
-0.80496792,
-0.26116817,
-0.17799751,
-0.76862290,
-0.95668799,
-0.92747925,
-0.28673678,
-0.61177237,
-0.83959649,
-0.83429685,
-0.88591234,
-0.32775389,
-0.58415495,
-0.28053787,
-0.04587834,
-0.16035547,
-0.95839766,
-0.19914235,
-0.56169211,
-0.52676635,
-0.66910287,
-0.12352412,
-0.20103504,
-0.36266683,
-0.22623952,
-0.07916469,
-0.46361577,
-0.19196565,
-0.70077247,
-0.17499083,
-0.04723733,
-0.27810225,
-0.08016886,
-0.93536280,
-0.51953156,
-0.19321542,
-0.03436196,
-0.26842184,
-0.33323877,
-0.15371357,
-0.65365125,
-0.50909238,
-0.93495882,
-0.10115447,
-0.58596717,
-0.48939070,
-0.41596031,
-0.71788152,
-0.53584741,
-0.62672307,
-0.30370845,
-0.00802155,
-0.18432939,
-0.83493539,
-0.56312974,
-0.69309798,
-0.70783005,
-0.56760793,
-0.73231076,
-0.45012179,
-0.34084996,
-0.94563720,
-0.97739188,
-0.65936477,
-0.79061290,
-0.28728730,
-0.11475967,
-0.39837732,
-0.17943245,
-0.58743488,
-0.79163885,
-0.57248204,
-0.29974176,
-0.14190655,
-0.48930060,
-0.21710358,
-0.35937967,
-0.00210467,
-0.98781718,
-0.92706576,
-0.74394362,
-0.42106544,
-0.96121235,
-0.23097613,
-0.85773923,
-0.14297120,
-0.78981390,
-0.85006109,
-0.37337972,
-0.99363555,
-0.52980136,
-0.60962507,
-0.06150217,
-0.41850638,
-0.74747754,
-0.11079417,
-0.94091352,
-0.22730752,
-0.27684657,
-0.88521792,
-0.96719261,
-0.82716992,
-0.30293184,
-0.74179728,
-0.84703351,
-0.27673140,
-0.55472241,
-0.06806246,
-0.20057149,
-0.30431611,
-0.98567054,
-0.38935730,
-0.23465367,
-0.65155357,
-0.24209780,
-0.03655179,
-0.01834624,
-0.85495727,
-0.97662913,
-0.60682311,
-0.31985185,
-0.25649697,
-0.43366266,
-0.15241912,
-0.41991833,
-0.25839092,
-0.92670141,
-0.75111360,
-0.10893991,
-0.49598107,
-0.34545783,
-0.25870552,
-0.95229567,
-0.72052315,
-0.33352016,
-0.15120016,
-0.94808493,
-0.13847270,
-0.28240202,
-0.40592718,
-0.92611814,
-0.28813933,
-0.02798592,
-0.10565122,
-0.26390146,
-0.48753598,
-0.64391512,
-0.06335832,
-0.31166368,
-0.26508860,
-0.22123230,
-0.71688085,
-0.07904178,
-0.80552147,
-0.09532899,
-0.25217914,
-0.83935190,
-0.30107010,
-0.99298844,
-0.19627152,
-0.84319919,
-0.82954578,
-0.97268211,
-0.19931006,
-0.29552174,
-0.81308587,
-0.09854931,
-0.48198146,
-0.49798818,
-0.36424353,
-0.86317066,
-0.35288934,
-0.85515572,
-0.90757359,
-0.73286111,
-0.27603719,
-0.67324822,
-0.71954471,
-0.12706907,
-0.50538352,
-0.17894575,
-0.84968998,
-0.14469806,
-0.16244995,
-0.66367791,
-0.11718203,
-0.76279825,
-0.77997963,
-0.90556286,
-0.33595566,
-0.96927201,
-0.12421044,
-0.59879133,
-0.06481385,
-0.69242053,
-0.23737007,
-0.05634124,
-0.32470717,
-0.65056446,
-0.87661511,
-0.23634389,
-0.27164123,
-0.86443109,
-0.49758909,
-0.51729491,
-0.51994319,
-0.78600128,
-0.70032479,
-0.41654300,
-0.15506875,
-0.78494638,
-0.51152648,
-0.28691374,
-0.25384400,
-0.96368034,
-0.74717102,
-0.41346706,
-0.88812353,
-0.65839986,
-0.22223101,
-0.92775322,
-0.34275480,
-0.99918959,
-0.96719389,
-0.72526444,
-0.64907339,
-0.63259648,
-0.18474898,
-0.79973325,
-0.68792637,
-0.28724460,
-0.67761214,
-0.09584938,
-0.02540386,
-0.63117803,
-0.99092323,
-0.50682964,
-0.15197222,
-0.10584229,
-0.69131671,
-0.45506045,
-0.10681670,
-0.31547926,
-0.41648744,
-0.26820524,
-0.59584659,
-0.42962865,
-0.33135645,
-0.90814239,
-0.43052947,
-0.31831048,
-0.54298595,
-0.03760165,
-0.39532499,
-0.99134700,
-0.52841645,
-0.03716471,
-0.79185099,
-0.07722424,
-0.06410425,
-0.00358460,
-0.24126049,
-0.87641656,
-0.26612991,
-0.03469240,
-0.20559934,
-0.44481580,
-0.56303309,
-0.41374140,
-0.23190785,
-0.42756560,
-0.50320462,
-0.64571391,
-0.35061402,
-0.71616924,
-0.12888276,
-0.53790250,
-0.82511279,
-0.04932298,
-0.30124091,
-0.79936112,
-0.96292225,
-0.73351835,
-0.78197213,
-0.20273154,
-0.79683477,
-0.68749543,
-0.85138136,
-0.05112804,
-0.66194322,
-0.47156431,
-0.29502753,
-0.26876320,
-0.12022580,
-0.51328301,
-0.92820983,
-0.91753744,
-0.81040383,
-0.85414652,
-0.94329623,
-0.23632534,
-0.44736284,
-0.72115347,
-0.98350403,
-0.45431333,
-0.82788910,
-0.21911130,
-0.76328172,
-0.11337112,
-0.24833176,
-0.24456507,
-0.45376379,
-0.29380823,
-0.92089642,
-0.18452534,
-0.75512986,
-0.05282440,
-0.13231237,
-0.55791308,
-0.36305565,
-0.82142358,
-0.35007759,
-0.80037919,
-0.44972001,
-0.16167480,
-0.41624955,
-0.71813338,
-0.82743473,
-0.59427976,
-0.50802910,
-0.38207143,
-0.11413817,
-0.72037609,
-0.95967388,
-0.44785267,
-0.20588377,
-0.25011089,
-0.44846260,
-0.14009257,
-0.02311378,
-0.67074103,
-0.13891703,
-0.57710215,
-0.53163553,
-0.06132028,
-0.35938334,
-0.39534281,
-0.98699678,
-0.24732514,
-0.59326787,
-0.83747323,
-0.24919762,
-0.75251351,
-0.16830311,
-0.50817686,
-0.34576691,
-0.47956663,
-0.08095243,
-0.09065090,
-0.77612528,
-0.67276453,
-0.12937479,
-0.86605077,
-0.83497045,
-0.34869438,
-0.02797589,
-0.92152614,
-0.65593252,
-0.13974857,
-0.69906496,
-0.72177313,
-0.27932922,
-0.15024990,
-0.95881478,
-0.94244398,
-0.04802793,
-0.32030464,
-0.34484965,
-0.99840610,
-0.27519803,
-0.74710468,
-0.79760234,
-0.33084847,
-0.21709949,
-0.21879789,
-0.76095267,
-0.05602887,
-0.28883953,
-0.20397378,
-0.97401556,
-0.89493386,
-0.54235152,
-0.17519345,
-0.89524542,
-0.79996321,
-0.11446285,
-0.91707320,
-0.13576895,
-0.55672518,
-0.53216006,
-0.79992077,
-0.95375672,
-0.40693312,
-0.01234935,
-0.95009999,
-0.95066765,
-0.52147449,
-0.64815661,
-0.33372798,
-0.73312655,
-0.79421617,
-0.92212211,
-0.97839662,
-0.47191446,
-0.74357105,
-0.90564861,
-0.58449567,
-0.76772673,
-0.18332582,
-0.17961285,
-0.53496749,
-0.05863280,
-0.19619434,
-0.77604100,
-0.13272856,
-0.35186160,
-0.29822916,
-0.35568878,
-0.78010790,
-0.11997015,
-0.88122895,
-0.45999125,
-0.38920250,
-0.89587141,
-0.21888467,
-0.79248518,
-0.63969719,
-0.86478567,
-0.10286952,
-0.31994739,
-0.20782968,
-0.05390189,
-0.14545303,
-0.88387733,
-0.11819697,
-0.41982939,
-0.56204798,
-0.52326579,
-0.99354267,
-0.73758357,
-0.33203129,
-0.27573668,
-0.65763007,
-0.63132348,
-0.50171960,
-0.35629081,
-0.72733044,
-0.02528006,
-0.09342721,
-0.46788015,
-0.27068153,
-0.33788537,
-0.12938535,
-0.34818541,
-0.63894698,
-0.22074071,
-0.28757994,
-0.72806086,
-0.18239256,
-0.60565788,
-0.70497636,
-0.44916358,
-0.18482071,
-0.08102797,
-0.71362006,
-0.09656578,
-0.81224522,
-0.55370792,
-0.23378300,
-0.17324344,
-0.96885154,
-0.69787401,
-0.63390437,
-0.78990237,
-0.38063502,
-0.89182670,
-0.00059655,
-0.64601627,
-0.18443726,
-0.55388019,
-0.05922805,
-0.37137310,
-0.75504005,
-0.28955315,
-0.10495522,
-0.39198887,
-0.78649485,
-0.15096154,
-0.09622412,
-0.13687943,
-0.73229024,
-0.46896658,
-0.83565846,
-0.81046972,
-0.28871349,
-0.75106978,
-0.66833932,
-0.50208097,
-0.13870832,
-0.28015150,
-0.40378305,
-0.51895476,
-0.01840280,
-0.91787420,
-0.48036380,
-0.77064899,
-0.80031978,
-0.13528102,
-0.64947566,
-0.53151454,
-0.89673606,
-0.54764236,
-0.57432643,
-0.27837563,
-0.23024899,
-0.31469273,
-0.96964873,
-0.78494099,
-0.13159692,
-0.52957995,
-0.77415559,
-0.99938702,
-0.24206207,
-0.80059257,
-0.11000646,
-0.21187364,
-0.82347614,
-0.44070383,
-0.45010060,
-0.77392147,
-0.31260975,
-0.88873648,
-0.18053474,
-0.05953956,
-0.83486871,
-0.97548125,
-0.44999322,
-0.39912129,
-0.87908898,
-0.31675734,
-0.18106174,
-0.19283508,
-0.66653493,
-0.01080906,
-0.44721420,
-0.95914763,
-0.76576664,
-0.45661969,
-0.60319058,
-0.12413173,
-0.28390053,
-0.87441884,
-0.15986804,
-0.17328313,
-0.78966759,
-0.64113140,
-0.53975646,
-0.77216822,
-0.41765926,
-0.20575364,
-0.34355119,
-0.63585936,
-0.21465575,
-0.24423769,
-0.36625622,
-0.63372833,
-0.77126634,
-0.54004756,
-0.85063807,
-0.56937525,
-0.51024115,
-0.51538428,
-0.43979623,
-0.67583259,
-0.43016596,
-0.86358735,
-0.26961055,
-0.19354517,
-0.15948884,
-0.22449151,
-0.51396187,
-0.61450779,
-0.60571036,
-0.55775418,
-0.39472822,
-0.25358892,
-0.46434570,
-0.09872800,
-0.99395123,
-0.38878758,
-0.09450811,
-0.91945648,
-0.10585485,
-0.15028161,
-0.80314998,
-0.83599430,
-0.33641514,
-0.89029973,
-0.81698477,
-0.13788044,
-0.53713344,
-0.91453194,
-0.50381615,
-0.38832980,
-0.43735454,
-0.07338600,
-0.05395968,
-0.99321659,
-0.45701968,
-0.10062854,
-0.44568544,
-0.42752834,
-0.01138665,
-0.49318690,
-0.71517263,
-0.53930957,
-0.28200601,
-0.71476254,
-0.26158853,
-0.96649352,
-0.13373041,
-0.39646699,
-0.88950701,
-0.86646120,
-0.69930421,
-0.74702286,
-0.13171639,
-0.70358160,
-0.27499036,
-0.48129085,
-0.23055718,
-0.48112299,
-0.27242318,
-0.46568339,
-0.64991578,
-0.74204531,
-0.62049502,
-0.04122093,
-0.52495364,
-0.17073506,
-0.77995603,
-0.22882088,
-0.07262165,
-0.47286707,
-0.70966210,
-0.72481245,
-0.98615033,
-0.29887589,
-0.03795268,
-0.99071715,
-0.93157596,
-0.54000689,
-0.85912948,
-0.63223219,
-0.00978495,
-0.96908074,
-0.14306344,
-0.29096333,
-0.26320009,
-0.72190916,
-0.48833420,
-0.48768130,
-0.89539275,
-0.46624902,
-0.10930404,
-0.47970382,
-0.94133237,
-0.12329324,
-0.79247011,
-0.90788840,
-0.98631485,
-0.82289198,
-0.04796040,
-0.49512965,
-0.40725762,
-0.68424003,
-0.53658425,
-0.72173743,
-0.32498701,
-0.76791558,
-0.59164895,
-0.11541220,
-0.48003597,
-0.15730834,
-0.00802876,
-0.28477591,
-0.40682520,
-0.06092988,
-0.01604981,
-0.02249560,
-0.43407838,
-0.81313227,
-0.38937309,
-0.63492072,
-0.20853435,
-0.60762326,
-0.11485277,
-0.00290375,
-0.89498188,
-0.30468172,
-0.79457478,
-0.91672733,
-0.74660764,
-0.05291754,
-0.79375809,
-0.10133815,
-0.89620099,
-0.93292438,
-0.25108218,
-0.39959295,
-0.27993033,
-0.37569948,
-0.75046136,
-0.95465058,
-0.63037040,
-0.35436807,
-0.27530533,
-0.36707135,
-0.10954955,
-0.16280406,
-0.23898994,
-0.89478971,
-0.43815414,
-0.07817172,
-0.81947705,
-0.08027623,
-0.95491721,
-0.74787906,
-0.73524012,
-0.06501212,
-0.91604798,
-0.72856807,
-0.35665747,
-0.06134899,
-0.26695113,
-0.92298033,
-0.32781031,
-0.82889547,
-0.44187240,
-0.50233032,
-0.64197181,
-0.73623348,
-0.43505444,
-0.69356384,
-0.43821529,
-0.48457643,
-0.11026829,
-0.36156097,
-0.35555672,
-0.48564291,
-0.58002366,
-0.04531864,
-0.21030298,
-0.96768310,
-0.26554880,
-0.10747901,
-0.76385400,
-0.11301610,
-0.77958245,
-0.76438109,
-0.18864871,
-0.89800153,
-0.97526100,
-0.62930655,
-0.66700925,
-0.41631382,
-0.56494535,
-0.23689291,
-0.65000305,
-0.65808441,
-0.21085441,
-0.69362421,
-0.73940527,
-0.14487381,
-0.21144856,
-0.99409507,
-0.05144145,
-0.67685073,
-0.13030775,
-0.65374849,
-0.05772520,
-0.06806053,
-0.49014638,
-0.16360881,
-0.80330449,
-0.69388457,
-0.68249858,
-0.73298198,
-0.34786282,
-0.21145920,
-0.09623264,
-0.86518956,
-0.86416577,
-0.12199349,
-0.55555501,
-0.83745593,
-0.71628715,
-0.18076377,
-0.94762951,
-0.54547797,
-0.97127637,
-0.35976180,
-0.54912677,
-0.73072435,
-0.74731608,
-0.85646369,
-0.31451157,
-0.59580538,
-0.16464824,
-0.94001012,
-0.10469670,
-0.95767911,
-0.99753930,
-0.53482372,
-0.34228795,
-0.62137048,
-0.36066445,
-0.09465269,
-0.02053054,
-0.91350979,
-0.21315726,
-0.83841647,
-0.43320960,
-0.54197633,
-0.79870814,
-0.21189945,
-0.91742355,
-0.65259314,
-0.87960688,
-0.35571267,
-0.10730032,
-0.38432191,
-0.70601805,
-0.28051444,
-0.11811730,
-0.27853811,
-0.57866820,
-0.44106534,
-0.92723252,
-0.92944387,
-0.20177292,
-0.28412282,
-0.00487751,
-0.71941373,
-0.64963290,
-0.12051185,
-0.76080282,
-0.07148190,
-0.87386590,
-0.63736574,
-0.23396629,
-0.18711478,
-0.02113080,
-0.43676609,
-0.53306988,
-0.98965940,
-0.12680771,
-0.24816215,
-0.98016318,
-0.76773788,
-0.87916669,
-0.40308116,
-0.92422910,
-0.22232195,
-0.09110068,
-0.36292709,
-0.40397745,
-0.68490345,
-0.25531685,
-0.49153504,
-0.37963805,
-0.37551524,
-0.61675384,
-0.05607972,
-0.08161105,
-0.96492470,
-0.09238429,
-0.67112321,
-0.08477637,
-0.54073784,
-0.38486357,
-0.79938566,
-0.12227463,
-0.27167564,
-0.65024920,
-0.60807337,
-0.73452539,
-0.44516744,
-0.01831710,
-0.53912078,
-0.13023623,
-0.08543923,
-0.90683735,
-0.57822515,
-0.09016465,
-0.91158984,
-0.88957370,
-0.40844470,
-0.93961330,
-0.89741167,
-0.39410246,
-0.56540376,
-0.26078433,
-0.54332325,
-0.20321347,
-0.17341026,
-0.44573287,
-0.76181108,
-0.42109762,
-0.04965647,
-0.63818072,
-0.99469268,
-0.82887784,
-0.19561726,
-0.97179438,
-0.04945300,
-0.86934931,
-0.18310168,
-0.00296752,
-0.34979431,
-0.69952957,
-0.15796419,
-0.05625759,
-0.41147148,
-0.48041838,
-0.22679004,
-0.18193724,
-0.33798489,
-0.57109743,
-0.56834979,
-0.51770275,
-0.57392792,
-0.85426025,
-0.68364745,
-0.39171364,
-0.22918421,
-0.22960989,
-0.95953897,
-0.77414290,
-0.17608727,
-0.19535335,
-0.25436874,
-0.80729402,
-0.71532730,
-0.76766867,
-0.20963679,
-0.36960722,
-0.90918583,
-0.60789744,
-0.78699128,
-0.29739096,
-0.18055830,
-0.77740295,
-0.54312114,
-0.50530589,
-0.43605330,
-0.99152967,
-0.23707124,
-0.54798424,
-0.15652322,
-0.65537372,
-0.04750063,
-0.36233929,
-0.32328286,
-0.97244234,
-0.36201335,
-0.07530021,
-0.51102971,
-0.11108753,
-0.47338730,
-0.41943006,
-0.37410556,
-0.36983481,
-0.53218625,
-0.95273074,
-0.41393172,
-0.38695997,
-0.50137051,
-0.69365629,
-0.09258973,
-0.09716945,
-0.68620016,
-0.53437286,
-0.05230398,
-0.92295074,
-0.81261390,
-0.18668416,
-0.94788682,
-0.25519403,
-0.38501160,
-0.50039370,
-0.40737314,
-0.08140599,
-0.34257234,
-0.39472980,
-0.95351661,
-0.12644908,
-0.20331162,
-0.46797322,
-0.00034818,
-0.31341871,
-0.97469447,
-0.24176520,
-0.31460475,
-0.32778547,
-0.03445655,
-0.38824157,
-0.58396579,
-0.31249451,
-0.15282559,
-0.56192471,
-0.15136576,
-0.03775452,
-0.99940912,
-0.74407134,
-0.20683715,
-0.42930076,
-0.60823419,
-0.69476400,
-0.51143320,
-0.11665797,
-0.21762959,
-0.71227223,
-0.13879506,
-0.10808971,
-0.03958920,
-0.85316156,
-0.38061732,
-0.40085382,
-0.11870239,
-0.97800927,
-0.79195700,
-0.48427743,
-0.36156053,
-0.74700185,
-0.69989113,
-0.15750135,
-0.38481264,
-0.68839320,
-0.76326383,
-0.61550454,
-0.13631530,
-0.76548043,
-0.54486049,
-0.98020988,
-0.45395345,
-0.42995988,
-0.43738321,
-0.40251179,
-0.71671537,
-0.21106502,
-0.35196308,
-0.94413655,
-0.81759011,
-0.97780113,
-0.34824344,
-0.69776864,
-0.82191966,
-0.26500115,
-0.25240624,
-0.22492616,
-0.10618555,
-0.50995312,
-0.32836164,
-0.15133333,
-0.80382599,
-0.05085861,
-0.69798142,
-0.77330779,
-0.40611778,
-0.47438475,
-0.01748394,
-0.30419929,
-0.27258595,
-0.35844564,
-0.94013879,
-0.78623896,
-0.52804791,
-0.04303215,
-0.99924391,
-0.72852139,
-0.95649191,
-0.21340878,
-0.34097799,
-0.37272092,
-0.48355514,
-0.19130672,
-0.79170224,
-0.05891876,
-0.82174453,
-0.63170426,
-0.35898299,
-0.82578662,
-0.97003999,
-0.05591339,
-0.14911213,
-0.29581543,
-0.91458605,
-0.00843474,
-0.67240040,
-0.63540160,
-0.45172782,
-0.98494151,
-0.61793858,
-0.19734204,
-0.99464445,
-0.17024899,
-0.28849587,
-0.96364531,
-0.61125489,
-0.38600910,
-0.02482491,
-0.55847711,
-0.59968929,
-0.78251570,
-0.39383928,
-0.89076474,
-0.29607656,
-0.78501393,
-0.21705535,
-0.36382662,
-0.22256270,
-0.35320911,
-0.55641347,
-0.39646179,
-0.83426645,
-0.39870991,
-0.82880815,
-0.91490579,
-0.95839445,
-0.74843299,
-0.12708460,
-0.02656199,
-0.59260696,
-0.69960096,
-0.56509200,
-0.72408928,
-0.37819953,
-0.43061722,
-0.67274034,
-0.54994526,
-0.74404646,
-0.08078889,
-0.80425275,
-0.99487931,
-0.89048269,
-0.40288445,
-0.18803788,
-0.05287924,
-0.85655162,
-0.52072760,
-0.31645562,
-0.81388401,
-0.41396615,
-0.35488002,
-0.19140663,
-0.32441347,
-0.86283313,
-0.29276121,
-0.58152855,
-0.96531245,
-0.02825838,
-0.18051850,
-0.56211240,
-0.35551512,
-0.73694729,
-0.63781900,
-0.04957135,
-0.05197361,
-0.45265930,
-0.56103272,
-0.72407101,
-0.51048035,
-0.89347346,
-0.95980261,
-0.11270188,
-0.66025848,
-0.89875438,
-0.76963223,
-0.80106984,
-0.62845366,
-0.32819580,
-0.63806501,
-0.77363980,
-0.64078647,
-0.96463215,
-0.03594819,
-0.28020577,
-0.12413022,
-0.04571181,
-0.30891173,
-0.90763296,
-0.48912522,
-0.81679132,
-0.62841527,
-0.00712043,
-0.58513406,
-0.28143937,
-0.56237905,
-0.03471965,
-0.96098244,
-0.19718571,
-0.33507226,
-0.33670424,
-0.31911029,
-0.14454441,
-0.75721221,
-0.85102393,
-0.79265184,
-0.26461339,
-0.88982031,
-0.78089456,
-0.85284333,
-0.91468748,
-0.47934987,
-0.94638594,
-0.24104729,
-0.63622803,
-0.72164893,
-0.85262677,
-0.69384379,
-0.94973657,
-0.89631154,
-0.18077093,
-0.24005545,
-0.46300371,
-0.90319685,
-0.79028890,
-0.97223515,
-0.13675503,
-0.97987498,
-0.83544705,
-0.96505595,
-0.04292138,
-0.52995250,
-0.89187542,
-0.19588314,
-0.70826247,
-0.52596849,
-0.09964433,
-0.15835135,
-0.94214025,
-0.76476162,
-0.07956622,
-0.86660340,
-0.05623901,
-0.01563923,
-0.47806002,
-0.90435690,
-0.91876300,
-0.23007129,
-0.37196726,
-0.43976936,
-0.20870771,
-0.94622520,
-0.66191086,
-0.97628802,
-0.43140173,
-0.11343420,
-0.63691977,
-0.95971678,
-0.73216428,
-0.46167449,
-0.32167327,
-0.91629822,
-0.35929661,
-0.58282024,
-0.10584332,
-0.86719690,
-0.29615671,
-0.60805653,
-0.16519718,
-0.22767579,
-0.19977255,
-0.91187327,
-0.50768212,
-0.68749899,
-0.39952079,
-0.60870598,
-0.43616188,
-0.26531419,
-0.10710097,
-0.90479420,
-0.20539055,
-0.59915125,
-0.90535623,
-0.89224759,
-0.62486070,
-0.94657321,
-0.35714181,
-0.88124341,
-0.99669598,
-0.16691318,
-0.25302514,
-0.35641790,
-0.69216995,
-0.16788179,
-0.56933107,
-0.90373898,
-0.89523504,
-0.93106116,
-0.81036740,
-0.27813341,
-0.28235168,
-0.38406880,
-0.30120123,
-0.15342466,
-0.96149760,
-0.54675266,
-0.43191921,
-0.14041702,
-0.82001437,
-0.43401545,
-0.80002801,
-0.84009641,
-0.34804288,
-0.65195855,
-0.18857336,
-0.57740879,
-0.00575544,
-0.38311120,
-0.05144867,
-0.31444388,
-0.22332336,
-0.18460447,
-0.97243060,
-0.97820705,
-0.96469750,
-0.79312396,
-0.95400247,
-0.63040475,
-0.86862301,
-0.00029564,
-0.29048578,
-0.77456254,
-0.02954764,
-0.72366671,
-0.83133581,
-0.21652651,
-0.96256394,
-0.06272436,
-0.61363833,
-0.19486873,
-0.93270202,
-0.90069332,
-0.33464758,
-0.40734088,
-0.47493030,
-0.74120730,
-0.34257404,
-0.31660602,
-0.22012326,
-0.59804987,
-0.93191477,
-0.71916068,
-0.70180444,
-0.41955406,
-0.29226733,
-0.57938978,
-0.31898085,
-0.84469903,
-0.08682298,
-0.45393850,
-0.65927689,
-0.83775101,
-0.78204245,
-0.92746362,
-0.00502162,
-0.94337837,
-0.78195959,
-0.91044775,
-0.05070287,
-0.68439829,
-0.48630938,
-0.13687542,
-0.55921762,
-0.69495124,
-0.41357343,
-0.92765227,
-0.31643659,
-0.26441199,
-0.09986682,
-0.12064050,
-0.58183328,
-0.78841781,
-0.80241320,
-0.24626961,
-0.05452608,
-0.20397302,
-0.25492696,
-0.06241451,
-0.01486818,
-0.53220432,
-0.06711686,
-0.62097972,
-0.39134920,
-0.64812362,
-0.33913366,
-0.80138317,
-0.39388752,
-0.95140472,
-0.29729465,
-0.51947131,
-0.00021870,
-0.80093701,
-0.31938897,
-0.52965338,
-0.83219948,
-0.78354708,
-0.79149655,
-0.59337400,
-0.50700061,
-0.17595331,
-0.04754114,
-0.46165015,
-0.64276814,
-0.01712669,
-0.72114871,
-0.60803049,
-0.03827769,
-0.17488796,
-0.65211548,
-0.29790398,
-0.01949963,
-0.68651151,
-0.41579639,
-0.35398496,
-0.17291080,
-0.89908305,
-0.71723417,
-0.90769818,
-0.78880458,
-0.75431413,
-0.09669791,
-0.27055238,
-0.10275293,
-0.62214953,
-0.67947030,
-0.90584983,
-0.40019590,
-0.98928783,
-0.06430338,
-0.65039733,
-0.07839787,
-0.71644784,
-0.91510489,
-0.04609923,
-0.42517753,
-0.98728362,
-0.61265962,
-0.28386158,
-0.84568203,
-0.47998370,
-0.43555615,
-0.34676401,
-0.65388907,
-0.86966691,
-0.94004378,
-0.16323857,
-0.85112986,
-0.91955647,
-0.00040688,
-0.71421163,
-0.94647729,
-0.79326292,
-0.43152726,
-0.71997528,
-0.34679415,
-0.96122716,
-0.88791439,
-0.44479232,
-0.96266240,
-0.71841565,
-0.92897698,
-0.31955395,
-0.64962891,
-0.41708868,
-0.66055804,
-0.46821607,
-0.57244036,
-0.64705971,
-0.42650294,
-0.46700365,
-0.26625803,
-0.99966071,
-0.04321810,
-0.46316901,
-0.80766278,
-0.92589505,
-0.09220442,
-0.55366327,
-0.43511612,
-0.29248057,
-0.66259369,
-0.95182376,
-0.36883464,
-0.01844282,
-0.35955767,
-0.25861682,
-0.09193565,
-0.79246024,
-0.15840734,
-0.79339254,
-0.34056766,
-0.03823292,
-0.68692765,
-0.71332747,
-0.08991130,
-0.63906833,
-0.41477684,
-0.06448112,
-0.73280792,
-0.83584837,
-0.27427064,
-0.10674003,
-0.10807804,
-0.63090490,
-0.06233499,
-0.81451031,
-0.00361668,
-0.31527719,
-0.64209634,
-0.87389257,
-0.77902296,
-0.70046928,
-0.97558625,
-0.40929637,
-0.65027097,
-0.23262033,
-0.07930279,
-0.59872564,
-0.60270222,
-0.95280473,
-0.77371946,
-0.98145065,
-0.89540472,
-0.21661145,
-0.17093930,
-0.10801140,
-0.86241255,
-0.23208902,
-0.93978900,
-0.34095584,
-0.42806995,
-0.51024150,
-0.63099467,
-0.82723550,
-0.66708760,
-0.11569936,
-0.96943057,
-0.97564795,
-0.92273033,
-0.97076918,
-0.62488706,
-0.87664812,
-0.82305412,
-0.57206150,
-0.30960563,
-0.86869618,
-0.82519443,
-0.24499737,
-0.34478821,
-0.04147902,
-0.68370006,
-0.46063757,
-0.30318551,
-0.94298336,
-0.15445524,
-0.98926869,
-0.92063161,
-0.62588360,
-0.55454094,
-0.92367788,
-0.62602696,
-0.91279074,
-0.87960331,
-0.69331419,
-0.04167705,
-0.31876108,
-0.91875632,
-0.03649838,
-0.35435423,
-0.89891951,
-0.95274800,
-0.69635600,
-0.22189356,
-0.84525265,
-0.95222839,
-0.87939732,
-0.87823232,
-0.54467202,
-0.07668784,
-0.70231237,
-0.32606344,
-0.43372488,
-0.39459575,
-0.25580150,
-0.16369721,
-0.18162041,
-0.30475909,
-0.34628996,
-0.36972896,
-0.73366975,
-0.76730002,
-0.66151988,
-0.51644950,
-0.34184806,
-0.67048325,
-0.86155139,
-0.84704239,
-0.53622996,
-0.81563310,
-0.85224655,
-0.89243534,
-0.50370976,
-0.85287109,
-0.14526223,
-0.32325404,
-0.18142624,
-0.47236388,
-0.29845976,
-0.20458102,
-0.59555270,
-0.15452193,
-0.90617862,
-0.52050165,
-0.91046092,
-0.84099427,
-0.22981181,
-0.82546819,
-0.58790312,
-0.59435787,
-0.34475597,
-0.83917521,
-0.65274056,
-0.19493548,
-0.88410346,
-0.89554079,
-0.88967134,
-0.40620522,
-0.83194584,
-0.71030980,
-0.74411349,
-0.95588174,
-0.12049453,
-0.11838606,
-0.48740670,
-0.31032890,
-0.98189442,
-0.63752607,
-0.02699525,
-0.62534431,
-0.76111701,
-0.52135395,
-0.60058949,
-0.08894384,
-0.03728195,
-0.43607841,
-0.16425941,
-0.68831617,
-0.67759842,
-0.00312077,
-0.66405882,
-0.51507993,
-0.77287012,
-0.60601397,
-0.51062123,
-0.68497434,
-0.42341845,
-0.45725697,
-0.14520890,
-0.34871716,
-0.24815134,
-0.43828606,
-0.01070453,
-0.74611451,
-0.09210436,
-0.13540749,
-0.35827833,
-0.18512464,
-0.43840555,
-0.66182542,
-0.18452342,
-0.31580552,
-0.08127238,
-0.88526691,
-0.85950125,
-0.75379451,
-0.03936513,
-0.81688167,
-0.19203730,
-0.65775663,
-0.67884486,
-0.09319204,
-0.67517805,
-0.33728523,
-0.02775934,
-0.29044047,
-0.92990021,
-0.93817953,
-0.07614638,
-0.76465066,
-0.51297470,
-0.45450629,
-0.10062067,
-0.42157338,
-0.63704067,
-0.88426795,
-0.95598381,
-0.99983988,
-0.04670722,
-0.29756147,
-0.24306843,
-0.31667608,
-0.58245847,
-0.27757480,
-0.26536220,
-0.21091405,
-0.98974857,
-0.03675263,
-0.54641917,
-0.62576203,
-0.30665074,
-0.71197771,
-0.41423447,
-0.17062412,
-0.93951285,
-0.54483072,
-0.19122697,
-0.87768595,
-0.83273962,
-0.53830488,
-0.88519299,
-0.91295889,
-0.58956774,
-0.28732666,
-0.22477793,
-0.25952546,
-0.40969214,
-0.96708124,
-0.73173417,
-0.17063704,
-0.14156798,
-0.44963713,
-0.94860494,
-0.71741776,
-0.21415822,
-0.35087976,
-0.57304608,
-0.73828360,
-0.43237593,
-0.11691752,
-0.86206194,
-0.51539651,
-0.84638575,
-0.07502350,
-0.94487885,
-0.11024702,
-0.17393932,
-0.20342078,
-0.51105407,
-0.42871227,
-0.93391965,
-0.98700202,
-0.03768754,
-0.05102632,
-0.07317316,
-0.43930353,
-0.60725653,
-0.97614416,
-0.94711795,
-0.17600630,
-0.31287457,
-0.07163677,
-0.26408721,
-0.29314534,
-0.42717535,
-0.44744191,
-0.15530122,
-0.39777562,
-0.63503964,
-0.80731357,
-0.49322285,
-0.64015198,
-0.64379198,
-0.48285945,
-0.40158198,
-0.98703710,
-0.04372856,
-0.61588471,
-0.69135545,
-0.02095674,
-0.30269638,
-0.06954659,
-0.44155875,
-0.06586155,
-0.80396212,
-0.78183335,
-0.68860590,
-0.38005382,
-0.18231740,
-0.61375827,
-0.15925180,
-0.16125698,
-0.75934694,
-0.83824551,
-0.25489234,
-0.76444616,
-0.77361099,
-0.35564055,
-0.55997565,
-0.29820356,
-0.49311986,
-0.69131980,
-0.72992320,
-0.90983665,
-0.26968586,
-0.94708685,
-0.91420975,
-0.45570997,
-0.63786738,
-0.86607213,
-0.16342469,
-0.71737724,
-0.39122181,
-0.54455885,
-0.11871658,
-0.79573067,
-0.05503800,
-0.41733280,
-0.10672967,
-0.83363364,
-0.70871299,
-0.43091839,
-0.84982600,
-0.49181668,
-0.66383485,
-0.38424477,
-0.62522288,
-0.00760533,
-0.99183712,
-0.79714931,
-0.48042355,
-0.52088719,
-0.72444093,
-0.40440999,
-0.06531779,
-0.65345992,
-0.52384498,
-0.33300103,
-0.61965551,
-0.93767654,
-0.66234533,
-0.97048141,
-0.24107970,
-0.51000624,
-0.02082389,
-0.26756997,
-0.31938335,
-0.53570901,
-0.93866740,
-0.16441813,
-0.94365766,
-0.28592313,
-0.68538725,
-0.98923180,
-0.38001631,
-0.91775163,
-0.89398849,
-0.28815718,
-0.14915656,
-0.22163978,
-0.50150378,
-0.09896902,
-0.68662941,
-0.49277606,
-0.02066553,
-0.85295881,
-0.88435784,
-0.44636864,
-0.29978094,
-0.22040270,
-0.24730420,
-0.08835692,
-0.54178880,
-0.64009004,
-0.00106990,
-0.76568843,
-0.61797528,
-0.83232919,
-0.62613913,
-0.82335487,
-0.40938353,
-0.07276381,
-0.75435200,
-0.79903956,
-0.71116606,
-0.03903357,
-0.41195509,
-0.72273929,
-0.93615233,
-0.78560939,
-0.13816810,
-0.54266892,
-0.46370094,
-0.85454179,
-0.18156893,
-0.47809613,
-0.01449224,
-0.14741057,
-0.04401526,
-0.86532484,
-0.16698460,
-0.60760445,
-0.87052998,
-0.86753894,
-0.18063686,
-0.70315828,
-0.14934755,
-0.89320686,
-0.78844878,
-0.65706448,
-0.40276315,
-0.74523837,
-0.56977889,
-0.25352222,
-0.50547037,
-0.71569082,
-0.09652889,
-0.09166018,
-0.26853974,
-0.59351677,
-0.85214074,
-0.97671282,
-0.41628674,
-0.22569437,
-0.23815529,
-0.69356556,
-0.22093038,
-0.02609476,
-0.21073435,
-0.60873819,
-0.88494692,
-0.41436250,
-0.47618610,
-0.93486462,
-0.35594230,
-0.22194130,
-0.72075779,
-0.03966209,
-0.38002590,
-0.07606761,
-0.16156971,
-0.90109188,
-0.91339437,
-0.23799663,
-0.71642215,
-0.32477748,
-0.54570388,
-0.70691699,
-0.76960502,
-0.82440014,
-0.63022996,
-0.67037588,
-0.47001775,
-0.01794155,
-0.98356319,
-0.78328833,
-0.22872150,
-0.83955485,
-0.90701637,
-0.86949372,
-0.73405539,
-0.08464495,
-0.16693746,
-0.81069215,
-0.72727731,
-0.88671203,
-0.74891315,
-0.79217590,
-0.06276453,
-0.22102006,
-0.99125564,
-0.50291250,
-0.15468822,
-0.22607145,
-0.18610442,
-0.52572000,
-0.05587584,
-0.97557365,
-0.76487049,
-0.59754249,
-0.90093310,
-0.74723865,
-0.13549456,
-0.47042040,
-0.15123787,
-0.84560929,
-0.08619665,
-0.76655840,
-0.28415111,
-0.44956752,
-0.93188643,
-0.43146423,
-0.49388042,
-0.97124187,
-0.31707793,
-0.00861379,
-0.39430915,
-0.99148497,
-0.53085592,
-0.92877641,
-0.69945647,
-0.36010928,
-0.90061503,
-0.26813931,
-0.30915845,
-0.29159966,
-0.11679206,
-0.17864779,
-0.79383170,
-0.18637438,
-0.23971137,
-0.92731511,
-0.39677048,
-0.39796772,
-0.79029740,
-0.58191680,
-0.14255542,
-0.39598659,
-0.01003752,
-0.10641771,
-0.19241821,
-0.91201732,
-0.31114043,
-0.02437302,
-0.86373665,
-0.97876034,
-0.53899771,
-0.05175454,
-0.50641125,
-0.90777848,
-0.22828789,
-0.81864362,
-0.81573802,
-0.22589764,
-0.47638898,
-0.37774515,
-0.20563177,
-0.84578326,
-0.31920237,
-0.91015533,
-0.56959293,
-0.95854174,
-0.21451190,
-0.66056820,
-0.51056020,
-0.14293519,
-0.90907931,
-0.40641379,
-0.70300724,
-0.45236796,
-0.52447225,
-0.80007576,
-0.99256455,
-0.03611798,
-0.78990100,
-0.42728549,
-0.38927850,
-0.10201527,
-0.25652525,
-0.83561822,
-0.36500493,
-0.39330157,
-0.27990222,
-0.75180015,
-0.94187002,
-0.90137169,
-0.88214896,
-0.34701771,
-0.76939643,
-0.47882312,
-0.61868683,
-0.73468985,
-0.50993649,
-0.95947576,
-0.36537444,
-0.99210945,
-0.34589043,
-0.69748583,
-0.28677478,
-0.84860288,
-0.02173613,
-0.27058807,
-0.40823650,
-0.19504211,
-0.96692319,
-0.44605716,
-0.64169857,
-0.80189974,
-0.07494697,
-0.07689009,
-0.44889342,
-0.46031145,
-0.73255597,
-0.38226319,
-0.40051349,
-0.44591092,
-0.68628084,
-0.31933549,
-0.49425980,
-0.23939324,
-0.69238722,
-0.37824648,
-0.23138104,
-0.38147098,
-0.41257972,
-0.84236480,
-0.25081533,
-0.07065699,
-0.02803087,
-0.95045544,
-0.69084089,
-0.48724088,
-0.77546913,
-0.12716702,
-0.42273254,
-0.92207812,
-0.75243823,
-0.64601482,
-0.43782707,
-0.94462377,
-0.25763782,
-0.97809780,
-0.21024485,
-0.75363687,
-0.37384936,
-0.57582975,
-0.44150944,
-0.97800315,
-0.25734640,
-0.03048291,
-0.17843568,
-0.03688090,
-0.58095253,
-0.70591888,
-0.31459707,
-0.03324006,
-0.72047919,
-0.06465082,
-0.53322591,
-0.60872846,
-0.13814637,
-0.43846835,
-0.44787833,
-0.29334772,
-0.53077905,
-0.87752529,
-0.35665287,
-0.58047625,
-0.14905490,
-0.17929439,
-0.61913790,
-0.88113469,
-0.54972232,
-0.85577376,
-0.00408086,
-0.19786903,
-0.65151662,
-0.81716174,
-0.70222332,
-0.58641678,
-0.76650457,
-0.23723734,
-0.74942839,
-0.62753919,
-0.39696472,
-0.65230079,
-0.12083406,
-0.76551242,
-0.34479141,
-0.07481671,
-0.77880353,
-0.52518352,
-0.77416885,
-0.58004580,
-0.36355808,
-0.57111860,
-0.19241105,
-0.67088640,
-0.90847052,
-0.02702738,
-0.47870530,
-0.24774350,
-0.50819422,
-0.38538816,
-0.05527259,
-0.40528677,
-0.63607526,
-0.47430096,
-0.33186965,
-0.26343966,
-0.71851021,
-0.88725673,
-0.61026177,
-0.18480138,
-0.38294827,
-0.81078830,
-0.48527050,
-0.35019136,
-0.56356800,
-0.51873136,
-0.98635906,
-0.41495197,
-0.27820093,
-0.33415046,
-0.01213450,
-0.65880836,
-0.47287160,
-0.32587616,
-0.85062542,
-0.04153949,
-0.83634077,
-0.60091310,
-0.69768730,
-0.61368162,
-0.17952134,
-0.79753651,
-0.52839896,
-0.78257071,
-0.88554507,
-0.21143213,
-0.81897406,
-0.49855093,
-0.42952774,
-0.61553799,
-0.97557368,
-0.73446085,
-0.96460725,
-0.62905400,
-0.68329446,
-0.33157376,
-0.86252520,
-0.98603090,
-0.50249985,
-0.70556481,
-0.70877367,
-0.04945644,
-0.09533727,
-0.42450975,
-0.40567172,
-0.39449191,
-0.08655810,
-0.57613865,
-0.44328781,
-0.97119151,
-0.59145523,
-0.21837549,
-0.38126532,
-0.22152841,
-0.87857573,
-0.95030510,
-0.90618918,
-0.73444424,
-0.39406363,
-0.66718716,
-0.86489710,
-0.07676576,
-0.38679661,
-0.68483348,
-0.75878208,
-0.27596612,
-0.35427872,
-0.57827455,
-0.34800745,
-0.80822492,
-0.39287241,
-0.77621498,
-0.64104226,
-0.22788797,
-0.96624000,
-0.42293158,
-0.45433711,
-0.65968272,
-0.27890523,
-0.62655846,
-0.65995600,
-0.15592073,
-0.52844008,
-0.19680820,
-0.76025243,
-0.98638608,
-0.89905246,
-0.43370540,
-0.56005251,
-0.69983768,
-0.11040888,
-0.31127694,
-0.93687799,
-0.77891534,
-0.16836413,
-0.95035984,
-0.83430427,
-0.29846704,
-0.86457606,
-0.45976160,
-0.07847847,
-0.37344259,
-0.87512996,
-0.21194174,
-0.50655354,
-0.69221220,
-0.64809554,
-0.44239183,
-0.46145434,
-0.44544414,
-0.99909745,
-0.76476276,
-0.26713746,
-0.56392381,
-0.96747337,
-0.06361297,
-0.08952711,
-0.37786475,
-0.20027567,
-0.63848406,
-0.40469330,
-0.14889891,
-0.92235109,
-0.05437240,
-0.82856776,
-0.45274985,
-0.82125773,
-0.05681646,
-0.59942067,
-0.37140687,
-0.16525454,
-0.26307791,
-0.32703044,
-0.30206633,
-0.89906390,
-0.33448262,
-0.71000679,
-0.89853126,
-0.22231372,
-0.33114609,
-0.74655441,
-0.22362130,
-0.61472538,
-0.41380421,
-0.99772793,
-0.27386282,
-0.16677283,
-0.81984637,
-0.41158707,
-0.15517827,
-0.70613659,
-0.99816185,
-0.60516995,
-0.69834217,
-0.42554950,
-0.93675339,
-0.89384357,
-0.38713324,
-0.07959527,
-0.20927852,
-0.78155087,
-0.98697912,
-0.27159189,
-0.33324177,
-0.67763933,
-0.24856176,
-0.55781511,
-0.52265590,
-0.85720641,
-0.75293334,
-0.28171672,
-0.95694307,
-0.23926708,
-0.79761117,
-0.52666742,
-0.01136669,
-0.95383502,
-0.12555871,
-0.20011736,
-0.20763412,
-0.44461520,
-0.43980147,
-0.85955034,
-0.01515098,
-0.89819556,
-0.99163299,
-0.09549456,
-0.86947301,
-0.82403418,
-0.42762961,
-0.92816531,
-0.78746116,
-0.34851384,
-0.92984781,
-0.26570559,
-0.99628727,
-0.36058092,
-0.82069278,
-0.04653829,
-0.92930692,
-0.62610997,
-0.32372998,
-0.82769829,
-0.89598153,
-0.63865453,
-0.59679693,
-0.54583857,
-0.35906653,
-0.73049720,
-0.20142234,
-0.55111407,
-0.52435667,
-0.30085619,
-0.25679024,
-0.32335092,
-0.19461832,
-0.94949215,
-0.64744675,
-0.15285789,
-0.59452420,
-0.12736406,
-0.96155397,
-0.93048537,
-0.92483183,
-0.01782128,
-0.23008401,
-0.71395030,
-0.91184418,
-0.43675782,
-0.84132679,
-0.10041741,
-0.67764394,
-0.10676524,
-0.23581802,
-0.34497264,
-0.63052293,
-0.91082547,
-0.30702474,
-0.60890118,
-0.97243789,
-0.07262210,
-0.70762561,
-0.95691440,
-0.34411821,
-0.77346575,
-0.72272747,
-0.97910794,
-0.66291127,
-0.22500044,
-0.36459627,
-0.60756670,
-0.31259928,
-0.13595255,
-0.63751610,
-0.45425907,
-0.20698156,
-0.11675862,
-0.77114095,
-0.84658204,
-0.85464792,
-0.28758021,
-0.81963251,
-0.07265798,
-0.64890124,
-0.35344265,
-0.38513162,
-0.52876568,
-0.47252440,
-0.69585492,
-0.58555759,
-0.77827769,
-0.12201202,
-0.36762288,
-0.55800257,
-0.71200633,
-0.61606370,
-0.87433691,
-0.66785801,
-0.80556050,
-0.82147147,
-0.01612694,
-0.28862080,
-0.75571320,
-0.84207744,
-0.60362022,
-0.46187716,
-0.96002011,
-0.45416210,
-0.36916603,
-0.15694656,
-0.29799312,
-0.81303916,
-0.28081537,
-0.27029481,
-0.34789697,
-0.96096819,
-0.44811240,
-0.98712509,
-0.12144237,
-0.37350189,
-0.89835017,
-0.86308214,
-0.28473272,
-0.87649373,
-0.27546298,
-0.74025309,
-0.20544414,
-0.48463160,
-0.21016454,
-0.42732058,
-0.32156145,
-0.14519239,
-0.22507475,
-0.99458824,
-0.59872246,
-0.03382509,
-0.36228003,
-0.29424543,
-0.20132580,
-0.56292073,
-0.88015596,
-0.22089669,
-0.76440833,
-0.76993864,
-0.93105591,
-0.18802433,
-0.52060441,
-0.73791472,
-0.67287639,
-0.90758897,
-0.59620331,
-0.58966121,
-0.75186886,
-0.17405379,
-0.36041366,
-0.54048921,
-0.22488227,
-0.62112211,
-0.59589083,
-0.09452012,
-0.06484098,
-0.53616114,
-0.24493618,
-0.07801424,
-0.79846929,
-0.32875054,
-0.12240842,
-0.84498005,
-0.33194817,
-0.37863563,
-0.57699313,
-0.58618847,
-0.58807646,
-0.95324841,
-0.55419694,
-0.71177493,
-0.33711340,
-0.90315767,
-0.35632504,
-0.45529838,
-0.87356229,
-0.48814528,
-0.04216515,
-0.95870637,
-0.64212171,
-0.26219910,
-0.69213492,
-0.94821936,
-0.20061413,
-0.20706546,
-0.18431285,
-0.35567393,
-0.13858896,
-0.78349039,
-0.51801857,
-0.67108968,
-0.16136466,
-0.48436532,
-0.29177392,
-0.51521489,
-0.76476254,
-0.34300137,
-0.95827472,
-0.30891152,
-0.31741944,
-0.68852921,
-0.86537612,
-0.22410791,
-0.91943680,
-0.72266516,
-0.07637401,
-0.52839562,
-0.81583245,
-0.46317061,
-0.67018934,
-0.49485683,
-0.57021960,
-0.34959115,
-0.33714045,
-0.75477046,
-0.86715808,
-0.07960139,
-0.21605446,
-0.14132891,
-0.24555932,
-0.95096528,
-0.39126294,
-0.52694196,
-0.61959987,
-0.07451739,
-0.81801978,
-0.08141283,
-0.39497675,
-0.85925643,
-0.88630874,
-0.26097923,
-0.80702157,
-0.22857751,
-0.61378505,
-0.85629248,
-0.07062892,
-0.42052622,
-0.66239002,
-0.75229296,
-0.68259757,
-0.37511439,
-0.55441225,
-0.92570575,
-0.08357175,
-0.34817274,
-0.63018871,
-0.16654451,
-0.89988483,
-0.69387630,
-0.39565019,
-0.19810918,
-0.83455363,
-0.16026140,
-0.22553008,
-0.73295883,
-0.30349021,
-0.18118314,
-0.34364509,
-0.69000674,
-0.36084887,
-0.51755567,
-0.55465367,
-0.31398781,
-0.75368952,
-0.53108630,
-0.27886746,
-0.17949907,
-0.11841888,
-0.48138006,
-0.37019279,
-0.71272631,
-0.10155899,
-0.03362667,
-0.49342522,
-0.95014686,
-0.39959596,
-0.01408289,
-0.75270710,
-0.83397375,
-0.13896739,
-0.48877556,
-0.48127504,
-0.31230975,
-0.67579954,
-0.61197532,
-0.08835477,
-0.19497842,
-0.56653956,
-0.29909960,
-0.31558923,
-0.36100901,
-0.16066999,
-0.28742458,
-0.53624786,
-0.51598151,
-0.23475008,
-0.42159041,
-0.44858350,
-0.84733472,
-0.75228420,
-0.61737821,
-0.24552296,
-0.87052425,
-0.16527119,
-0.48221565,
-0.54999016,
-0.24494642,
-0.72971093,
-0.98106121,
-0.27380644,
-0.31196267,
-0.30074234,
-0.44040282,
-0.23160639,
-0.68110859,
-0.26017511,
-0.60994279,
-0.58221223,
-0.00396748,
-0.37759690,
-0.97079916,
-0.68294069,
-0.55073596,
-0.79364213,
-0.45898144,
-0.59469236,
-0.86227421,
-0.06051935,
-0.47053697,
-0.01009167,
-0.05412036,
-0.17432214,
-0.17678489,
-0.81252129,
-0.32102867,
-0.98456675,
-0.41759350,
-0.45585735,
-0.82220887,
-0.67156648,
-0.92202042,
-0.55557245,
-0.21932544,
-0.46608766,
-0.71523635,
-0.07212065,
-0.21781405,
-0.44165914,
-0.25819902,
-0.64637159,
-0.96362123,
-0.00586923,
-0.25982728,
-0.94979654,
-0.42672829,
-0.59894825,
-0.99696895,
-0.20070911,
-0.20719167,
-0.74530765,
-0.13474044,
-0.19299941,
-0.51875360,
-0.53069855,
-0.25760228,
-0.08921056,
-0.18845683,
-0.70859934,
-0.59706136,
-0.73102991,
-0.43124762,
-0.17169383,
-0.05943182,
-0.63927591,
-0.15707915,
-0.44589347,
-0.06940793,
-0.03414625,
-0.72430570,
-0.51006214,
-0.79224393,
-0.70178410,
-0.56287285,
-0.44936019,
-0.53812869,
-0.99511250,
-0.24589770,
-0.12395872,
-0.15092546,
-0.81991488,
-0.19083476,
-0.02333317,
-0.52397964,
-0.16643087,
-0.75220663,
-0.56536960,
-0.67026966,
-0.79240910,
-0.06000029,
-0.39263001,
-0.46274452,
-0.43961443,
-0.76694896,
-0.49216836,
-0.35222807,
-0.91920846,
-0.60525412,
-0.53155980,
-0.32219482,
-0.31943677,
-0.09612956,
-0.46131893,
-0.80291500,
-0.33730153,
-0.86146268,
-0.96817167,
-0.15966991,
-0.75149255,
-0.17472652,
-0.14379847,
-0.88029567,
-0.04879571,
-0.93453950,
-0.44215892,
-0.91513507,
-0.56160842,
-0.37745829,
-0.61859670,
-0.23560939,
-0.85426602,
-0.89152948,
-0.54079853,
-0.55221656,
-0.96120458,
-0.93530500,
-0.52699511,
-0.10879146,
-0.18414098,
-0.27676304,
-0.52464182,
-0.41129852,
-0.17026528,
-0.56977646,
-0.01018699,
-0.33893623,
-0.32712590,
-0.88964841,
-0.37318171,
-0.66930550,
-0.33621007,
-0.38682876,
-0.78075390,
-0.90395579,
-0.96653798,
-0.75658307,
-0.82113860,
-0.67337147,
-0.20828846,
-0.63686152,
-0.05942198,
-0.80361729,
-0.98258707,
-0.73932098,
-0.93857030,
-0.92935225,
-0.49803976,
-0.19126366,
-0.01657523,
-0.38896561,
-0.72526234,
-0.49876229,
-0.67686663,
-0.99493886,
-0.87333740,
-0.97329088,
-0.45763437,
-0.75868066,
-0.06354433,
-0.98615454,
-0.48489376,
-0.81859282,
-0.98783967,
-0.37210916,
-0.47559731,
-0.55473802,
-0.76840619,
-0.89149468,
-0.28890573,
-0.04737516,
-0.17302136,
-0.35561074,
-0.85287498,
-0.92070498,
-0.33870938,
-0.34839628,
-0.40632827,
-0.27056025,
-0.89832141,
-0.63327761,
-0.45520702,
-0.41510951,
-0.04123155,
-0.25473863,
-0.54040043,
-0.07463385,
-0.07106151,
-0.47876480,
-0.95405316,
-0.81923552,
-0.36801304,
-0.08356742,
-0.84774942,
-0.64661136,
-0.14713598,
-0.56439400,
-0.39657675,
-0.14866636,
-0.10488976,
-0.22393892,
-0.55151829,
-0.10340395,
-0.76865642,
-0.21974133,
-0.37439814,
-0.60282639,
-0.92515106,
-0.61576321,
-0.61719907,
-0.58847884,
-0.79523775,
-0.17934061,
-0.33859247,
-0.16313634,
-0.66844354,
-0.96289552,
-0.60993534,
-0.20874344,
-0.57747226,
-0.92870291,
-0.08799093,
-0.18955871,
-0.45352443,
-0.85890074,
-0.76126253,
-0.85178386,
-0.46816261,
-0.00531089,
-0.38342496,
-0.56214745,
-0.69980915,
-0.66018034,
-0.85582664,
-0.84035850,
-0.40534330,
-0.52211618,
-0.72556593,
-0.85290141,
-0.87779119,
-0.82642584,
-0.91401736,
-0.74180692,
-0.98319590,
-0.29557315,
-0.80923994,
-0.94213500,
-0.63399907,
-0.73492320,
-0.47000508,
-0.67384350,
-0.06435180,
-0.48120681,
-0.32028418,
-0.86947680,
-0.66953910,
-0.58488204,
-0.54997920,
-0.14876067,
-0.20659472,
-0.27463968,
-0.53558164,
-0.09081905,
-0.90717491,
-0.93539479,
-0.18096036,
-0.53625322,
-0.31925129,
-0.43325839,
-0.88328397,
-0.85439038,
-0.82160912,
-0.53961159,
-0.66482033,
-0.56553912,
-0.35784562,
-0.54468990,
-0.03251595,
-0.54620306,
-0.08373892,
-0.84103018,
-0.51771171,
-0.08493793,
-0.72414737,
-0.95654297,
-0.22815383,
-0.46329771,
-0.31466440,
-0.38599181,
-0.48063526,
-0.78157806,
-0.35735672,
-0.11605589,
-0.57586516,
-0.14051902,
-0.48444266,
-0.86060664,
-0.64390478,
-0.58931397,
-0.64366423,
-0.97201115,
-0.85160984,
-0.24027737,
-0.10392154,
-0.92242008,
-0.64967293,
-0.22964183,
-0.45214919,
-0.58106005,
-0.88154115,
-0.68573307,
-0.26626042,
-0.46603777,
-0.22654112,
-0.41573486,
-0.87377226,
-0.35293750,
-0.97458523,
-0.06220378,
-0.76138900,
-0.13803435,
-0.42895212,
-0.68488378,
-0.32318111,
-0.63148123,
-0.71431217,
-0.77434641,
-0.94290210,
-0.92642120,
-0.54071978,
-0.07092370,
-0.08141877,
-0.18846826,
-0.76965489,
-0.69947878,
-0.68438386,
-0.94405358,
-0.71259311,
-0.21864255,
-0.13155566,
-0.96412525,
-0.85369407,
-0.36967141,
-0.40997895,
-0.87787937,
-0.19198043,
-0.69327300,
-0.34973665,
-0.18995279,
-0.10607557,
-0.84602198,
-0.66960962,
-0.55985787,
-0.24858310,
-0.44049821,
-0.09208983,
-0.09010892,
-0.65997880,
-0.79555705,
-0.20341974,
-0.27971682,
-0.12798674,
-0.33658002,
-0.42830361,
-0.63102987,
-0.49623096,
-0.44192224,
-0.87329596,
-0.38768081,
-0.46258641,
-0.87559680,
-0.57252820,
-0.64526100,
-0.23491982,
-0.84457754,
-0.24593473,
-0.07157064,
-0.15172687,
-0.56095427,
-0.24677617,
-0.87208800,
-0.48178947,
-0.30838659,
-0.26029571,
-0.48648901,
-0.17793049,
-0.57249816,
-0.27663442,
-0.13412432,
-0.63158902,
-0.08134537,
-0.40137420,
-0.46955279,
-0.26513622,
-0.77886706,
-0.27418154,
-0.56321959,
-0.69576280,
-0.88512171,
-0.15890503,
-0.67309746,
-0.03463986,
-0.89115097,
-0.63202487,
-0.24559731,
-0.54506862,
-0.12848106,
-0.45061517,
-0.57777691,
-0.93752088,
-0.22984356,
-0.78782647,
-0.64397186,
-0.97544970,
-0.66644428,
-0.25797102,
-0.05201699,
-0.27722054,
-0.57399816,
-0.71950921,
-0.03922600,
-0.59974289,
-0.88665280,
-0.21061253,
-0.79275072,
-0.44712956,
-0.50026971,
-0.30203569,
-0.28586691,
-0.83969207,
-0.40332821,
-0.09361405,
-0.72944256,
-0.14067765,
-0.10537493,
-0.26176094,
-0.99731700,
-0.81501731,
-0.65643553,
-0.25406402,
-0.68554207,
-0.46672270,
-0.92857297,
-0.09104801,
-0.45693081,
-0.78802404,
-0.10254133,
-0.07233601,
-0.31196780,
-0.39443324,
-0.60389689,
-0.08335933,
-0.13945940,
-0.44045059,
-0.83022334,
-0.96365726,
-0.98728515,
-0.63249238,
-0.97292017,
-0.89737312,
-0.73229988,
-0.88644386,
-0.97750604,
-0.25271871,
-0.64086266,
-0.64658933,
-0.67781735,
-0.17117877,
-0.46791019,
-0.86880411,
-0.52150718,
-0.23766177,
-0.12759089,
-0.26469650,
-0.62267364,
-0.60015632,
-0.36377251,
-0.58561388,
-0.54824835,
-0.65967189,
-0.94910503,
-0.68563636,
-0.61278065,
-0.42665254,
-0.96736479,
-0.34844580,
-0.34910329,
-0.56119848,
-0.67293081,
-0.66745847,
-0.78533697,
-0.93151005,
-0.56167968,
-0.14280891,
-0.11231113,
-0.46642966,
-0.18229128,
-0.96363769,
-0.26439572,
-0.34367804,
-0.58840754,
-0.84554265,
-0.18373755,
-0.97633283,
-0.87716619,
-0.40539718,
-0.52711433,
-0.08043328,
-0.11499925,
-0.54915377,
-0.13341771,
-0.73069330,
-0.00373860,
-0.07235648,
-0.02235386,
-0.68479620,
-0.71184582,
-0.73755309,
-0.38616454,
-0.89685661,
-0.94095569,
-0.81136741,
-0.77844226,
-0.25300597,
-0.16940882,
-0.16864065,
-0.92718552,
-0.43664003,
-0.97095138,
-0.87759654,
-0.96998902,
-0.86284214,
-0.69291490,
-0.08296692,
-0.77840729,
-0.78054860,
-0.46163200,
-0.47784697,
-0.64518767,
-0.27819641,
-0.21377271,
-0.47849444,
-0.69487703,
-0.12592510,
-0.63223325,
-0.88178123,
-0.83989254,
-0.98514425,
-0.38646732,
-0.22654332,
-0.23647968,
-0.75357492,
-0.94836927,
-0.27319893,
-0.67313694,
-0.59488535,
-0.03148503,
-0.40830626,
-0.81967414,
-0.86643324,
-0.71700611,
-0.44191330,
-0.56390670,
-0.39720338,
-0.05335222,
-0.27297532,
-0.19232857,
-0.03160993,
-0.70887861,
-0.63720652,
-0.20668572,
-0.79865878,
-0.02622924,
-0.66566239,
-0.97894637,
-0.75347329,
-0.91965207,
-0.37848354,
-0.15548681,
-0.41576419,
-0.57140062,
-0.54898916,
-0.57868096,
-0.13678607,
-0.43780973,
-0.90620986,
-0.96491727,
-0.71440668,
-0.33882040,
-0.76574969,
-0.05803820,
-0.92617793,
-0.85874261,
-0.27025804,
-0.57482226,
-0.36675204,
-0.93660231,
-0.57672948,
-0.00441861,
-0.79222440,
-0.69471588,
-0.93552307,
-0.24003708,
-0.22141729,
-0.14342434,
-0.23899154,
-0.98153238,
-0.26843422,
-0.52784462,
-0.09077777,
-0.15983630,
-0.52085722,
-0.93440942,
-0.04671906,
-0.34963104,
-0.86567150,
-0.68371241,
-0.31165339,
-0.20936147,
-0.21853660,
-0.40784625,
-0.26441191,
-0.09232374,
-0.97442146,
-0.00324112,
-0.24439342,
-0.89165475,
-0.43212264,
-0.73045884,
-0.37301963,
-0.59830769,
-0.79535671,
-0.71126805,
-0.49701979,
-0.88447512,
-0.01680698,
-0.38622804,
-0.89764966,
-0.92051154,
-0.61424093,
-0.06982857,
-0.83510125,
-0.52009573,
-0.10709413,
-0.74751023,
-0.62466849,
-0.92812099,
-0.04269696,
-0.86646203,
-0.18665378,
-0.37357911,
-0.14622479,
-0.48845316,
-0.41106529,
-0.73313429,
-0.35040168,
-0.33433828,
-0.01068813,
-0.13839512,
-0.65894196,
-0.29338742,
-0.30739689,
-0.22771398,
-0.32205545,
-0.32758528,
-0.54241463,
-0.77907234,
-0.86976065,
-0.95692937,
-0.92346834,
-0.62733295,
-0.00439960,
-0.61704872,
-0.90235076,
-0.07240732,
-0.85603805,
-0.42309447,
-0.17979342,
-0.30223092,
-0.25893539,
-0.80732863,
-0.50225730,
-0.11540590,
-0.44567467,
-0.48481910,
-0.64262901,
-0.90890791,
-0.72114315,
-0.30813484,
-0.83811557,
-0.68877375,
-0.78893529,
-0.14188334,
-0.41210264,
-0.43856662,
-0.69538081,
-0.96211343,
-0.30419088,
-0.07190456,
-0.69293430,
-0.31466225,
-0.74658008,
-0.78467721,
-0.26486660,
-0.75888570,
-0.09850454,
-0.52946599,
-0.22861016,
-0.50766130,
-0.93172117,
-0.96312035,
-0.08058012,
-0.61624751,
-0.55032692,
-0.01130600,
-0.96560910,
-0.46038591,
-0.71062856,
-0.49274490,
-0.55628382,
-0.15076293,
-0.80133912,
-0.18799514,
-0.51468450,
-0.05613903,
-0.56686063,
-0.12514323,
-0.70995749,
-0.13769727,
-0.72358069,
-0.30358937,
-0.84814562,
-0.95181979,
-0.27153165,
-0.04408869,
-0.54554438,
-0.43316892,
-0.69840934,
-0.16258032,
-0.44823447,
-0.31161985,
-0.71469600,
-0.87305840,
-0.69083143,
-0.65727545,
-0.85201063,
-0.55309987,
-0.45868427,
-0.16363527,
-0.64121986,
-0.24502550,
-0.55434109,
-0.63169989,
-0.47391441,
-0.84320871,
-0.59219846,
-0.67981390,
-0.43634518,
-0.38606398,
-0.40100533,
-0.82062152,
-0.59266035,
-0.60586515,
-0.35127510,
-0.11906577,
-0.16502085,
-0.93113606,
-0.04334334,
-0.32418872,
-0.51963586,
-0.67038241,
@@ -0,0 +1,206 @@
+#include "block.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#if defined _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// bytes of bin indices [0, n) of 'width' bits
+static unsigned long long get_x_bin_bytes(size_t n, size_t width)
+{
+    return ((unsigned long long)n * width + 7) / 8;
+}
+
+#if defined _WIN32
+XBinFile::XBinFile() : file_(INVALID_HANDLE_VALUE), size_(0), block_size_(8) {}
+
+int XBinFile::open(
+    const char * filename,
+    size_t size,
+    const std::vector<size_t>& widths,
+    const std::vector<unsigned long long>& offsets)
+{
+    close();
+    file_ = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+    if (file_ == INVALID_HANDLE_VALUE)
+    {
+        fprintf(stderr, "open \"%s\" failed\n", filename);
+        return -1;
+    }
+    filename_ = filename;
+    size_ = size;
+    widths_ = widths;
+    offsets_ = offsets;
+    return 0;
+}
+
+void XBinFile::close()
+{
+    if (file_ != INVALID_HANDLE_VALUE)
+        CloseHandle(file_);
+    file_ = INVALID_HANDLE_VALUE;
+}
+
+// read 'size' bytes at 'offset' of 'file', return -1 if failed
+static int read_at(void * file, void * data, size_t size, unsigned long long offset)
+{
+    char * p = (char *)data;
+    while (size != 0)
+    {
+        OVERLAPPED overlapped;
+        memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset = (DWORD)offset;
+        overlapped.OffsetHigh = (DWORD)(offset >> 32);
+        DWORD to_read = (DWORD)std::min(size, (size_t)1 << 30);
+        DWORD read = 0;
+        if (!ReadFile(file, p, to_read, &read, &overlapped) || read == 0)
+            return -1;
+        p += read;
+        size -= read;
+        offset += read;
+    }
+    return 0;
+}
+#else
+XBinFile::XBinFile() : fd_(-1), size_(0), block_size_(8) {}
+
+int XBinFile::open(
+    const char * filename,
+    size_t size,
+    const std::vector<size_t>& widths,
+    const std::vector<unsigned long long>& offsets)
+{
+    close();
+    fd_ = ::open(filename, O_RDONLY);
+    if (fd_ == -1)
+    {
+        fprintf(stderr, "open \"%s\" failed: %s\n", filename, strerror(errno));
+        return -1;
+    }
+    filename_ = filename;
+    size_ = size;
+    widths_ = widths;
+    offsets_ = offsets;
+    return 0;
+}
+
+void XBinFile::close()
+{
+    if (fd_ != -1)
+        ::close(fd_);
+    fd_ = -1;
+}
+
+// read 'size' bytes at 'offset' of 'fd', return -1 if failed
+static int read_at(int fd, void * data, size_t size, unsigned long long offset)
+{
+    char * p = (char *)data;
+    while (size != 0)
+    {
+        ssize_t read = pread(fd, p, size, (off_t)offset);
+        if (read == -1 && errno == EINTR)
+            continue;
+        if (read <= 0)
+            return -1;
+        p += read;
+        size -= (size_t)read;
+        offset += (unsigned long long)read;
+    }
+    return 0;
+}
+#endif
+
+XBinFile::~XBinFile()
+{
+    close();
+}
+
+size_t XBinFile::get_bytes(size_t n) const
+{
+    size_t bytes = 0;
+    for (size_t i=0, s=widths_.size(); i<s; i++)
+        bytes += (size_t)get_x_bin_bytes(n, widths_[i]);
+    return bytes;
+}
+
+void XBinFile::set_block_size(size_t block_size)
+{
+    block_size_ = std::max(block_size / 8 * 8, (size_t)8);
+}
+
+void XBinFile::read(size_t i, XBinBlock * block) const
+{
+    assert(i < get_block_count());
+    size_t begin = i * block_size_;
+    size_t end = std::min(begin + block_size_, size_);
+    block->begin_ = begin;
+    block->end_ = end;
+    block->widths_ = &widths_;
+    block->offsets_.resize(widths_.size());
+
+    // 'begin' is a multiple of 8, bin indices of a block start at a byte
+    size_t bytes = 0;
+    for (size_t x_index=0, s=widths_.size(); x_index<s; x_index++)
+    {
+        block->offsets_[x_index] = bytes;
+        bytes += (size_t)(get_x_bin_bytes(end, widths_[x_index]) - begin * widths_[x_index] / 8);
+    }
+    block->data_.resize(bytes);
+
+    for (size_t x_index=0, s=widths_.size(); x_index<s; x_index++)
+    {
+        unsigned long long offset = offsets_[x_index] + begin * widths_[x_index] / 8;
+        size_t size = (x_index + 1 < s ? block->offsets_[x_index+1] : bytes) - block->offsets_[x_index];
+#if defined _WIN32
+        int error = read_at(file_, &block->data_[block->offsets_[x_index]], size, offset);
+#else
+        int error = read_at(fd_, &block->data_[block->offsets_[x_index]], size, offset);
+#endif
+        if (error == -1)
+        {
+            fprintf(stderr, "read x bins of samples [%lu, %lu) from \"%s\" failed\n",
+                (unsigned long)begin, (unsigned long)end, filename_.c_str());
+            exit(2);
+        }
+    }
+}
+
+XBinBlockReader::XBinBlockReader(const XBinFile& file)
+    : file_(file), next_(0)
+{
+    if (file_.get_block_count() != 0)
+        prefetch(0);
+}
+
+XBinBlockReader::~XBinBlockReader()
+{
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void XBinBlockReader::prefetch(size_t i)
+{
+    assert(!thread_.joinable());
+    thread_ = std::thread(&XBinFile::read, &file_, i, &blocks_[i & 1]);
+}
+
+const XBinBlock * XBinBlockReader::next()
+{
+    if (next_ == file_.get_block_count())
+        return 0;
+
+    thread_.join();
+    // the other block was returned last time, it is overwritten by the next one
+    size_t i = next_++;
+    if (next_ != file_.get_block_count())
+        prefetch(next_);
+    return &blocks_[i & 1];
+}
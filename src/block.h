@@ -0,0 +1,137 @@
+#ifndef GBDT_BLOCK_H
+#define GBDT_BLOCK_H
+
+#include "sample.h"
+#include <stddef.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// bin indices of samples [begin, end) of all features, read from a XBinFile
+class XBinBlock
+{
+private:
+    size_t begin_;
+    size_t end_;
+    // widths of bin indices of features
+    const std::vector<size_t> * widths_;
+    // bin indices of the ith feature start from data_[offsets_[i]]
+    std::vector<size_t> offsets_;
+    std::vector<unsigned char> data_;
+
+    friend class XBinFile;
+
+public:
+    XBinBlock() : begin_(0), end_(0), widths_(0) {}
+
+    size_t begin() const {return begin_;}
+    size_t end() const {return end_;}
+    size_t size() const {return end_ - begin_;}
+    size_t width(size_t x_index) const {return (*widths_)[x_index];}
+    // the bin index of the ith sample is read from 'data(x_index)' at 'i - begin()'
+    const unsigned char * data(size_t x_index) const {return &data_[offsets_[x_index]];}
+
+    // bin index of the ith feature of the jth sample, j in [begin, end)
+    XBin get(size_t x_index, size_t j) const
+    {
+        size_t width = (*widths_)[x_index];
+        const unsigned char * x_bins = &data_[offsets_[x_index]];
+        if (width == 4)
+            return XBinReader<4>::get(x_bins, j - begin_);
+        else if (width == 8)
+            return XBinReader<8>::get(x_bins, j - begin_);
+        else
+            return XBinReader<16>::get(x_bins, j - begin_);
+    }
+};
+
+// the jth sample of a block, it has x bins like XY
+class XBinBlockRow
+{
+private:
+    const XBinBlock& block_;
+    size_t j_;
+
+public:
+    XBinBlockRow(const XBinBlock& block, size_t j) : block_(block), j_(j) {}
+
+    XBin x_bin(size_t i) const {return block_.get(i, j_);}
+};
+
+// X bins of binary training samples left in the file, see "load_binary",
+// they are read in blocks of samples for out-of-core training.
+// Bin indices of a feature are stored together in the file,
+// a block reads a range of them for every feature.
+class XBinFile
+{
+private:
+#if defined _WIN32
+    void * file_;
+#else
+    int fd_;
+#endif
+    std::string filename_;
+    // number of samples
+    size_t size_;
+    std::vector<size_t> widths_;
+    // bin indices of the ith feature start from offsets_[i] of the file
+    std::vector<unsigned long long> offsets_;
+    // number of samples of a block, a multiple of 8, so that blocks start at bytes
+    size_t block_size_;
+
+    XBinFile(const XBinFile&);
+    XBinFile& operator=(const XBinFile&);
+
+public:
+    XBinFile();
+    ~XBinFile();
+
+    // return -1 if failed
+    int open(
+        const char * filename,
+        size_t size,
+        const std::vector<size_t>& widths,
+        const std::vector<unsigned long long>& offsets);
+    void close();
+
+    size_t size() const {return size_;}
+    size_t get_x_type_size() const {return widths_.size();}
+    // bytes of bin indices of 'n' samples of all features
+    size_t get_bytes(size_t n) const;
+    size_t block_size() const {return block_size_;}
+    // 'block_size' is rounded down to a multiple of 8, at least 8
+    void set_block_size(size_t block_size);
+    size_t get_block_count() const {return (size_ + block_size_ - 1) / block_size_;}
+
+    // read the ith block, exit if failed
+    void read(size_t i, XBinBlock * block) const;
+};
+
+// Blocks of a XBinFile read one by one from the beginning to the end.
+// The next block is read by another thread while the current one is used,
+// so only two blocks are in memory.
+class XBinBlockReader
+{
+private:
+    const XBinFile& file_;
+    // index of the block returned by the next 'next'
+    size_t next_;
+    XBinBlock blocks_[2];
+    // the thread reading the block 'next_'
+    std::thread thread_;
+
+    XBinBlockReader(const XBinBlockReader&);
+    XBinBlockReader& operator=(const XBinBlockReader&);
+
+    void prefetch(size_t i);
+
+public:
+    explicit XBinBlockReader(const XBinFile& file);
+    ~XBinBlockReader();
+
+    // Return the next block, or 0 at the end.
+    // The block returned last time is overwritten, it should not be used any more.
+    const XBinBlock * next();
+};
+
+#endif// GBDT_BLOCK_H
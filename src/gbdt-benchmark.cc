@@ -1,5 +1,6 @@
 #include "x.h"
 #include "gbdt.h"
+#include "thread.h"
 
 int main()
 {
@@ -9,6 +10,8 @@ int main()
 #else
     load_liblinear("./data/heart_scale.txt", &set);
 #endif
+    ThreadPool pool(1);
+    densify_x(&set, &pool);
 
     TreeParam param;
     param.verbose = 1;
@@ -33,10 +36,11 @@ int main()
         predictor.load_json(input);
         fclose(input);
 
+        CompoundValueVector X;
         for (size_t i=0, s=set.size(); i<s; i++)
         {
-            const XY& xy = set.get(i);
-            const CompoundValueVector& X = xy.X();
+            XY xy = set.get(i);
+            xy.get_X(&X);
             double y = xy.y();
             printf("p(y=1|x)=%lf=%lf, y=%1.0lf\n",
                 trainer.predict_logistic(X), predictor.predict_logistic(X), y);
@@ -0,0 +1,51 @@
+#include "x.h"
+#include "param.h"
+#include "sample.h"
+#include "thread.h"
+#include <string>
+
+// Load training samples like gbdt-train, and save them as binary training samples,
+// so that gbdt-train maps them with "training_sample_format = binary" instead of parsing text.
+int main(int argc, char ** argv)
+{
+    TreeParam param;
+    std::string output;
+    if (dataset_parse_tree_param(argc, argv, &param, &output) == -1)
+        return 1;
+
+    ThreadPool pool(param.threads);
+    XYSet set;
+    if (param.training_sample_format == "liblinear")
+    {
+        if (load_liblinear(param.training_sample.c_str(), &set, &pool) == -1)
+            return 2;
+    }
+    else if (param.training_sample_format == "gbdt")
+    {
+        if (load_gbdt(param.training_sample.c_str(), &set, &pool) == -1)
+            return 2;
+    }
+    else
+    {
+        fprintf(stderr, "\"training_sample_format\" should be \"liblinear\" or \"gbdt\"\n");
+        return 1;
+    }
+
+    // binary training samples are dense
+    densify_x(&set, &pool);
+
+    // x bins are built as gbdt-train does for "hist" of one worker,
+    // shards of distributed training should be built with "exact" to choose candidates from all shards.
+    size_t max_bin = 0;
+    if (param.tree_method == "hist")
+    {
+        max_bin = param.max_bin;
+        if (build_x_bins(&set, max_bin, &pool) == -1)
+            return 2;
+    }
+
+    if (save_binary(output.c_str(), set, max_bin) == -1)
+        return 2;
+    printf("saved \"%s\"\n", output.c_str());
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "x.h"
 #include "gbdt.h"
+#include "thread.h"
 
 int main(int argc, char ** argv)
 {
@@ -7,16 +8,28 @@ int main(int argc, char ** argv)
     if (gbdt_parse_tree_param(argc, argv, &param) == -1)
         return 1;
 
+    ThreadPool pool(param.threads);
     XYSet set;
     if (param.training_sample_format == "liblinear")
     {
-        if (load_liblinear(param.training_sample.c_str(), &set) == -1)
+        if (load_liblinear(param.training_sample.c_str(), &set, &pool) == -1)
+            return 2;
+    }
+    else if (param.training_sample_format == "gbdt")
+    {
+        if (load_gbdt(param.training_sample.c_str(), &set, &pool) == -1)
             return 2;
     }
     else
     {
-        if (load_gbdt(param.training_sample.c_str(), &set) == -1)
+        size_t max_bin;
+        if (load_binary(param.training_sample.c_str(), &set, &max_bin) == -1)
+            return 2;
+        if (set.has_x_bins())
+        {
+            fprintf(stderr, "binned binary training samples have no x values to predict\n");
             return 2;
+        }
     }
 
     GBDTPredictor predictor;
@@ -24,12 +37,11 @@ int main(int argc, char ** argv)
     predictor.load_json(input);
     fclose(input);
 
+    // sparse samples are predicted without making them dense
     for (size_t i=0, s=set.size(); i<s; i++)
     {
-        const XY& xy = set.get(i);
-        const CompoundValueVector& X = xy.X();
-        double y = xy.y();
-        printf("%lf should be near to %lf\n", predictor.predict(X), y);
+        XY xy = set.get(i);
+        printf("%lf should be near to %lf\n", predictor.predict(xy), xy.y());
     }
 
     return 0;
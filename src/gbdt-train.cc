@@ -1,5 +1,198 @@
 #include "x.h"
+#include "block.h"
 #include "gbdt.h"
+#include "hist.h"
+#include "net.h"
+#include "simd.h"
+#include "sketch.h"
+#include "thread.h"
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+// training samples of a worker are in 'training_sample' formatted with its rank
+static int get_shard_filename(const TreeParam& param, std::string * filename)
+{
+    if (param.workers == 1)
+    {
+        *filename = param.training_sample;
+        return 0;
+    }
+
+    const std::string& pattern = param.training_sample;
+    size_t pos = pattern.find("%d");
+    if (pos == std::string::npos || pattern.find('%', pos + 2) != std::string::npos)
+    {
+        fprintf(stderr, "\"training_sample\" should contain one \"%%d\" for shards of workers\n");
+        return -1;
+    }
+
+    char rank[32];
+    snprintf(rank, sizeof(rank), "%d", (int)param.rank);
+    *filename = pattern;
+    filename->replace(pos, 2, rank);
+    return 0;
+}
+
+// worker 0 merges sketches of x values of all workers
+static int gather_x_sketches(AllReducer * reducer, std::vector<XSketch> * sketches)
+{
+    // number of features, then sketches of every feature
+    std::vector<char> data;
+    size_t x_type_size = sketches->size();
+    data.insert(data.end(), (const char *)&x_type_size, (const char *)(&x_type_size + 1));
+    for (size_t i=0; i<x_type_size; i++)
+        (*sketches)[i].save(&data);
+
+    std::vector<std::vector<char> > all;
+    reducer->gather(data, &all);
+    for (size_t r=1, s=all.size(); r<s; r++)
+    {
+        const char * p = &all[r][0];
+        size_t _x_type_size;
+        memcpy(&_x_type_size, p, sizeof(_x_type_size));
+        p += sizeof(_x_type_size);
+        if (_x_type_size != x_type_size)
+        {
+            fprintf(stderr, "worker %d has %d features, but worker 0 has %d\n",
+                (int)r, (int)_x_type_size, (int)x_type_size);
+            return -1;
+        }
+
+        for (size_t i=0; i<x_type_size; i++)
+        {
+            XSketch sketch;
+            sketch.load(p);
+            if (sketch.x_type() != (*sketches)[i].x_type())
+            {
+                fprintf(stderr, "type of feature %d of worker %d is different from worker 0\n",
+                    (int)i, (int)r);
+                return -1;
+            }
+            (*sketches)[i].merge(sketch);
+        }
+    }
+    return 0;
+}
+
+// all workers use x values of worker 0 as split candidates
+static int broadcast_x_values(AllReducer * reducer, XYSet * set)
+{
+    // x type size, then x type, size and values of every feature
+    std::vector<char> data;
+    if (reducer->rank() == 0)
+    {
+        size_t x_type_size = set->get_x_type_size();
+        data.insert(data.end(), (const char *)&x_type_size, (const char *)(&x_type_size + 1));
+        for (size_t i=0; i<x_type_size; i++)
+        {
+            kXType x_type = set->get_x_type(i);
+            const CompoundValueVector& x_values = set->get_x_values(i);
+            size_t x_values_size = x_values.size();
+            data.insert(data.end(), (const char *)&x_type, (const char *)(&x_type + 1));
+            data.insert(data.end(), (const char *)&x_values_size, (const char *)(&x_values_size + 1));
+            if (x_values_size != 0)
+                data.insert(data.end(), (const char *)&x_values[0], (const char *)(&x_values[0] + x_values_size));
+        }
+    }
+
+    reducer->broadcast(&data);
+    if (reducer->rank() == 0)
+        return 0;
+
+    const char * p = &data[0];
+    size_t x_type_size;
+    memcpy(&x_type_size, p, sizeof(x_type_size));
+    p += sizeof(x_type_size);
+    if (x_type_size != set->get_x_type_size())
+    {
+        fprintf(stderr, "worker %d has %d features, but worker 0 has %d\n",
+            (int)reducer->rank(), (int)set->get_x_type_size(), (int)x_type_size);
+        return -1;
+    }
+
+    set->x_values().resize(x_type_size);
+    for (size_t i=0; i<x_type_size; i++)
+    {
+        kXType x_type;
+        size_t x_values_size;
+        memcpy(&x_type, p, sizeof(x_type));
+        p += sizeof(x_type);
+        memcpy(&x_values_size, p, sizeof(x_values_size));
+        p += sizeof(x_values_size);
+        if (x_type != set->get_x_type(i))
+        {
+            fprintf(stderr, "type of feature %d of worker %d is different from worker 0\n",
+                (int)i, (int)reducer->rank());
+            return -1;
+        }
+
+        CompoundValueVector& x_values = set->get_x_values(i);
+        x_values.resize(x_values_size);
+        if (x_values_size != 0)
+            memcpy(&x_values[0], p, sizeof(CompoundValue) * x_values_size);
+        p += sizeof(CompoundValue) * x_values_size;
+    }
+    return 0;
+}
+
+// binary training samples should have what 'param' needs
+static int check_binary(const TreeParam& param, const XYSet& set, size_t max_bin)
+{
+    if (set.has_x_bins())
+    {
+        if (param.tree_method != "hist" || param.max_bin != max_bin || param.workers != 1)
+        {
+            fprintf(stderr, "binary training samples are binned by \"max_bin\" %d for \"hist\" of one worker, "
+                "build them with \"tree_method = exact\" for other parameters\n", (int)max_bin);
+            return -1;
+        }
+    }
+    else if (param.tree_method == "exact" && set.sorted_indices().empty())
+    {
+        fprintf(stderr, "binary training samples have no sorted indices for \"exact\"\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Out-of-core training keeps y, weights, fx and pseudo responses of samples,
+// indices of sampled ones, the node each one lies in and histograms in memory.
+// X bins are read in blocks, two of which are in memory, as large as "memory_budget" allows.
+static int set_block_size(const TreeParam& param, const XYSet& set, XBinFile * x_bin_file)
+{
+    // y, weight, fx, pseudo response and whether it is sampled of a sample,
+    // its index, pseudo response, position, partition buffer, node and side in the tree being trained,
+    // and histograms of chunks taking no more than a bin per sample, see "Histogram::build"
+    static const size_t SAMPLE_BYTES = sizeof(CompoundValue) + sizeof(double) * 3 + 1
+        + sizeof(size_t) * 5 + 1 + sizeof(HistBin);
+    // smaller blocks make too many small reads
+    static const size_t MIN_BLOCK_SIZE = 4096;
+
+    size_t bin_size = 0;
+    for (size_t i=0, s=set.get_x_type_size(); i<s; i++)
+        bin_size += set.get_x_values(i).size() + 1;
+    // histograms of nodes of a level, at most one per leaf node
+    double resident = (double)set.size() * SAMPLE_BYTES
+        + (double)bin_size * (sizeof(HistBin) * (param.max_leaf_number + 1) + sizeof(CompoundValue));
+    // bin indices, weighted response and weight of 8 samples in two blocks
+    double block_bytes = (double)(x_bin_file->get_bytes(8) + sizeof(double) * 2 * 8) * 2;
+    double budget = (double)param.memory_budget * 1024 * 1024;
+    double block_size = 8 * floor((budget - resident) / block_bytes);
+    if (block_size < (double)std::min(MIN_BLOCK_SIZE, (set.size() + 7) / 8 * 8))
+    {
+        double least = resident + block_bytes * MIN_BLOCK_SIZE / 8;
+        fprintf(stderr, "\"memory_budget\" is too small, at least %d MB is needed\n",
+            (int)ceil(least / 1024 / 1024));
+        return -1;
+    }
+
+    x_bin_file->set_block_size((size_t)std::min(block_size, (double)set.size() + 7));
+    printf("out-of-core training: %.1f MB in memory, blocks of %d samples\n",
+        (resident + block_bytes * x_bin_file->block_size() / 8) / 1024 / 1024, (int)x_bin_file->block_size());
+    return 0;
+}
 
 int main(int argc, char ** argv)
 {
@@ -7,24 +200,113 @@ int main(int argc, char ** argv)
     if (gbdt_parse_tree_param(argc, argv, &param) == -1)
         return 1;
 
+    if (param.workers > 1 && (param.tree_method != "hist" || param.gbdt_loss == "lad"))
+    {
+        fprintf(stderr, "distributed training needs \"tree_method\" to be \"hist\", "
+            "and \"gbdt_loss\" to be \"ls\" or \"logistic\"\n");
+        return 1;
+    }
+
+    if (param.memory_budget != 0
+        && (param.training_sample_format != "binary" || param.tree_method != "hist" || param.tree_growth != "levelwise"))
+    {
+        fprintf(stderr, "out-of-core training by \"memory_budget\" needs binary training samples with x bins, "
+            "\"tree_method\" to be \"hist\" and \"tree_growth\" to be \"levelwise\"\n");
+        return 1;
+    }
+
+    if (param.gbdt_sample_method == "goss" && param.goss_top_rate + param.goss_other_rate > 1.0)
+    {
+        fprintf(stderr, "\"goss_top_rate\" plus \"goss_other_rate\" should be at most 1.0\n");
+        return 1;
+    }
+
+    std::string training_sample;
+    if (get_shard_filename(param, &training_sample) == -1)
+        return 1;
+
+    AllReducer reducer;
+    if (reducer.init(param.rank, param.workers, param.master) == -1)
+        return 3;
+
+    ThreadPool pool(param.threads);
     XYSet set;
+    // x bins left on disk for out-of-core training
+    XBinFile x_bin_file;
     if (param.training_sample_format == "liblinear")
     {
-        if (load_liblinear(param.training_sample.c_str(), &set) == -1)
+        if (load_liblinear(training_sample.c_str(), &set, &pool) == -1)
+            return 2;
+    }
+    else if (param.training_sample_format == "gbdt")
+    {
+        if (load_gbdt(training_sample.c_str(), &set, &pool) == -1)
             return 2;
     }
     else
     {
-        if (load_gbdt(param.training_sample.c_str(), &set) == -1)
+        size_t max_bin;
+        if (load_binary(training_sample.c_str(), &set, &max_bin, param.memory_budget ? &x_bin_file : 0) == -1)
             return 2;
+        if (check_binary(param, set, max_bin) == -1)
+            return 1;
+        if (param.memory_budget != 0)
+        {
+            if (set.x_bin_file() == 0)
+            {
+                fprintf(stderr, "out-of-core training needs x bins, build binary training samples with \"tree_method = hist\"\n");
+                return 1;
+            }
+            if (set_block_size(param, set, &x_bin_file) == -1)
+                return 1;
+        }
+    }
+
+    // exact splitting sweeps all samples sorted by every feature, sparse ones are made dense
+    if (param.tree_method == "exact")
+        densify_x(&set, &pool);
+
+    // x bins of binary training samples may be built by gbdt-dataset
+    if (param.tree_method == "hist" && !set.has_x_bins())
+    {
+        if (param.workers == 1)
+        {
+            if (build_x_bins(&set, param.max_bin, &pool) == -1)
+                return 2;
+        }
+        else
+        {
+            // split candidates are chosen by sketches of all shards
+            std::vector<XSketch> sketches;
+            sketch_x_values(set, param.max_bin - 1, &sketches, &pool);
+            if (gather_x_sketches(&reducer, &sketches) == -1)
+                return 3;
+            if (reducer.rank() == 0)
+                get_x_values(sketches, param.max_bin - 1, &set);
+            if (broadcast_x_values(&reducer, &set) == -1)
+                return 3;
+            if (bin_x_values(&set, param.max_bin, &pool) == -1)
+                return 2;
+        }
     }
 
-    GBDTTrainer trainer(set, param);
+    // features of sparse samples rarely nonzero together are bundled
+    if (set.is_sparse())
+        bundle_x_bins(&set, param.max_conflict_rate, &pool);
+
+    if (param.tree_method == "hist")
+        printf("histogram kernels: %s\n", get_simd_name(get_simd()));
+
+    GBDTTrainer trainer(set, param, &reducer);
     trainer.train();
 
-    FILE * output = xfopen(param.model.c_str(), "w");
-    trainer.save_json(output);
-    fclose(output);
+    // only worker 0 saves the model
+    if (reducer.rank() == 0)
+    {
+        FILE * output = xfopen(param.model.c_str(), "w");
+        trainer.save_json(output);
+        fclose(output);
+    }
 
     return 0;
 }
@@ -1,21 +1,30 @@
 #include "gbdt.h"
 #include "json.h"
+#include "loss.h"
+#include "net.h"
 #include "node.h"
+#include "thread.h"
 #include <assert.h>
 #include <math.h>
 #include <algorithm>
 
-static double weighted_mean_y(const XYSet& full_set)
+static double weighted_mean_y(const XYSet& full_set, AllReducer * reducer)
 {
     double total_y  = 0.0;
     double total_weight = 0.0;
     for (size_t i=0, s=full_set.size(); i<s; i++)
     {
-        const XY& xy = full_set.get(i);
-        double weight = xy.weight();
-        total_y += xy.y() * weight;
+        double weight = full_set.get_weight(i);
+        total_y += full_set.get_y(i) * weight;
         total_weight += weight;
     }
+    if (reducer)
+    {
+        double total[2] = {total_y, total_weight};
+        reducer->sum(total, 2);
+        total_y = total[0];
+        total_weight = total[1];
+    }
     return total_y / total_weight;
 }
 
@@ -40,7 +49,7 @@ public:
         std::vector<double> * full_fx,
         double * y0) const
     {
-        *y0 = weighted_mean_y(full_set);
+        *y0 = weighted_mean_y(full_set, reducer());
         full_fx->assign(full_set.size(), *y0);
     }
 
@@ -48,25 +57,22 @@ public:
         const XYSet& full_set,
         const std::vector<double>& full_fx) const
     {
-        assert(full_set.size() == full_fx.size());
-        double loss = 0.0;
-        for (size_t i=0, s=full_set.size(); i<s; i++)
-        {
-            const XY& xy = full_set.get(i);
-            double residual = full_set.get(i).y() - full_fx[i];
-            loss += (residual * residual * xy.weight());
-        }
-        return loss;
+        return batch_total_loss<LSLossKernel>(full_set, full_fx);
+    }
+
+    virtual double update_fx_response(
+        const XYSet& full_set,
+        bool add_tree,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response) const
+    {
+        return fused_update<LSLossKernel>(full_set, add_tree, full_fx, full_response);
     }
 
 protected:
     virtual void update_response(const std::vector<double>& fx)
     {
-        assert(response_.empty());
-        const XYSetRef& xy_set = set();
-        assert(xy_set.size() == fx.size());
-        for (size_t i=0, s=fx.size(); i<s; i++)
-            response_.push_back((xy_set.get(i).y() - fx[i]));
+        batch_update_response<LSLossKernel>(fx);
     }
 
     virtual void update_predicted_y() {}
@@ -78,14 +84,6 @@ protected:
 class LADLossNode : public TreeNodeBase
 {
 private:
-    static double sign(double y)
-    {
-        if (y >= 0.0)
-            return 1.0;
-        else
-            return -1.0;
-    }
-
     // x and its weight
     struct XW
     {
@@ -126,7 +124,7 @@ private:
         std::vector<XW> xw;
         for (size_t i=0, s=full_set.size(); i<s; i++)
         {
-            const XY& xy = full_set.get(i);
+            XY xy = full_set.get(i);
             xw.push_back(XW(xy.y(), xy.weight()));
         }
         return weighted_median(&xw);
@@ -154,41 +152,36 @@ public:
         const XYSet& full_set,
         const std::vector<double>& full_fx) const
     {
-        assert(full_set.size() == full_fx.size());
-        double loss = 0.0;
-        for (size_t i=0, s=full_set.size(); i<s; i++)
-        {
-            const XY& xy = full_set.get(i);
-            double residual = full_set.get(i).y() - full_fx[i];
-            loss += fabs(residual) * xy.weight();
-        }
-        return loss;
+        return batch_total_loss<LADLossKernel>(full_set, full_fx);
+    }
+
+    virtual double update_fx_response(
+        const XYSet& full_set,
+        bool add_tree,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response) const
+    {
+        return fused_update<LADLossKernel>(full_set, add_tree, full_fx, full_response);
     }
 
 protected:
     virtual void update_response(const std::vector<double>& fx)
     {
-        assert(response_.empty());
-        const XYSetRef& xy_set = set();
-        assert(xy_set.size() == fx.size());
-        for (size_t i=0, s=fx.size(); i<s; i++)
-            response_.push_back(sign((xy_set.get(i).y() - fx[i])));
+        batch_update_response<LADLossKernel>(fx);
     }
 
     virtual void update_predicted_y()
     {
-        const XYSetRef& xy_set = set();
-        if (xy_set.size() == 0)
+        if (size() == 0)
         {
             y() = 0.0;
             return;
         }
 
         std::vector<XW> response_weight;
-        for (size_t i=0, s=xy_set.size(); i<s; i++)
+        for (size_t i=0, s=size(); i<s; i++)
         {
-            const XY& xy = xy_set.get(i);
-            response_weight.push_back(XW(response_[i], xy.weight()));
+            response_weight.push_back(XW(get_response(i), get_weight(i)));
         }
         // readjust leaf values by the weighted median values
         y() = weighted_median(&response_weight);
@@ -200,6 +193,10 @@ protected:
 /************************************************************************/
 class LogisticLossNode : public TreeNodeBase
 {
+private:
+    // exp and log by the C library, or by approximations, see "gbdt_loss_math"
+    bool exact() const {return param().gbdt_loss_math == "exact";}
+
 public:
     LogisticLossNode(const TreeParam& param, size_t level)
         : TreeNodeBase(param, level) {}
@@ -214,7 +211,7 @@ public:
     virtual void initial_fx(const XYSet& full_set,
         std::vector<double> * full_fx, double * y0) const
     {
-        double _mean_y = weighted_mean_y(full_set);
+        double _mean_y = weighted_mean_y(full_set, reducer());
         *y0 = 0.5 * log((1+_mean_y) / (1-_mean_y));
         full_fx->assign(full_set.size(), *y0);
     }
@@ -223,51 +220,59 @@ public:
         const XYSet& full_set,
         const std::vector<double>& full_fx) const
     {
-        assert(full_set.size() == full_fx.size());
-        double loss = 0.0;
-        for (size_t i=0, s=full_set.size(); i<s; i++)
-        {
-            const XY& xy = full_set.get(i);
-            loss += log(1 + exp(-2.0 * xy.y() * full_fx[i])) * xy.weight();
-        }
-        return loss;
+        if (exact())
+            return batch_total_loss<LogisticLossKernel>(full_set, full_fx);
+        return batch_total_loss<FastLogisticLossKernel>(full_set, full_fx);
+    }
+
+    virtual double update_fx_response(
+        const XYSet& full_set,
+        bool add_tree,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response) const
+    {
+        if (exact())
+            return fused_update<LogisticLossKernel>(full_set, add_tree, full_fx, full_response);
+        return fused_update<FastLogisticLossKernel>(full_set, add_tree, full_fx, full_response);
     }
 
 protected:
     virtual void update_response(const std::vector<double>& fx)
     {
-        assert(response_.empty());
-        const XYSetRef& xy_set = set();
-        assert(xy_set.size() == fx.size());
-        for (size_t i=0, s=fx.size(); i<s; i++)
-        {
-            double y = xy_set.get(i).y();
-            double response = 2.0 * y / (1.0 + exp(2 * y * fx[i]));
-            response_.push_back(response);
-        }
+        if (exact())
+            batch_update_response<LogisticLossKernel>(fx);
+        else
+            batch_update_response<FastLogisticLossKernel>(fx);
     }
 
     virtual void update_predicted_y()
     {
-        const XYSetRef& xy_set = set();
-        if (xy_set.size() == 0)
+        // a node may have no training samples in this worker but some in others
+        if (size() == 0 && !distributed())
         {
             y() = 0.0;
             return;
         }
 
         double numerator = 0.0, denominator = 0.0;
-        for (size_t i=0, s=xy_set.size(); i<s; i++)
+        for (size_t i=0, s=size(); i<s; i++)
         {
-            const XY& xy = xy_set.get(i);
-            double weight = xy.weight();
-            double response = response_[i];
+            double weight = get_weight(i);
+            double response = get_response(i);
             double abs_response = fabs(response);
 
             numerator += response * weight;
             denominator += abs_response * (2.0 - abs_response) * weight;
         }
 
+        if (distributed())
+        {
+            double sum[2] = {numerator, denominator};
+            reducer()->sum(sum, 2);
+            numerator = sum[0];
+            denominator = sum[1];
+        }
+
         if (numerator < EPS && denominator < EPS)
             y() = 0.0;
         else
@@ -287,6 +292,15 @@ double GBDTPredictor::predict(const CompoundValueVector& X) const
     return y;
 }
 
+double GBDTPredictor::predict(const XY& xy) const
+{
+    assert(!trees_.empty());
+    double y = y0_;
+    for (size_t i=0, s=trees_.size(); i<s; i++)
+        y += trees_[i]->predict(xy);
+    return y;
+}
+
 double GBDTPredictor::predict_logistic(const CompoundValueVector& X) const
 {
     return 1.0 / (1.0 + exp(-2.0 * predict(X)));
@@ -299,31 +313,40 @@ void GBDTPredictor::clear()
     trees_.clear();
 }
 
-GBDTTrainer::GBDTTrainer(const XYSet& set, const TreeParam& param)
-    : full_set_(set), param_(param), full_fx_()
+GBDTTrainer::GBDTTrainer(const XYSet& set, const TreeParam& param, AllReducer * reducer)
+    : full_set_(set), param_(param), full_fx_(), full_response_(), reducer_(reducer)
 {
+    TreeNodeBase * holder;
     if (param_.gbdt_loss == "lad")
     {
-        holder_ = new LADLossNode(param, 0);
+        holder = new LADLossNode(param, 0);
     }
     else if (param_.gbdt_loss == "logistic")
     {
-        holder_ = new LogisticLossNode(param, 0);
+        holder = new LogisticLossNode(param, 0);
     }
     else
     {
-        holder_ = new LSLossNode(param, 0);
+        holder = new LSLossNode(param, 0);
     }
+    holder->reducer() = reducer;
+    holder_ = holder;
+    pool_ = new ThreadPool(param.threads);
+    buffers_ = new TreeBuffers;
 }
 
 GBDTTrainer::~GBDTTrainer()
 {
+    delete buffers_;
+    delete pool_;
     delete holder_;
 }
 
-double GBDTTrainer::total_loss() const
+double GBDTTrainer::sum_loss(double loss) const
 {
-    return holder_->total_loss(full_set_, full_fx_);
+    if (reducer_)
+        reducer_->sum(&loss, 1);
+    return loss;
 }
 
 static void record_loss_drop(const TreeNodeBase * node,
@@ -343,8 +366,12 @@ static void record_loss_drop(const TreeNodeBase * node,
 
 void GBDTTrainer::dump_feature_importance() const
 {
-    if (param_.gbdt_sample_rate != 1.0)
+    if (param_.gbdt_sample_method == "goss")
+        printf("samples are sampled by goss, feature importance is unfair\n");
+    else if (param_.gbdt_sample_rate != 1.0)
         printf("sample rate is not 1.0, feature importance is unfair\n");
+    else if (param_.colsample_bytree != 1.0 || param_.colsample_bylevel != 1.0)
+        printf("features are sampled, feature importance is unfair\n");
 
     std::vector<double> loss_drop_vector;
     loss_drop_vector.resize(full_set_.get_x_type_size(), 0.0);
@@ -364,17 +391,25 @@ void GBDTTrainer::train()
     assert(trees_.empty());
 
     holder_->initial_fx(full_set_, &full_fx_, &y0_);
+    // pseudo responses of the first tree,
+    // those of the next trees are updated with 'full_fx_' when trees are trained
+    double loss = holder_->update_fx_response(full_set_, false, &full_fx_, &full_response_);
     if (param_.verbose)
-        printf("total_loss=%lf\n", total_loss());
+        printf("total_loss=%lf\n", sum_loss(loss));
 
     for (size_t i=0; i<param_.tree_number; i++)
     {
         printf("training tree No.%d... ", (int)i);
-        TreeNodeBase * tree = holder_->train(full_set_, param_, &full_fx_);
+        if (reducer_)
+            reducer_->reset_stat();
+        TreeNodeBase * tree = holder_->train(full_set_, param_, pool_, &full_fx_, &full_response_, i, buffers_);
         trees_.push_back(tree);
+        if (reducer_ && reducer_->size() > 1)
+            printf("communication_bytes=%lu communication_seconds=%lf ",
+                (unsigned long)reducer_->bytes(), reducer_->seconds());
         if (param_.verbose)
         {
-            double _total_loss = total_loss();
+            double _total_loss = sum_loss(tree->total_loss());
             tree->total_loss() = _total_loss;
             printf("total_loss=%lf\n", _total_loss);
         }
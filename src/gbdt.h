@@ -6,7 +6,10 @@
 #include <stdio.h>
 #include <vector>
 
+class AllReducer;
 class TreeNodeBase;
+class ThreadPool;
+struct TreeBuffers;
 
 class GBDTPredictor
 {
@@ -17,6 +20,8 @@ public:
     GBDTPredictor() {}
     virtual ~GBDTPredictor() {clear();}
     double predict(const CompoundValueVector& X) const;
+    // predict a sample of a set without copying its X, see XY
+    double predict(const XY& xy) const;
     double predict_logistic(const CompoundValueVector& X) const;
     int load_json(FILE * fp);
     void clear();
@@ -28,11 +33,18 @@ private:
     const XYSet& full_set_;
     const TreeParam& param_;
     std::vector<double> full_fx_;
+    std::vector<double> full_response_;
     const TreeNodeBase * holder_;
-    double total_loss() const;
+    ThreadPool * pool_;
+    // memory reused by every tree
+    TreeBuffers * buffers_;
+    // communication with other workers in distributed training, 0 if not distributed
+    AllReducer * reducer_;
+    // sum loss of all workers
+    double sum_loss(double loss) const;
     void dump_feature_importance() const;
 public:
-    GBDTTrainer(const XYSet& set, const TreeParam& param);
+    GBDTTrainer(const XYSet& set, const TreeParam& param, AllReducer * reducer = 0);
     virtual ~GBDTTrainer();
     void train();
     void save_json(FILE * fp) const;
@@ -0,0 +1,1251 @@
+#include "hist.h"
+#include "block.h"
+#include "simd.h"
+#include <assert.h>
+#include <stddef.h>
+#include <algorithm>
+
+void Histogram::init(const XYSetRef& set)
+{
+    assert(set.has_x_bins() && set.get_x_values_size() == set.get_x_type_size());
+    size_t x_size = set.get_x_type_size();
+    offsets_.resize(x_size + 1);
+    offsets_[0] = 0;
+    // features not used have no bins, see XYSetRef::use_x
+    for (size_t i=0; i<x_size; i++)
+        offsets_[i+1] = offsets_[i] + (set.uses_x(i) ? set.get_x_values(i).size() + 1 : 0);
+    bins_.assign(offsets_[x_size], HistBin());
+    total_ = HistBin();
+    yy_ = 0.0;
+}
+
+// weights of samples, 0 if all samples weigh 1 and they are not gathered
+static const double * get_data(const std::vector<double>& w)
+{
+    return w.empty() ? 0 : &w[0];
+}
+
+// add samples 'full_indices[0, n)' with weighted response 'wy' and weight 'w' to bins of a feature,
+// 'Reader' reads bin indices 'x_bins' of the feature.
+template <class Reader, class Weights>
+static void accumulate_bins(
+    const unsigned char * x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins)
+{
+    for (size_t i=0; i<n; i++)
+    {
+        HistBin& bin = bins[Reader::get(x_bins, full_indices[i])];
+        bin.y += wy[i];
+        bin.w += Weights::get(w, i);
+        bin.n++;
+    }
+}
+
+// Many samples of a feature are added to sub-histograms in turn, the ith one to the (i % SUB_HIST_SIZE)th,
+// so that adding samples of a bin does not wait for the last one, as it does for features of few bins.
+// Sub-histograms are added to bins in order at last, results do not depend on the instruction set.
+static const size_t SUB_HIST_SIZE = 4;
+
+// add samples [begin, n) to sub-histograms 'sub_bins', the kth of which is 'sub_bins[k * bin_size]...'
+template <class Reader, class Weights>
+static void accumulate_sub_bins(
+    const unsigned char * x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t begin,
+    size_t n,
+    HistBin * sub_bins,
+    size_t bin_size)
+{
+    for (size_t i=begin; i<n; i++)
+    {
+        HistBin& bin = sub_bins[i % SUB_HIST_SIZE * bin_size + Reader::get(x_bins, full_indices[i])];
+        bin.y += wy[i];
+        bin.w += Weights::get(w, i);
+        bin.n++;
+    }
+}
+
+#if defined GBDT_SIMD_X86
+// weighted response and weight of a sample are added to a bin together
+static_assert(offsetof(HistBin, w) == offsetof(HistBin, y) + sizeof(double), "y and w of HistBin are adjacent");
+
+GBDT_TARGET("avx2") static inline void add_to_bin(HistBin * bin, __m128d yw)
+{
+    _mm_storeu_pd(&bin->y, _mm_add_pd(_mm_loadu_pd(&bin->y), yw));
+    bin->n++;
+}
+
+// weights of 4 samples from the ith
+GBDT_TARGET("avx2") static inline __m256d load_weights4(const SampleWeights *, const double * w, size_t i)
+{
+    return _mm256_loadu_pd(w + i);
+}
+
+GBDT_TARGET("avx2") static inline __m256d load_weights4(const UnitWeights *, const double *, size_t)
+{
+    return _mm256_set1_pd(1.0);
+}
+
+// Add samples [0, n) to sub-histograms like "accumulate_sub_bins", 4 samples per iteration.
+// Bin indices are read one by one, gathering them is no faster,
+// weighted response and weight of samples are paired and added to bins by one instruction.
+// Return the number of samples added, the rest are left to "accumulate_sub_bins".
+template <class Reader, class Weights>
+GBDT_TARGET("avx2") static size_t accumulate_sub_bins_avx2(
+    const unsigned char * x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * sub_bins,
+    size_t bin_size)
+{
+    HistBin * sub0 = sub_bins;
+    HistBin * sub1 = sub0 + bin_size;
+    HistBin * sub2 = sub1 + bin_size;
+    HistBin * sub3 = sub2 + bin_size;
+    size_t i = 0;
+    for (; i+4<=n; i+=4)
+    {
+        __m256d y = _mm256_loadu_pd(wy + i);
+        __m256d _w = load_weights4((const Weights *)0, w, i);
+        // (y0, w0, y2, w2) and (y1, w1, y3, w3)
+        __m256d even = _mm256_unpacklo_pd(y, _w);
+        __m256d odd = _mm256_unpackhi_pd(y, _w);
+        add_to_bin(sub0 + Reader::get(x_bins, full_indices[i]), _mm256_castpd256_pd128(even));
+        add_to_bin(sub1 + Reader::get(x_bins, full_indices[i+1]), _mm256_castpd256_pd128(odd));
+        add_to_bin(sub2 + Reader::get(x_bins, full_indices[i+2]), _mm256_extractf128_pd(even, 1));
+        add_to_bin(sub3 + Reader::get(x_bins, full_indices[i+3]), _mm256_extractf128_pd(odd, 1));
+    }
+    return i;
+}
+
+#if defined GBDT_SIMD_AVX512
+// weights of 8 samples from the ith
+GBDT_TARGET("avx512f") static inline __m512d load_weights8(const SampleWeights *, const double * w, size_t i)
+{
+    return _mm512_loadu_pd(w + i);
+}
+
+GBDT_TARGET("avx512f") static inline __m512d load_weights8(const UnitWeights *, const double *, size_t)
+{
+    return _mm512_set1_pd(1.0);
+}
+
+// Masked forms of instructions selecting all lanes are the same as plain ones,
+// intrinsics of which make GCC 12 warn about uninitialized variables.
+GBDT_TARGET("avx512f") static inline __m512d unpacklo8(__m512d a, __m512d b)
+{
+    return _mm512_mask_unpacklo_pd(a, (__mmask8)-1, a, b);
+}
+
+GBDT_TARGET("avx512f") static inline __m512d unpackhi8(__m512d a, __m512d b)
+{
+    return _mm512_mask_unpackhi_pd(a, (__mmask8)-1, a, b);
+}
+
+GBDT_TARGET("avx512f") static inline __m256d lower_half(__m512d a)
+{
+    return _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), (__mmask8)-1, a, 0);
+}
+
+GBDT_TARGET("avx512f") static inline __m256d upper_half(__m512d a)
+{
+    return _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), (__mmask8)-1, a, 1);
+}
+
+// like "accumulate_sub_bins_avx2", 8 samples per iteration
+template <class Reader, class Weights>
+GBDT_TARGET("avx512f") static size_t accumulate_sub_bins_avx512(
+    const unsigned char * x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * sub_bins,
+    size_t bin_size)
+{
+    HistBin * sub0 = sub_bins;
+    HistBin * sub1 = sub0 + bin_size;
+    HistBin * sub2 = sub1 + bin_size;
+    HistBin * sub3 = sub2 + bin_size;
+    size_t i = 0;
+    for (; i+8<=n; i+=8)
+    {
+        __m512d y = _mm512_loadu_pd(wy + i);
+        __m512d _w = load_weights8((const Weights *)0, w, i);
+        // (y0, w0, y2, w2, y4, w4, y6, w6) and (y1, w1, y3, w3, y5, w5, y7, w7)
+        __m512d even = unpacklo8(y, _w);
+        __m512d odd = unpackhi8(y, _w);
+        __m256d even0 = lower_half(even);
+        __m256d odd0 = lower_half(odd);
+        __m256d even1 = upper_half(even);
+        __m256d odd1 = upper_half(odd);
+        add_to_bin(sub0 + Reader::get(x_bins, full_indices[i]), _mm256_castpd256_pd128(even0));
+        add_to_bin(sub1 + Reader::get(x_bins, full_indices[i+1]), _mm256_castpd256_pd128(odd0));
+        add_to_bin(sub2 + Reader::get(x_bins, full_indices[i+2]), _mm256_extractf128_pd(even0, 1));
+        add_to_bin(sub3 + Reader::get(x_bins, full_indices[i+3]), _mm256_extractf128_pd(odd0, 1));
+        add_to_bin(sub0 + Reader::get(x_bins, full_indices[i+4]), _mm256_castpd256_pd128(even1));
+        add_to_bin(sub1 + Reader::get(x_bins, full_indices[i+5]), _mm256_castpd256_pd128(odd1));
+        add_to_bin(sub2 + Reader::get(x_bins, full_indices[i+6]), _mm256_extractf128_pd(even1, 1));
+        add_to_bin(sub3 + Reader::get(x_bins, full_indices[i+7]), _mm256_extractf128_pd(odd1, 1));
+    }
+    return i;
+}
+#endif
+#endif
+
+// add samples to sub-histograms by the best kernel of the CPU, then sub-histograms to 'bins'
+template <class Reader, class Weights>
+static void accumulate_bins_by_sub_bins(
+    const unsigned char * x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins,
+    size_t bin_size)
+{
+    std::vector<HistBin> sub_bins(SUB_HIST_SIZE * bin_size);
+    size_t begin = 0;
+#if defined GBDT_SIMD_X86
+    kSimd simd = get_simd();
+#if defined GBDT_SIMD_AVX512
+    if (simd == kSimd_AVX512)
+        begin = accumulate_sub_bins_avx512<Reader, Weights>(x_bins, full_indices, wy, w, n, &sub_bins[0], bin_size);
+    else
+#endif
+    if (simd == kSimd_AVX2)
+        begin = accumulate_sub_bins_avx2<Reader, Weights>(x_bins, full_indices, wy, w, n, &sub_bins[0], bin_size);
+#endif
+    accumulate_sub_bins<Reader, Weights>(x_bins, full_indices, wy, w, begin, n, &sub_bins[0], bin_size);
+
+    for (size_t k=0; k<SUB_HIST_SIZE; k++)
+    {
+        const HistBin * sub = &sub_bins[k * bin_size];
+        for (size_t i=0; i<bin_size; i++)
+        {
+            bins[i].y += sub[i].y;
+            bins[i].w += sub[i].w;
+            bins[i].n += sub[i].n;
+        }
+    }
+}
+
+// Sub-histograms are used for samples many times as bins,
+// which also makes zeroing and adding sub-histograms cheap.
+template <class Reader, class Weights>
+static void accumulate_bins(
+    const unsigned char * x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins,
+    size_t bin_size)
+{
+    if (n >= SUB_HIST_SIZE * bin_size)
+        accumulate_bins_by_sub_bins<Reader, Weights>(x_bins, full_indices, wy, w, n, bins, bin_size);
+    else
+        accumulate_bins<Reader, Weights>(x_bins, full_indices, wy, w, n, bins);
+}
+
+template <class Weights>
+static void accumulate_bins(
+    const XBinColumn& x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins,
+    size_t bin_size)
+{
+    if (x_bins.width() == 4)
+        accumulate_bins<XBinReader<4>, Weights>(x_bins.data(), full_indices, wy, w, n, bins, bin_size);
+    else if (x_bins.width() == 8)
+        accumulate_bins<XBinReader<8>, Weights>(x_bins.data(), full_indices, wy, w, n, bins, bin_size);
+    else
+        accumulate_bins<XBinReader<16>, Weights>(x_bins.data(), full_indices, wy, w, n, bins, bin_size);
+}
+
+// 'w' is 0 if all samples weigh 1, see XYSetRef::unit_weights,
+// 'bins' of the feature are 'bins[0, bin_size)'
+static void accumulate_bins(
+    const XBinColumn& x_bins,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins,
+    size_t bin_size)
+{
+    if (w == 0)
+        accumulate_bins<UnitWeights>(x_bins, full_indices, wy, w, n, bins, bin_size);
+    else
+        accumulate_bins<SampleWeights>(x_bins, full_indices, wy, w, n, bins, bin_size);
+}
+
+// add samples [begin, end) of 'set' to bins of a feature of the nodes they lie in,
+// bins of the feature of the kth node are 'bins[k][offset]...',
+// 'wy' and 'w' are weighted response and weight of the samples,
+// 'x_bins' starts from the bin index of the 'first' sample of the referred set.
+template <class Reader, class Weights>
+static void accumulate_bins(
+    const unsigned char * x_bins,
+    size_t first,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins,
+    size_t offset)
+{
+    const size_t npos = (size_t)-1;
+    for (size_t i=begin; i<end; i++)
+    {
+        size_t k = node_of[i];
+        if (k == npos)
+            continue;
+        HistBin& bin = bins[k][offset + Reader::get(x_bins, set.get_index(i) - first)];
+        bin.y += wy[i-begin];
+        bin.w += Weights::get(w, i - begin);
+        bin.n++;
+    }
+}
+
+template <class Weights>
+static void accumulate_bins(
+    const XBinColumn& x_bins,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins,
+    size_t offset)
+{
+    if (x_bins.width() == 4)
+        accumulate_bins<XBinReader<4>, Weights>(x_bins.data(), 0, set, node_of, begin, end, wy, w, bins, offset);
+    else if (x_bins.width() == 8)
+        accumulate_bins<XBinReader<8>, Weights>(x_bins.data(), 0, set, node_of, begin, end, wy, w, bins, offset);
+    else
+        accumulate_bins<XBinReader<16>, Weights>(x_bins.data(), 0, set, node_of, begin, end, wy, w, bins, offset);
+}
+
+// 'w' is 0 if all samples weigh 1, see XYSetRef::unit_weights
+static void accumulate_bins(
+    const XBinColumn& x_bins,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins,
+    size_t offset)
+{
+    if (w == 0)
+        accumulate_bins<UnitWeights>(x_bins, set, node_of, begin, end, wy, w, bins, offset);
+    else
+        accumulate_bins<SampleWeights>(x_bins, set, node_of, begin, end, wy, w, bins, offset);
+}
+
+// samples [begin, end) of 'set' are in 'block'
+template <class Weights>
+static void accumulate_bins(
+    const XBinBlock& block,
+    size_t x_index,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins,
+    size_t offset)
+{
+    const unsigned char * x_bins = block.data(x_index);
+    size_t first = block.begin();
+    if (block.width(x_index) == 4)
+        accumulate_bins<XBinReader<4>, Weights>(x_bins, first, set, node_of, begin, end, wy, w, bins, offset);
+    else if (block.width(x_index) == 8)
+        accumulate_bins<XBinReader<8>, Weights>(x_bins, first, set, node_of, begin, end, wy, w, bins, offset);
+    else
+        accumulate_bins<XBinReader<16>, Weights>(x_bins, first, set, node_of, begin, end, wy, w, bins, offset);
+}
+
+// 'w' is 0 if all samples weigh 1, see XYSetRef::unit_weights
+static void accumulate_bins(
+    const XBinBlock& block,
+    size_t x_index,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins,
+    size_t offset)
+{
+    if (w == 0)
+        accumulate_bins<UnitWeights>(block, x_index, set, node_of, begin, end, wy, w, bins, offset);
+    else
+        accumulate_bins<SampleWeights>(block, x_index, set, node_of, begin, end, wy, w, bins, offset);
+}
+
+// add samples 'full_indices[0, n)' to bins of a bundle of features,
+// bin index b of the bundle is 'bins[hist_indices[b]]', see XYSetRef::get_hist_indices
+template <class Reader, class Weights>
+static void accumulate_bundle(
+    const unsigned char * x_bins,
+    const size_t * hist_indices,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins)
+{
+    for (size_t i=0; i<n; i++)
+    {
+        HistBin& bin = bins[hist_indices[Reader::get(x_bins, full_indices[i])]];
+        bin.y += wy[i];
+        bin.w += Weights::get(w, i);
+        bin.n++;
+    }
+}
+
+template <class Weights>
+static void accumulate_bundle(
+    const XBinColumn& x_bins,
+    const size_t * hist_indices,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins)
+{
+    if (x_bins.width() == 4)
+        accumulate_bundle<XBinReader<4>, Weights>(x_bins.data(), hist_indices, full_indices, wy, w, n, bins);
+    else if (x_bins.width() == 8)
+        accumulate_bundle<XBinReader<8>, Weights>(x_bins.data(), hist_indices, full_indices, wy, w, n, bins);
+    else
+        accumulate_bundle<XBinReader<16>, Weights>(x_bins.data(), hist_indices, full_indices, wy, w, n, bins);
+}
+
+// 'w' is 0 if all samples weigh 1, see XYSetRef::unit_weights
+static void accumulate_bundle(
+    const XBinColumn& x_bins,
+    const size_t * hist_indices,
+    const size_t * full_indices,
+    const double * wy,
+    const double * w,
+    size_t n,
+    HistBin * bins)
+{
+    if (w == 0)
+        accumulate_bundle<UnitWeights>(x_bins, hist_indices, full_indices, wy, w, n, bins);
+    else
+        accumulate_bundle<SampleWeights>(x_bins, hist_indices, full_indices, wy, w, n, bins);
+}
+
+// add samples [begin, end) of 'set' to bins of a bundle of features of the nodes they lie in,
+// bins of the kth node are 'bins[k]...', see "accumulate_bins"
+template <class Reader, class Weights>
+static void accumulate_bundle(
+    const unsigned char * x_bins,
+    const size_t * hist_indices,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins)
+{
+    const size_t npos = (size_t)-1;
+    for (size_t i=begin; i<end; i++)
+    {
+        size_t k = node_of[i];
+        if (k == npos)
+            continue;
+        HistBin& bin = bins[k][hist_indices[Reader::get(x_bins, set.get_index(i))]];
+        bin.y += wy[i-begin];
+        bin.w += Weights::get(w, i - begin);
+        bin.n++;
+    }
+}
+
+template <class Weights>
+static void accumulate_bundle(
+    const XBinColumn& x_bins,
+    const size_t * hist_indices,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins)
+{
+    if (x_bins.width() == 4)
+        accumulate_bundle<XBinReader<4>, Weights>(x_bins.data(), hist_indices, set, node_of, begin, end, wy, w, bins);
+    else if (x_bins.width() == 8)
+        accumulate_bundle<XBinReader<8>, Weights>(x_bins.data(), hist_indices, set, node_of, begin, end, wy, w, bins);
+    else
+        accumulate_bundle<XBinReader<16>, Weights>(x_bins.data(), hist_indices, set, node_of, begin, end, wy, w, bins);
+}
+
+// 'w' is 0 if all samples weigh 1, see XYSetRef::unit_weights
+static void accumulate_bundle(
+    const XBinColumn& x_bins,
+    const size_t * hist_indices,
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const double * wy,
+    const double * w,
+    HistBin * const * bins)
+{
+    if (w == 0)
+        accumulate_bundle<UnitWeights>(x_bins, hist_indices, set, node_of, begin, end, wy, w, bins);
+    else
+        accumulate_bundle<SampleWeights>(x_bins, hist_indices, set, node_of, begin, end, wy, w, bins);
+}
+
+// Add the jth sample of sparse samples to bins of its stored features,
+// bins of the ith feature start from 'bins[offsets[i]]',
+// features whose 'x_used' are 0 are skipped, all are used if it is empty, see XYSetRef::use_x.
+// Bins of 0 are filled up by "Histogram::add_zero_bins" after all samples are added.
+static void accumulate_row(
+    const XBinRows& x_bin_rows,
+    size_t j,
+    double wy,
+    double w,
+    HistBin * bins,
+    const std::vector<size_t>& offsets,
+    const std::vector<char>& x_used)
+{
+    for (size_t k=x_bin_rows.begin(j), e=x_bin_rows.end(j); k<e; k++)
+    {
+        size_t x_index = x_bin_rows.get_x_index(k);
+        if (!x_used.empty() && !x_used[x_index])
+            continue;
+        HistBin& bin = bins[offsets[x_index] + x_bin_rows.get_bin(k)];
+        bin.y += wy;
+        bin.w += w;
+        bin.n++;
+    }
+}
+
+void Histogram::add_zero_bins(const XYSetRef& set)
+{
+    if (!set.is_sparse())
+        return;
+    // samples not in other bins of a feature are in its bin of 0
+    for (size_t x_index=0, x_size=set.get_x_type_size(); x_index<x_size; x_index++)
+    {
+        if (!set.uses_x(x_index))
+            continue;
+        HistBin zero = total_;
+        for (size_t i=offsets_[x_index], s=offsets_[x_index+1]; i<s; i++)
+        {
+            zero.y -= bins_[i].y;
+            zero.w -= bins_[i].w;
+            zero.n -= bins_[i].n;
+        }
+        HistBin& bin = bins_[offsets_[x_index] + set.get_zero_bin(x_index)];
+        bin.y += zero.y;
+        bin.w += zero.w;
+        bin.n += zero.n;
+    }
+}
+
+void Histogram::accumulate(
+    const XYSetRef& set,
+    const size_t * indices,
+    size_t n,
+    const std::vector<double>& response)
+{
+    std::vector<size_t> full_indices(n);
+    // weights are not gathered if all samples weigh 1
+    bool unit = set.unit_weights();
+    std::vector<double> wy(n);
+    std::vector<double> w(unit ? 0 : n);
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = indices[i];
+        double weight = unit ? 1.0 : set.get_weight(index);
+        full_indices[i] = set.get_index(index);
+        wy[i] = response[index] * weight;
+        if (!unit)
+            w[i] = weight;
+        total_.y += wy[i];
+        total_.w += weight;
+        yy_ += wy[i] * response[index];
+    }
+    total_.n += n;
+
+    if (n == 0)
+        return;
+    const XBundles& x_bundles = set.get_x_bundles();
+    if (!x_bundles.empty())
+    {
+        for (size_t b=0, s=x_bundles.size(); b<s; b++)
+        {
+            const size_t * hist_indices = set.get_hist_indices(b);
+            if (hist_indices)
+                accumulate_bundle(x_bundles.get_bundle(b).bins, hist_indices, &full_indices[0], &wy[0], get_data(w),
+                    n, &bins_[0]);
+        }
+        return;
+    }
+    if (set.is_sparse())
+    {
+        const XBinRows& x_bin_rows = set.get_x_bin_rows();
+        for (size_t i=0; i<n; i++)
+            accumulate_row(x_bin_rows, full_indices[i], wy[i], unit ? 1.0 : w[i], &bins_[0], offsets_, set.x_used());
+        return;
+    }
+    for (size_t x_index=0, x_size=set.get_x_type_size(); x_index<x_size; x_index++)
+        if (set.uses_x(x_index))
+            accumulate_bins(set.get_x_bins(x_index), &full_indices[0], &wy[0], get_data(w), n,
+                &bins_[offsets_[x_index]], get_bin_size(x_index));
+}
+
+void Histogram::accumulate(
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    size_t begin,
+    size_t end,
+    const std::vector<double>& response,
+    Histogram * hists,
+    size_t hist_size)
+{
+    const size_t npos = (size_t)-1;
+    if (begin == end)
+        return;
+    bool unit = set.unit_weights();
+    std::vector<double> wy(end - begin);
+    std::vector<double> w(unit ? 0 : end - begin);
+    for (size_t i=begin; i<end; i++)
+    {
+        size_t k = node_of[i];
+        if (k == npos)
+            continue;
+        Histogram& hist = hists[k];
+        double weight = unit ? 1.0 : set.get_weight(i);
+        wy[i-begin] = response[i] * weight;
+        if (!unit)
+            w[i-begin] = weight;
+        hist.total_.y += wy[i-begin];
+        hist.total_.w += weight;
+        hist.total_.n++;
+        hist.yy_ += wy[i-begin] * response[i];
+    }
+
+    std::vector<HistBin *> bins(hist_size);
+    for (size_t k=0; k<hist_size; k++)
+        bins[k] = &hists[k].bins_[0];
+    const XBundles& x_bundles = set.get_x_bundles();
+    if (!x_bundles.empty())
+    {
+        for (size_t b=0, s=x_bundles.size(); b<s; b++)
+        {
+            const size_t * hist_indices = set.get_hist_indices(b);
+            if (hist_indices)
+                accumulate_bundle(x_bundles.get_bundle(b).bins, hist_indices, set, node_of, begin, end,
+                    &wy[0], get_data(w), &bins[0]);
+        }
+        return;
+    }
+    if (set.is_sparse())
+    {
+        const XBinRows& x_bin_rows = set.get_x_bin_rows();
+        for (size_t i=begin; i<end; i++)
+        {
+            size_t k = node_of[i];
+            if (k != npos)
+                accumulate_row(x_bin_rows, set.get_index(i), wy[i-begin], unit ? 1.0 : w[i-begin], bins[k],
+                    hists[0].offsets_, set.x_used());
+        }
+        return;
+    }
+    for (size_t x_index=0, x_size=set.get_x_type_size(); x_index<x_size; x_index++)
+        if (set.uses_x(x_index))
+            accumulate_bins(set.get_x_bins(x_index), set, node_of, begin, end, &wy[0], get_data(w),
+                &bins[0], hists[0].offsets_[x_index]);
+}
+
+// Samples are split into chunks built in parallel when there are many of them,
+// the number of chunks depends only on the number of samples and bins,
+// so histograms do not depend on the number of threads.
+// Histograms of chunks take no more memory than samples themselves.
+static size_t get_chunk_size(size_t n, size_t bin_size)
+{
+    static const size_t MIN_SAMPLES_PER_CHUNK = 65536;
+    static const size_t MAX_CHUNK_SIZE = 64;
+    size_t chunk_size = std::min(n / MIN_SAMPLES_PER_CHUNK, MAX_CHUNK_SIZE);
+    if (bin_size != 0)
+        chunk_size = std::min(chunk_size, n / bin_size);
+    return chunk_size;
+}
+
+// add histograms of pairs of chunks, 'step' apart
+struct HistogramMergeTask : public ThreadTask
+{
+    std::vector<Histogram>& chunks;
+    size_t group_size;
+    size_t step;
+
+    HistogramMergeTask(std::vector<Histogram>& _chunks, size_t _group_size, size_t _step)
+        : chunks(_chunks), group_size(_group_size), step(_step) {}
+
+    virtual void run(size_t i)
+    {
+        size_t c = i * 2 * step;
+        for (size_t k=0; k<group_size; k++)
+            chunks[c * group_size + k].add(chunks[(c + step) * group_size + k]);
+    }
+};
+
+void Histogram::merge_chunks(
+    std::vector<Histogram>& chunks,
+    size_t chunk_size,
+    size_t group_size,
+    ThreadPool * pool)
+{
+    // tree reduction into the first chunk,
+    // the kth histogram of chunk c is 'chunks[c * group_size + k]'
+    for (size_t step=1; step<chunk_size; step*=2)
+    {
+        HistogramMergeTask task(chunks, group_size, step);
+        pool->parallel_for((chunk_size - step + 2 * step - 1) / (2 * step), &task);
+    }
+}
+
+// build histograms of a chunk of samples of a node
+struct HistogramChunkTask : public ThreadTask
+{
+    const XYSetRef& set;
+    const size_t * indices;
+    size_t n;
+    const std::vector<double>& response;
+    std::vector<Histogram>& chunks;
+
+    HistogramChunkTask(
+        const XYSetRef& _set,
+        const size_t * _indices,
+        size_t _n,
+        const std::vector<double>& _response,
+        std::vector<Histogram>& _chunks)
+        : set(_set), indices(_indices), n(_n), response(_response), chunks(_chunks) {}
+
+    virtual void run(size_t c)
+    {
+        size_t chunk_size = chunks.size();
+        size_t begin = n * c / chunk_size;
+        size_t end = n * (c + 1) / chunk_size;
+        chunks[c].init(set);
+        chunks[c].accumulate(set, indices + begin, end - begin, response);
+    }
+};
+
+// Features are built in parallel, or bundles of features of sparse samples, see XBundles.
+// Sparse samples not in bundles are built sample by sample.
+static size_t get_column_size(const XYSetRef& set)
+{
+    const XBundles& x_bundles = set.get_x_bundles();
+    return x_bundles.empty() ? set.get_x_type_size() : x_bundles.size();
+}
+
+// accumulate samples of a node into bins of a feature, or a bundle of features
+struct HistogramBuildTask : public ThreadTask
+{
+    const XYSetRef& set;
+    // indices in 'set', weighted response and weight of samples
+    const std::vector<size_t>& full_indices;
+    const std::vector<double>& wy;
+    const std::vector<double>& w;
+    HistBin * bins;
+    const std::vector<size_t>& offsets;
+
+    HistogramBuildTask(
+        const XYSetRef& _set,
+        const std::vector<size_t>& _full_indices,
+        const std::vector<double>& _wy,
+        const std::vector<double>& _w,
+        HistBin * _bins,
+        const std::vector<size_t>& _offsets)
+        : set(_set), full_indices(_full_indices), wy(_wy), w(_w), bins(_bins), offsets(_offsets) {}
+
+    virtual void run(size_t x_index)
+    {
+        if (full_indices.empty())
+            return;
+        const XBundles& x_bundles = set.get_x_bundles();
+        if (!x_bundles.empty())
+        {
+            const size_t * hist_indices = set.get_hist_indices(x_index);
+            if (hist_indices)
+                accumulate_bundle(x_bundles.get_bundle(x_index).bins, hist_indices, &full_indices[0], &wy[0],
+                    get_data(w), full_indices.size(), bins);
+        }
+        else if (set.uses_x(x_index))
+        {
+            accumulate_bins(set.get_x_bins(x_index), &full_indices[0], &wy[0], get_data(w), full_indices.size(),
+                bins + offsets[x_index], offsets[x_index+1] - offsets[x_index]);
+        }
+    }
+};
+
+void Histogram::build(
+    const XYSetRef& set,
+    const size_t * indices,
+    size_t n,
+    const std::vector<double>& response,
+    ThreadPool * pool)
+{
+    assert(set.size() == response.size());
+    // x bins on disk are only read in sequential passes
+    assert(set.x_bin_file() == 0);
+    init(set);
+
+    size_t chunk_size = get_chunk_size(n, bins_.size());
+    if (chunk_size > 1)
+    {
+        std::vector<Histogram> chunks(chunk_size);
+        HistogramChunkTask task(set, indices, n, response, chunks);
+        pool->parallel_for(chunk_size, &task);
+        merge_chunks(chunks, chunk_size, 1, pool);
+        *this = chunks[0];
+        add_zero_bins(set);
+        return;
+    }
+    // sparse samples are added one by one, without gathering them for every feature
+    if (set.is_sparse() && set.get_x_bundles().empty())
+    {
+        accumulate(set, indices, n, response);
+        add_zero_bins(set);
+        return;
+    }
+
+    // gather indices in 'set', weighted response and weight once, use them for all features
+    std::vector<size_t> full_indices(n);
+    // weights are not gathered if all samples weigh 1
+    bool unit = set.unit_weights();
+    std::vector<double> wy(n);
+    std::vector<double> w(unit ? 0 : n);
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = indices[i];
+        double weight = unit ? 1.0 : set.get_weight(index);
+        full_indices[i] = set.get_index(index);
+        wy[i] = response[index] * weight;
+        if (!unit)
+            w[i] = weight;
+        total_.y += wy[i];
+        total_.w += weight;
+        yy_ += wy[i] * response[index];
+    }
+    total_.n = n;
+
+    HistogramBuildTask task(set, full_indices, wy, w, &bins_[0], offsets_);
+    pool->parallel_for(get_column_size(set), &task);
+    add_zero_bins(set);
+}
+
+// build histograms of many nodes from a chunk of samples
+struct HistogramChunkManyTask : public ThreadTask
+{
+    const XYSetRef& set;
+    const std::vector<size_t>& node_of;
+    const std::vector<double>& response;
+    size_t group_size;
+    std::vector<Histogram>& chunks;
+
+    HistogramChunkManyTask(
+        const XYSetRef& _set,
+        const std::vector<size_t>& _node_of,
+        const std::vector<double>& _response,
+        size_t _group_size,
+        std::vector<Histogram>& _chunks)
+        : set(_set), node_of(_node_of), response(_response), group_size(_group_size), chunks(_chunks) {}
+
+    virtual void run(size_t c)
+    {
+        size_t n = set.size();
+        size_t chunk_size = chunks.size() / group_size;
+        Histogram * hists = &chunks[c * group_size];
+        for (size_t k=0; k<group_size; k++)
+            hists[k].init(set);
+        Histogram::accumulate(set, node_of, n * c / chunk_size, n * (c + 1) / chunk_size, response,
+            hists, group_size);
+    }
+};
+
+// accumulate samples of many nodes into bins of a feature, or a bundle of features
+struct HistogramBuildManyTask : public ThreadTask
+{
+    const XYSetRef& set;
+    const std::vector<size_t>& node_of;
+    const std::vector<double>& wy;
+    const std::vector<double>& w;
+    const std::vector<HistBin *>& bins;
+    const std::vector<size_t>& offsets;
+
+    HistogramBuildManyTask(
+        const XYSetRef& _set,
+        const std::vector<size_t>& _node_of,
+        const std::vector<double>& _wy,
+        const std::vector<double>& _w,
+        const std::vector<HistBin *>& _bins,
+        const std::vector<size_t>& _offsets)
+        : set(_set), node_of(_node_of), wy(_wy), w(_w), bins(_bins), offsets(_offsets) {}
+
+    virtual void run(size_t x_index)
+    {
+        if (node_of.empty())
+            return;
+        const XBundles& x_bundles = set.get_x_bundles();
+        if (!x_bundles.empty())
+        {
+            const size_t * hist_indices = set.get_hist_indices(x_index);
+            if (hist_indices)
+                accumulate_bundle(x_bundles.get_bundle(x_index).bins, hist_indices, set, node_of, 0, node_of.size(),
+                    &wy[0], get_data(w), &bins[0]);
+        }
+        else if (set.uses_x(x_index))
+        {
+            accumulate_bins(set.get_x_bins(x_index), set, node_of, 0, node_of.size(), &wy[0], get_data(w),
+                &bins[0], offsets[x_index]);
+        }
+    }
+};
+
+void Histogram::build(
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    const std::vector<double>& response,
+    const std::vector<Histogram *>& hists,
+    ThreadPool * pool)
+{
+    assert(set.size() == response.size());
+    assert(set.size() == node_of.size());
+    if (hists.empty())
+        return;
+
+    size_t group_size = hists.size();
+    hists[0]->init(set);
+    size_t chunk_size = get_chunk_size(set.size(), hists[0]->bins_.size() * group_size);
+    if (set.x_bin_file())
+    {
+        build_blocks(set, node_of, response, hists, chunk_size, pool);
+        return;
+    }
+    if (chunk_size > 1)
+    {
+        std::vector<Histogram> chunks(chunk_size * group_size);
+        HistogramChunkManyTask task(set, node_of, response, group_size, chunks);
+        pool->parallel_for(chunk_size, &task);
+        merge_chunks(chunks, chunk_size, group_size, pool);
+        for (size_t k=0; k<group_size; k++)
+        {
+            *hists[k] = chunks[k];
+            hists[k]->add_zero_bins(set);
+        }
+        return;
+    }
+    if (set.is_sparse() && set.get_x_bundles().empty())
+    {
+        std::vector<Histogram> group(group_size);
+        for (size_t k=0; k<group_size; k++)
+            group[k].init(set);
+        accumulate(set, node_of, 0, set.size(), response, &group[0], group_size);
+        for (size_t k=0; k<group_size; k++)
+        {
+            *hists[k] = group[k];
+            hists[k]->add_zero_bins(set);
+        }
+        return;
+    }
+
+    const size_t npos = (size_t)-1;
+    std::vector<HistBin *> bins(hists.size());
+    for (size_t k=0, s=hists.size(); k<s; k++)
+    {
+        hists[k]->init(set);
+        bins[k] = &hists[k]->bins_[0];
+    }
+
+    size_t n = set.size();
+    // weights are not gathered if all samples weigh 1
+    bool unit = set.unit_weights();
+    std::vector<double> wy(n);
+    std::vector<double> w(unit ? 0 : n);
+    for (size_t i=0; i<n; i++)
+    {
+        size_t k = node_of[i];
+        if (k == npos)
+            continue;
+        Histogram * hist = hists[k];
+        double weight = unit ? 1.0 : set.get_weight(i);
+        wy[i] = response[i] * weight;
+        if (!unit)
+            w[i] = weight;
+        hist->total_.y += wy[i];
+        hist->total_.w += weight;
+        hist->total_.n++;
+        hist->yy_ += wy[i] * response[i];
+    }
+
+    HistogramBuildManyTask task(set, node_of, wy, w, bins, hists[0]->offsets_);
+    pool->parallel_for(get_column_size(set), &task);
+    for (size_t k=0; k<group_size; k++)
+        hists[k]->add_zero_bins(set);
+}
+
+// accumulate samples of chunks in a block into bins of features,
+// the ith part is a feature of a chunk
+struct HistogramBlockTask : public ThreadTask
+{
+    const XYSetRef& set;
+    const XBinBlock& block;
+    const std::vector<size_t>& node_of;
+    // samples [begin, end) of 'set' are in the block
+    size_t begin;
+    size_t end;
+    // weighted response and weight of samples in the block
+    const std::vector<double>& wy;
+    const std::vector<double>& w;
+    // the cth chunk is samples [chunk_begins[c], chunk_begins[c+1]),
+    // its bins of the kth node are 'bins[c * group_size + k]'
+    const std::vector<size_t>& chunk_begins;
+    size_t first_chunk;
+    const std::vector<HistBin *>& bins;
+    size_t group_size;
+    const std::vector<size_t>& offsets;
+
+    HistogramBlockTask(
+        const XYSetRef& _set,
+        const XBinBlock& _block,
+        const std::vector<size_t>& _node_of,
+        size_t _begin,
+        size_t _end,
+        const std::vector<double>& _wy,
+        const std::vector<double>& _w,
+        const std::vector<size_t>& _chunk_begins,
+        size_t _first_chunk,
+        const std::vector<HistBin *>& _bins,
+        size_t _group_size,
+        const std::vector<size_t>& _offsets)
+        : set(_set), block(_block), node_of(_node_of), begin(_begin), end(_end), wy(_wy), w(_w),
+        chunk_begins(_chunk_begins), first_chunk(_first_chunk), bins(_bins), group_size(_group_size),
+        offsets(_offsets) {}
+
+    virtual void run(size_t i)
+    {
+        size_t x_size = set.get_x_type_size();
+        size_t c = first_chunk + i / x_size;
+        size_t x_index = i % x_size;
+        if (!set.uses_x(x_index))
+            return;
+        size_t _begin = std::max(begin, chunk_begins[c]);
+        size_t _end = std::min(end, chunk_begins[c+1]);
+        accumulate_bins(block, x_index, set, node_of, _begin, _end, &wy[_begin-begin], w.empty() ? 0 : &w[_begin-begin],
+            &bins[c * group_size], offsets[x_index]);
+    }
+};
+
+void Histogram::build_blocks(
+    const XYSetRef& set,
+    const std::vector<size_t>& node_of,
+    const std::vector<double>& response,
+    const std::vector<Histogram *>& hists,
+    size_t chunk_size,
+    ThreadPool * pool)
+{
+    // binary training samples are dense
+    assert(!set.is_sparse());
+    // Chunks are built block by block as x bins are read,
+    // a chunk accumulates its samples in the same order as in memory,
+    // so histograms are the same as those built in memory.
+    const size_t npos = (size_t)-1;
+    size_t n = set.size();
+    size_t group_size = hists.size();
+    std::vector<Histogram> chunks;
+    // the kth histogram of chunk c is 'chunk_hists[c * group_size + k]'
+    std::vector<Histogram *> chunk_hists;
+    if (chunk_size > 1)
+    {
+        chunks.resize(chunk_size * group_size);
+        for (size_t i=0, s=chunks.size(); i<s; i++)
+        {
+            chunks[i].init(set);
+            chunk_hists.push_back(&chunks[i]);
+        }
+    }
+    else
+    {
+        chunk_size = 1;
+        for (size_t k=0; k<group_size; k++)
+            hists[k]->init(set);
+        chunk_hists = hists;
+    }
+
+    std::vector<HistBin *> bins(chunk_hists.size());
+    for (size_t i=0, s=chunk_hists.size(); i<s; i++)
+        bins[i] = &chunk_hists[i]->bins_[0];
+    std::vector<size_t> chunk_begins(chunk_size + 1);
+    for (size_t c=0; c<=chunk_size; c++)
+        chunk_begins[c] = n * c / chunk_size;
+
+    bool unit = set.unit_weights();
+    std::vector<double> wy;
+    std::vector<double> w;
+    XBinBlockReader reader(*set.x_bin_file());
+    for (const XBinBlock * block; (block = reader.next()) != 0;)
+    {
+        size_t begin = set.lower_bound(block->begin());
+        size_t end = set.lower_bound(block->end());
+        if (begin == end)
+            continue;
+
+        // chunks [first_chunk, last_chunk] have samples in the block
+        size_t first_chunk = std::upper_bound(chunk_begins.begin(), chunk_begins.end(), begin)
+            - chunk_begins.begin() - 1;
+        size_t last_chunk = first_chunk;
+        wy.assign(end - begin, 0.0);
+        w.assign(unit ? 0 : end - begin, 0.0);
+        for (size_t i=begin; i<end; i++)
+        {
+            while (i >= chunk_begins[last_chunk+1])
+                last_chunk++;
+            size_t k = node_of[i];
+            if (k == npos)
+                continue;
+            Histogram * hist = chunk_hists[last_chunk * group_size + k];
+            double weight = unit ? 1.0 : set.get_weight(i);
+            wy[i-begin] = response[i] * weight;
+            if (!unit)
+                w[i-begin] = weight;
+            hist->total_.y += wy[i-begin];
+            hist->total_.w += weight;
+            hist->total_.n++;
+            hist->yy_ += wy[i-begin] * response[i];
+        }
+
+        HistogramBlockTask task(set, *block, node_of, begin, end, wy, w,
+            chunk_begins, first_chunk, bins, group_size, hists[0]->offsets_);
+        pool->parallel_for((last_chunk - first_chunk + 1) * set.get_x_type_size(), &task);
+    }
+
+    if (chunks.empty())
+        return;
+    merge_chunks(chunks, chunk_size, group_size, pool);
+    for (size_t k=0; k<group_size; k++)
+        *hists[k] = chunks[k];
+}
+
+void Histogram::subtract(const Histogram& parent, const Histogram& sibling)
+{
+    assert(parent.bins_.size() == sibling.bins_.size());
+    offsets_ = parent.offsets_;
+    bins_.resize(parent.bins_.size());
+    for (size_t i=0, s=bins_.size(); i<s; i++)
+    {
+        const HistBin& a = parent.bins_[i];
+        const HistBin& b = sibling.bins_[i];
+        HistBin& bin = bins_[i];
+        bin.y = a.y - b.y;
+        bin.w = a.w - b.w;
+        bin.n = a.n - b.n;
+    }
+    total_.y = parent.total_.y - sibling.total_.y;
+    total_.w = parent.total_.w - sibling.total_.w;
+    total_.n = parent.total_.n - sibling.total_.n;
+    yy_ = parent.yy_ - sibling.yy_;
+}
+
+void Histogram::add(const Histogram& other)
+{
+    assert(bins_.size() == other.bins_.size());
+    for (size_t i=0, s=bins_.size(); i<s; i++)
+    {
+        HistBin& bin = bins_[i];
+        const HistBin& b = other.bins_[i];
+        bin.y += b.y;
+        bin.w += b.w;
+        bin.n += b.n;
+    }
+    total_.y += other.total_.y;
+    total_.w += other.total_.w;
+    total_.n += other.total_.n;
+    yy_ += other.yy_;
+}
+
+void Histogram::allreduce(AllReducer * reducer)
+{
+    std::vector<Histogram *> hists(1, this);
+    allreduce(hists, reducer);
+}
+
+void Histogram::allreduce(const std::vector<Histogram *>& hists, AllReducer * reducer)
+{
+    // every bin is sent as 3 doubles, and the totals of a node as 4 doubles
+    size_t size = 0;
+    for (size_t k=0, s=hists.size(); k<s; k++)
+        size += hists[k]->bins_.size() * 3 + 4;
+
+    std::vector<double> buffer(size);
+    double * p = buffer.empty() ? 0 : &buffer[0];
+    for (size_t k=0, s=hists.size(); k<s; k++)
+    {
+        const Histogram& hist = *hists[k];
+        for (size_t i=0, t=hist.bins_.size(); i<t; i++)
+        {
+            *p++ = hist.bins_[i].y;
+            *p++ = hist.bins_[i].w;
+            *p++ = (double)hist.bins_[i].n;
+        }
+        *p++ = hist.total_.y;
+        *p++ = hist.total_.w;
+        *p++ = (double)hist.total_.n;
+        *p++ = hist.yy_;
+    }
+
+    reducer->sum(buffer.empty() ? 0 : &buffer[0], size);
+
+    p = buffer.empty() ? 0 : &buffer[0];
+    for (size_t k=0, s=hists.size(); k<s; k++)
+    {
+        Histogram& hist = *hists[k];
+        for (size_t i=0, t=hist.bins_.size(); i<t; i++)
+        {
+            hist.bins_[i].y = *p++;
+            hist.bins_[i].w = *p++;
+            hist.bins_[i].n = (size_t)*p++;
+        }
+        hist.total_.y = *p++;
+        hist.total_.w = *p++;
+        hist.total_.n = (size_t)*p++;
+        hist.yy_ = *p++;
+    }
+}
+
+void Histogram::clear()
+{
+    std::vector<size_t>().swap(offsets_);
+    std::vector<HistBin>().swap(bins_);
+    total_ = HistBin();
+    yy_ = 0.0;
+}
@@ -0,0 +1,107 @@
+#ifndef GBDT_HIST_H
+#define GBDT_HIST_H
+
+#include "net.h"
+#include "sample.h"
+#include "thread.h"
+#include <vector>
+
+// statistics of training samples lying in a bin
+struct HistBin
+{
+    double y;// sum of weighted response
+    double w;// sum of weight
+    size_t n;// number of samples
+
+    HistBin() : y(0.0), w(0.0), n(0) {}
+};
+
+// histograms of all features of a tree node
+class Histogram
+{
+private:
+    // bins of the ith feature start from bins_[offsets_[i]]
+    std::vector<size_t> offsets_;
+    std::vector<HistBin> bins_;
+    // statistics of all samples
+    HistBin total_;
+    // sum of weighted square response
+    double yy_;
+
+public:
+    Histogram() : yy_(0.0) {}
+
+    bool empty() const {return bins_.empty();}
+    size_t get_bin_size(size_t x_index) const {return offsets_[x_index+1] - offsets_[x_index];}
+    const HistBin * get_bins(size_t x_index) const {return &bins_[offsets_[x_index]];}
+    const HistBin& total() const {return total_;}
+    double yy() const {return yy_;}
+
+private:
+    void init(const XYSetRef& set);
+    void accumulate(
+        const XYSetRef& set,
+        const size_t * indices,
+        size_t n,
+        const std::vector<double>& response);
+    static void accumulate(
+        const XYSetRef& set,
+        const std::vector<size_t>& node_of,
+        size_t begin,
+        size_t end,
+        const std::vector<double>& response,
+        Histogram * hists,
+        size_t hist_size);
+    // fill up bins of 0 of sparse samples after all samples are added, see XBinRows
+    void add_zero_bins(const XYSetRef& set);
+    // build histograms of many nodes from x bins read from disk in blocks, see "build"
+    static void build_blocks(
+        const XYSetRef& set,
+        const std::vector<size_t>& node_of,
+        const std::vector<double>& response,
+        const std::vector<Histogram *>& hists,
+        size_t chunk_size,
+        ThreadPool * pool);
+    static void merge_chunks(
+        std::vector<Histogram>& chunks,
+        size_t chunk_size,
+        size_t group_size,
+        ThreadPool * pool);
+
+    friend struct HistogramChunkTask;
+    friend struct HistogramChunkManyTask;
+    friend struct HistogramMergeTask;
+
+public:
+
+    // build from samples 'set.get(indices[i])' and their pseudo response 'response[indices[i]]',
+    // i in [0, n), in parallel by 'pool'.
+    // Features are built in parallel for a few samples,
+    // chunks of samples are built in parallel and merged for many samples.
+    void build(
+        const XYSetRef& set,
+        const size_t * indices,
+        size_t n,
+        const std::vector<double>& response,
+        ThreadPool * pool);
+    // build histograms of many nodes in one sequential pass over all samples in 'set',
+    // the ith sample lies in node 'node_of[i]', or in none if 'node_of[i]' is -1.
+    // It is the only way to build histograms when x bins are read from disk, see XBinFile.
+    static void build(
+        const XYSetRef& set,
+        const std::vector<size_t>& node_of,
+        const std::vector<double>& response,
+        const std::vector<Histogram *>& hists,
+        ThreadPool * pool);
+    // build from histograms of parent and sibling nodes
+    void subtract(const Histogram& parent, const Histogram& sibling);
+    // add histograms of another node with the same bins
+    void add(const Histogram& other);
+    // sum histograms of the same node in all workers
+    void allreduce(AllReducer * reducer);
+    // sum histograms of the same nodes in all workers in one message
+    static void allreduce(const std::vector<Histogram *>& hists, AllReducer * reducer);
+    void clear();
+};
+
+#endif// GBDT_HIST_H
@@ -50,6 +50,7 @@ int main()
     std::vector<size_t> new_labels;// manual labels sorted by 'scores'
     std::vector<double> scores;// model scores
     std::vector<size_t> indices;
+    CompoundValueVector X;
     double ndcg;
     double dcg;
     double idcg;
@@ -60,16 +61,16 @@ int main()
     for (size_t i=0, s=n_samples_per_query.size(); i<s; i++)
     {
         // for each query-result list
-        const XY * results = &set.sample()[begin];
         size_t result_size = n_samples_per_query[i];
 
         labels.clear(); labels.reserve(result_size);
         scores.clear(); scores.reserve(result_size);
         for (size_t j=0; j<result_size; j++)
         {
-            const XY& xy = results[j];
+            XY xy = set.get(begin + j);
+            xy.get_X(&X);
             labels.push_back((size_t)xy.y());
-            scores.push_back(trainer.predict(xy.X()));
+            scores.push_back(trainer.predict(X));
         }
 
         sort_indices(&scores[0], scores.size(), &indices, std::greater<double>());
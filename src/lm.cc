@@ -3,6 +3,7 @@
 #include "lm-util.h"
 #include "json.h"
 #include "node.h"
+#include "thread.h"
 #include <assert.h>
 #include <math.h>
 
@@ -13,7 +14,8 @@ private:
     const std::vector<size_t> * n_samples_per_query_;
     const NDCGScorer * scorer_;
 
-    // node data that will be divided when node is split.
+    // root node only
+    // weights of root's 'set_'
     std::vector<double> weights_;
 
     // all weights are useless in LambdaMART.
@@ -22,7 +24,7 @@ private:
         double total_y  = 0.0;
         for (size_t i=0, s=full_set.size(); i<s; i++)
         {
-            const XY& xy = full_set.get(i);
+            XY xy = full_set.get(i);
             total_y += (double)xy.label();
         }
         return total_y / full_set.size();
@@ -56,20 +58,10 @@ public:
     }
 
 protected:
-    virtual void add_data(const XY& xy, const TreeNodeBase * parent, size_t _index)
-    {
-        assert(!is_root());
-        set().add(xy);
-        LambdaMARTNode * lm_parent = (LambdaMARTNode *)parent;
-        response_.push_back(lm_parent->response_[_index]);
-        weights_.push_back(lm_parent->weights_[_index]);
-    }
-
     virtual void clear()
     {
-        set().clear();
-        response_.clear();
-        weights_.clear();
+        TreeNodeBase::clear();
+        std::vector<double>().swap(weights_);
     }
 
     virtual void update_response(const std::vector<double>& fx)
@@ -86,20 +78,23 @@ protected:
 
         size_t cutoff = scorer_->get_cutoff();
         size_t begin = 0;
+        std::vector<XY> results;
         for (size_t i=0, s=n_samples_per_query_->size(); i<s; i++)
         {
             // for each query-result list
-            const XY * const * results = &xy_set.sample()[begin];
             size_t result_size = (*n_samples_per_query_)[i];
+            results.clear();
+            for (size_t j=0; j<result_size; j++)
+                results.push_back(xy_set.get(begin + j));
 
             // sort 'results'
             std::vector<size_t> indices;
-            sort_indices(results, result_size, &indices, XYLabelGreater());
+            sort_indices(&results[0], result_size, &indices, XYLabelGreater());
 
             SymmetricMatrixD delta;
             std::vector<size_t> labels; labels.reserve(result_size);
             for (size_t j=0; j<result_size; j++)
-                labels.push_back(results[indices[j]]->label());
+                labels.push_back(results[indices[j]].label());
             scorer_->get_delta(labels, &delta);
 
             // 'j', 'k' are indices in 'indices' and 'results[indices[j]]'.
@@ -108,15 +103,15 @@ protected:
             {
                 // for each result in the sorted query-result list 'results[indices[j]]'
                 size_t jj = indices[j] + begin;
-                const XY * xy_j = results[indices[j]];
+                const XY& xy_j = results[indices[j]];
                 for (size_t k=0; k<result_size; k++)
                 {
                     if (j > cutoff && k > cutoff)
                         break;
 
                     size_t kk = indices[k] + begin;
-                    const XY * xy_k = results[indices[k]];
-                    if (xy_j->label() > xy_k->label())
+                    const XY& xy_k = results[indices[k]];
+                    if (xy_j.label() > xy_k.label())
                     {
                         double delta_jk = delta.at(j, k);
                         if (delta_jk > 0.0)
@@ -140,17 +135,16 @@ protected:
 
     virtual void update_predicted_y()
     {
-        const XYSetRef& xy_set = set();
-        assert(xy_set.size() == response_.size());
-        assert(response_.size() == weights_.size());
+        const LambdaMARTNode * lm_root = (const LambdaMARTNode *)root();
+        const std::vector<double>& weights = lm_root->weights_;
 
         double sum_response = 0.0;
         double sum_weight = 0.0;
 
-        for (size_t i=0, s=xy_set.size(); i<s; i++)
+        for (size_t i=0, s=size(); i<s; i++)
         {
-            sum_response += response_[i];
-            sum_weight += weights_[i];
+            sum_response += get_response(i);
+            sum_weight += weights[get_index(i)];
         }
 
         if (sum_response < EPS && sum_weight < EPS)
@@ -191,10 +185,14 @@ LambdaMARTTrainer::LambdaMARTTrainer(
     holder->scorer() = scorer_;
 
     holder_ = holder;
+    pool_ = new ThreadPool(param.threads);
+    buffers_ = new TreeBuffers;
 }
 
 LambdaMARTTrainer::~LambdaMARTTrainer()
 {
+    delete buffers_;
+    delete pool_;
     delete scorer_;
     delete holder_;
 }
@@ -208,7 +206,7 @@ void LambdaMARTTrainer::train()
     for (size_t i=0; i<param_.tree_number; i++)
     {
         printf("training tree No.%d... ", (int)i);
-        TreeNodeBase * tree = holder_->train(full_set_, param_, &full_fx_);
+        TreeNodeBase * tree = holder_->train(full_set_, param_, pool_, &full_fx_, 0, i, buffers_);
         trees_.push_back(tree);
         printf("OK\n");
     }
@@ -9,6 +9,8 @@
 class TreeNodeBase;
 class LambdaMARTNode;
 class NDCGScorer;
+class ThreadPool;
+struct TreeBuffers;
 
 class LambdaMARTPredictor
 {
@@ -31,6 +33,9 @@ private:
     std::vector<double> full_fx_;
     const LambdaMARTNode * holder_;
     const NDCGScorer * scorer_;
+    ThreadPool * pool_;
+    // memory reused by every tree
+    TreeBuffers * buffers_;
 public:
     LambdaMARTTrainer(
         const XYSet& set,
@@ -0,0 +1,204 @@
+#include "loss.h"
+#include "simd.h"
+#include <stdint.h>
+#include <string.h>
+
+static const double LN2_HI = 6.93147180369123816490e-01;
+static const double LN2_LO = 1.90821492927058770002e-10;
+static const double LOG2E = 1.44269504088896338700e+00;
+static const double SQRT2 = 1.41421356237309514547e+00;
+// adding and subtracting it rounds a double of magnitude below 2^51 to the nearest integer
+static const double ROUNDER = 6755399441055744.0;
+// exp of smaller x is taken as 0
+static const double MIN_EXP_X = -708.0;
+
+// exp(x), x in [MIN_EXP_X, 0], is 2^k * exp(r), r = x - k * ln2 in [-ln2/2, ln2/2],
+// exp(r) is its Taylor polynomial of degree 12
+static inline double fast_exp(double x)
+{
+    if (x < MIN_EXP_X)
+        return 0.0;
+    double k = (x * LOG2E + ROUNDER) - ROUNDER;
+    double r = (x - k * LN2_HI) - k * LN2_LO;
+    double p = 1.0 / 479001600;
+    p = p * r + 1.0 / 39916800;
+    p = p * r + 1.0 / 3628800;
+    p = p * r + 1.0 / 362880;
+    p = p * r + 1.0 / 40320;
+    p = p * r + 1.0 / 5040;
+    p = p * r + 1.0 / 720;
+    p = p * r + 1.0 / 120;
+    p = p * r + 1.0 / 24;
+    p = p * r + 1.0 / 6;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+    uint64_t bits = (uint64_t)((int64_t)k + 1023) << 52;
+    double scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return p * scale;
+}
+
+// log(1 + u), u in [0, 1], is e * ln2 + log(m), 1 + u = 2^e * m, m in [sqrt(2)/2, sqrt(2)],
+// log(m) = 2 * atanh(s), s = (m - 1) / (m + 1) in [-0.172, 0.172], by its Taylor polynomial of degree 19
+static inline double fast_log1p(double u)
+{
+    double e = 1.0 + u > SQRT2 ? 1.0 : 0.0;
+    double f = e != 0.0 ? (u - 1.0) * 0.5 : u;
+    double s = f / (2.0 + f);
+    double s2 = s * s;
+    double p = 1.0 / 19;
+    p = p * s2 + 1.0 / 17;
+    p = p * s2 + 1.0 / 15;
+    p = p * s2 + 1.0 / 13;
+    p = p * s2 + 1.0 / 11;
+    p = p * s2 + 1.0 / 9;
+    p = p * s2 + 1.0 / 7;
+    p = p * s2 + 1.0 / 5;
+    p = p * s2 + 1.0 / 3;
+    p = p * s2 + 1.0;
+    return e * LN2_HI + (e * LN2_LO + 2.0 * s * p);
+}
+
+// For t = 2 * y * fx and u = exp(-|t|),
+// the pseudo response 2 * y / (1 + exp(t)) is 2 * y * u / (1 + u) if t > 0, or else 2 * y / (1 + u),
+// and the loss log(1 + exp(-t)) is max(-t, 0) + log(1 + u), neither overflows.
+static void fast_logistic(
+    const double * y,
+    const double * fx,
+    const double * w,
+    size_t begin,
+    size_t n,
+    double * response,
+    double * loss)
+{
+    double _loss = loss ? *loss : 0.0;
+    for (size_t i=begin; i<n; i++)
+    {
+        double t = 2.0 * y[i] * fx[i];
+        double u = fast_exp(-fabs(t));
+        double d = 1.0 / (1.0 + u);
+        if (response)
+            response[i] = 2.0 * y[i] * (t > 0.0 ? u * d : d);
+        if (loss)
+            _loss += ((t < 0.0 ? -t : 0.0) + fast_log1p(u)) * w[i];
+    }
+    if (loss)
+        *loss = _loss;
+}
+
+#if defined GBDT_SIMD_X86
+// the same operations as "fast_exp" and "fast_log1p" on 4 samples
+GBDT_TARGET("avx2") static inline __m256d horner(__m256d p, __m256d x, double c)
+{
+    return _mm256_add_pd(_mm256_mul_pd(p, x), _mm256_set1_pd(c));
+}
+
+GBDT_TARGET("avx2") static inline __m256d fast_exp4(__m256d x)
+{
+    __m256d zero = _mm256_cmp_pd(x, _mm256_set1_pd(MIN_EXP_X), _CMP_LT_OQ);
+    x = _mm256_max_pd(x, _mm256_set1_pd(MIN_EXP_X));
+    __m256d rounder = _mm256_set1_pd(ROUNDER);
+    __m256d k = _mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(x, _mm256_set1_pd(LOG2E)), rounder), rounder);
+    __m256d r = _mm256_sub_pd(_mm256_sub_pd(x, _mm256_mul_pd(k, _mm256_set1_pd(LN2_HI))),
+        _mm256_mul_pd(k, _mm256_set1_pd(LN2_LO)));
+    __m256d p = _mm256_set1_pd(1.0 / 479001600);
+    p = horner(p, r, 1.0 / 39916800);
+    p = horner(p, r, 1.0 / 3628800);
+    p = horner(p, r, 1.0 / 362880);
+    p = horner(p, r, 1.0 / 40320);
+    p = horner(p, r, 1.0 / 5040);
+    p = horner(p, r, 1.0 / 720);
+    p = horner(p, r, 1.0 / 120);
+    p = horner(p, r, 1.0 / 24);
+    p = horner(p, r, 1.0 / 6);
+    p = horner(p, r, 0.5);
+    p = horner(p, r, 1.0);
+    p = horner(p, r, 1.0);
+    __m256i bits = _mm256_slli_epi64(_mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k)),
+        _mm256_set1_epi64x(1023)), 52);
+    return _mm256_andnot_pd(zero, _mm256_mul_pd(p, _mm256_castsi256_pd(bits)));
+}
+
+GBDT_TARGET("avx2") static inline __m256d fast_log1p4(__m256d u)
+{
+    __m256d one = _mm256_set1_pd(1.0);
+    __m256d high = _mm256_cmp_pd(_mm256_add_pd(one, u), _mm256_set1_pd(SQRT2), _CMP_GT_OQ);
+    __m256d e = _mm256_and_pd(high, one);
+    __m256d f = _mm256_blendv_pd(u, _mm256_mul_pd(_mm256_sub_pd(u, one), _mm256_set1_pd(0.5)), high);
+    __m256d s = _mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f));
+    __m256d s2 = _mm256_mul_pd(s, s);
+    __m256d p = _mm256_set1_pd(1.0 / 19);
+    p = horner(p, s2, 1.0 / 17);
+    p = horner(p, s2, 1.0 / 15);
+    p = horner(p, s2, 1.0 / 13);
+    p = horner(p, s2, 1.0 / 11);
+    p = horner(p, s2, 1.0 / 9);
+    p = horner(p, s2, 1.0 / 7);
+    p = horner(p, s2, 1.0 / 5);
+    p = horner(p, s2, 1.0 / 3);
+    p = horner(p, s2, 1.0);
+    return _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(LN2_HI)),
+        _mm256_add_pd(_mm256_mul_pd(e, _mm256_set1_pd(LN2_LO)), _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), s), p)));
+}
+
+// "fast_logistic" on samples [0, n) by 4 per iteration, return the number of samples computed
+GBDT_TARGET("avx2") static size_t fast_logistic_avx2(
+    const double * y,
+    const double * fx,
+    const double * w,
+    size_t n,
+    double * response,
+    double * loss)
+{
+    __m256d zero = _mm256_setzero_pd();
+    __m256d one = _mm256_set1_pd(1.0);
+    __m256d two = _mm256_set1_pd(2.0);
+    __m256d sign = _mm256_set1_pd(-0.0);
+    double _loss = loss ? *loss : 0.0;
+    size_t i = 0;
+    for (; i+4<=n; i+=4)
+    {
+        __m256d y2 = _mm256_mul_pd(two, _mm256_loadu_pd(y + i));
+        __m256d t = _mm256_mul_pd(y2, _mm256_loadu_pd(fx + i));
+        // -|t|
+        __m256d u = fast_exp4(_mm256_or_pd(t, sign));
+        __m256d d = _mm256_div_pd(one, _mm256_add_pd(one, u));
+        if (response)
+        {
+            __m256d positive = _mm256_cmp_pd(t, zero, _CMP_GT_OQ);
+            _mm256_storeu_pd(response + i, _mm256_mul_pd(y2, _mm256_blendv_pd(d, _mm256_mul_pd(u, d), positive)));
+        }
+        if (loss)
+        {
+            __m256d l = _mm256_add_pd(_mm256_max_pd(_mm256_sub_pd(zero, t), zero), fast_log1p4(u));
+            double ls[4];
+            _mm256_storeu_pd(ls, _mm256_mul_pd(l, _mm256_loadu_pd(w + i)));
+            // in order of samples
+            _loss += ls[0];
+            _loss += ls[1];
+            _loss += ls[2];
+            _loss += ls[3];
+        }
+    }
+    if (loss)
+        *loss = _loss;
+    return i;
+}
+#endif
+
+void FastLogisticLossKernel::batch(
+    const double * y,
+    const double * fx,
+    const double * w,
+    size_t n,
+    double * response,
+    double * loss)
+{
+    size_t begin = 0;
+#if defined GBDT_SIMD_X86
+    if (get_simd() >= kSimd_AVX2)
+        begin = fast_logistic_avx2(y, fx, w, n, response, loss);
+#endif
+    fast_logistic(y, fx, w, begin, n, response, loss);
+}
@@ -0,0 +1,109 @@
+#ifndef GBDT_LOSS_H
+#define GBDT_LOSS_H
+
+#include <math.h>
+#include <stddef.h>
+
+// Kernels of losses compute samples [0, n) of contiguous arrays in a batch,
+// y[i], fx[i] and weight w[i] are of the ith one:
+//   static void batch(const double * y, const double * fx, const double * w, size_t n,
+//       double * response, double * loss),
+// pseudo responses are written to 'response' if it is not 0,
+// and weighted losses are added to '*loss' one by one in order if it is not 0, 'w' is only read then.
+
+// a batch of a kernel 'Kernel' of a loss of a sample, it has
+//   static double response(double y, double fx), pseudo response of a sample,
+//   static double loss(double y, double fx), loss of a sample before weighted.
+template <class Kernel>
+static inline void batch_by_sample(
+    const double * y,
+    const double * fx,
+    const double * w,
+    size_t n,
+    double * response,
+    double * loss)
+{
+    if (response)
+    {
+        for (size_t i=0; i<n; i++)
+            response[i] = Kernel::response(y[i], fx[i]);
+    }
+    if (loss)
+    {
+        double _loss = *loss;
+        for (size_t i=0; i<n; i++)
+            _loss += Kernel::loss(y[i], fx[i]) * w[i];
+        *loss = _loss;
+    }
+}
+
+struct LSLossKernel
+{
+    static double response(double y, double fx)
+    {
+        return y - fx;
+    }
+
+    static double loss(double y, double fx)
+    {
+        double residual = y - fx;
+        return residual * residual;
+    }
+
+    static void batch(const double * y, const double * fx, const double * w, size_t n, double * response, double * loss)
+    {
+        batch_by_sample<LSLossKernel>(y, fx, w, n, response, loss);
+    }
+};
+
+struct LADLossKernel
+{
+    static double response(double y, double fx)
+    {
+        if (y - fx >= 0.0)
+            return 1.0;
+        else
+            return -1.0;
+    }
+
+    static double loss(double y, double fx)
+    {
+        return fabs(y - fx);
+    }
+
+    static void batch(const double * y, const double * fx, const double * w, size_t n, double * response, double * loss)
+    {
+        batch_by_sample<LADLossKernel>(y, fx, w, n, response, loss);
+    }
+};
+
+// logistic loss by exp and log of the C library, for "gbdt_loss_math = exact"
+struct LogisticLossKernel
+{
+    static double response(double y, double fx)
+    {
+        return 2.0 * y / (1.0 + exp(2 * y * fx));
+    }
+
+    static double loss(double y, double fx)
+    {
+        return log(1 + exp(-2.0 * y * fx));
+    }
+
+    static void batch(const double * y, const double * fx, const double * w, size_t n, double * response, double * loss)
+    {
+        batch_by_sample<LogisticLossKernel>(y, fx, w, n, response, loss);
+    }
+};
+
+// Logistic loss by polynomial approximations of exp and log, for "gbdt_loss_math = fast".
+// Both have relative errors within a few ulps, below 1e-15,
+// and a sample takes one exp and one log instead of two exps and one log.
+// Samples are computed by AVX2 instructions if the CPU supports them, see "get_simd",
+// results are the same as computed one by one by the same approximations.
+struct FastLogisticLossKernel
+{
+    static void batch(const double * y, const double * fx, const double * w, size_t n, double * response, double * loss);
+};
+
+#endif// GBDT_LOSS_H
@@ -0,0 +1,326 @@
+#include "net.h"
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+#if !defined _WIN32
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+// do not get SIGPIPE when a worker is gone
+#if defined MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+#endif
+
+AllReducer::AllReducer()
+    : rank_(0), size_(1), bytes_(0), seconds_(0.0) {}
+
+static double seconds_since(const std::chrono::steady_clock::time_point& begin)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+static int split_host_port(const std::string& master, std::string * host, std::string * port)
+{
+    size_t pos = master.rfind(':');
+    if (pos == std::string::npos || pos == 0 || pos + 1 == master.size())
+    {
+        fprintf(stderr, "invalid master address \"%s\", it should be \"host:port\"\n", master.c_str());
+        return -1;
+    }
+    host->assign(master, 0, pos);
+    port->assign(master, pos + 1, std::string::npos);
+    return 0;
+}
+
+#if defined _WIN32
+AllReducer::~AllReducer() {}
+
+int AllReducer::init(size_t rank, size_t size, const std::string& master)
+{
+    rank_ = rank;
+    size_ = size;
+    if (size_ == 1)
+        return 0;
+    fprintf(stderr, "distributed training is not supported on Windows\n");
+    return -1;
+}
+
+int AllReducer::listen_workers(const std::string& host, const std::string& port)
+{
+    return -1;
+}
+
+int AllReducer::connect_master(const std::string& host, const std::string& port)
+{
+    return -1;
+}
+
+void AllReducer::send_all(int fd, const void * data, size_t size)
+{
+    abort();
+}
+
+void AllReducer::recv_all(int fd, void * data, size_t size)
+{
+    abort();
+}
+#else
+AllReducer::~AllReducer()
+{
+    for (size_t i=0, s=sockets_.size(); i<s; i++)
+        close(sockets_[i]);
+}
+
+int AllReducer::init(size_t rank, size_t size, const std::string& master)
+{
+    assert(sockets_.empty());
+    if (size == 0 || rank >= size)
+    {
+        fprintf(stderr, "invalid rank %d of %d workers\n", (int)rank, (int)size);
+        return -1;
+    }
+
+    rank_ = rank;
+    size_ = size;
+    if (size_ == 1)
+        return 0;
+
+    std::string host, port;
+    if (split_host_port(master, &host, &port) == -1)
+        return -1;
+    if (rank_ == 0)
+        return listen_workers(host, port);
+    else
+        return connect_master(host, port);
+}
+
+static int set_no_delay(int fd)
+{
+    int on = 1;
+    return setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+}
+
+int AllReducer::listen_workers(const std::string& host, const std::string& port)
+{
+    struct addrinfo hints, * addr;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addr) != 0)
+    {
+        fprintf(stderr, "resolve \"%s:%s\" failed\n", host.c_str(), port.c_str());
+        return -1;
+    }
+
+    int listen_fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+    int on = 1;
+    if (listen_fd == -1
+        || setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) == -1
+        || bind(listen_fd, addr->ai_addr, addr->ai_addrlen) == -1
+        || listen(listen_fd, (int)size_) == -1)
+    {
+        fprintf(stderr, "listen on \"%s:%s\" failed: %s\n", host.c_str(), port.c_str(), strerror(errno));
+        if (listen_fd != -1)
+            close(listen_fd);
+        freeaddrinfo(addr);
+        return -1;
+    }
+    freeaddrinfo(addr);
+
+    // every worker tells its rank first
+    sockets_.assign(size_ - 1, -1);
+    for (size_t i=1; i<size_; i++)
+    {
+        int fd = accept(listen_fd, 0, 0);
+        unsigned int rank = 0;
+        if (fd == -1
+            || set_no_delay(fd) == -1
+            || recv(fd, &rank, sizeof(rank), MSG_WAITALL) != (ssize_t)sizeof(rank)
+            || rank == 0 || rank >= size_ || sockets_[rank-1] != -1)
+        {
+            fprintf(stderr, "accept worker failed\n");
+            if (fd != -1)
+                close(fd);
+            close(listen_fd);
+            return -1;
+        }
+        sockets_[rank-1] = fd;
+    }
+    close(listen_fd);
+    return 0;
+}
+
+int AllReducer::connect_master(const std::string& host, const std::string& port)
+{
+    // worker 0 may be not listening yet, retry for a while
+    static const int MAX_RETRY = 600;
+    struct addrinfo hints, * addr;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addr) != 0)
+    {
+        fprintf(stderr, "resolve \"%s:%s\" failed\n", host.c_str(), port.c_str());
+        return -1;
+    }
+
+    int fd = -1;
+    for (int retry=0; retry<MAX_RETRY; retry++)
+    {
+        fd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+        if (fd == -1)
+            break;
+        if (connect(fd, addr->ai_addr, addr->ai_addrlen) == 0)
+            break;
+        close(fd);
+        fd = -1;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    freeaddrinfo(addr);
+
+    unsigned int rank = (unsigned int)rank_;
+    if (fd == -1
+        || set_no_delay(fd) == -1
+        || send(fd, &rank, sizeof(rank), SEND_FLAGS) != (ssize_t)sizeof(rank))
+    {
+        fprintf(stderr, "connect to \"%s:%s\" failed\n", host.c_str(), port.c_str());
+        if (fd != -1)
+            close(fd);
+        return -1;
+    }
+    sockets_.push_back(fd);
+    return 0;
+}
+
+void AllReducer::send_all(int fd, const void * data, size_t size)
+{
+    const char * p = (const char *)data;
+    while (size != 0)
+    {
+        ssize_t sent = send(fd, p, size, SEND_FLAGS);
+        if (sent <= 0)
+        {
+            fprintf(stderr, "send to worker failed: %s\n", strerror(errno));
+            exit(1);
+        }
+        p += sent;
+        size -= (size_t)sent;
+        bytes_ += (size_t)sent;
+    }
+}
+
+void AllReducer::recv_all(int fd, void * data, size_t size)
+{
+    char * p = (char *)data;
+    while (size != 0)
+    {
+        ssize_t received = recv(fd, p, size, 0);
+        if (received <= 0)
+        {
+            fprintf(stderr, "receive from worker failed: %s\n", received == 0 ? "closed" : strerror(errno));
+            exit(1);
+        }
+        p += received;
+        size -= (size_t)received;
+        bytes_ += (size_t)received;
+    }
+}
+#endif
+
+void AllReducer::sum(double * data, size_t n)
+{
+    if (size_ == 1 || n == 0)
+        return;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    size_t size = n * sizeof(double);
+    if (rank_ == 0)
+    {
+        std::vector<double> buffer(n);
+        for (size_t i=0, s=sockets_.size(); i<s; i++)
+        {
+            recv_all(sockets_[i], &buffer[0], size);
+            for (size_t j=0; j<n; j++)
+                data[j] += buffer[j];
+        }
+        for (size_t i=0, s=sockets_.size(); i<s; i++)
+            send_all(sockets_[i], data, size);
+    }
+    else
+    {
+        send_all(sockets_[0], data, size);
+        recv_all(sockets_[0], data, size);
+    }
+    seconds_ += seconds_since(begin);
+}
+
+void AllReducer::broadcast(std::vector<char> * data)
+{
+    if (size_ == 1)
+        return;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    unsigned long long size = data->size();
+    if (rank_ == 0)
+    {
+        for (size_t i=0, s=sockets_.size(); i<s; i++)
+        {
+            send_all(sockets_[i], &size, sizeof(size));
+            if (size != 0)
+                send_all(sockets_[i], &(*data)[0], (size_t)size);
+        }
+    }
+    else
+    {
+        recv_all(sockets_[0], &size, sizeof(size));
+        data->resize((size_t)size);
+        if (size != 0)
+            recv_all(sockets_[0], &(*data)[0], (size_t)size);
+    }
+    seconds_ += seconds_since(begin);
+}
+
+void AllReducer::gather(const std::vector<char>& data, std::vector<std::vector<char> > * all)
+{
+    all->clear();
+    if (rank_ == 0)
+        all->push_back(data);
+    if (size_ == 1)
+        return;
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    if (rank_ == 0)
+    {
+        all->resize(size_);
+        for (size_t i=0, s=sockets_.size(); i<s; i++)
+        {
+            unsigned long long size;
+            std::vector<char>& _data = (*all)[i+1];
+            recv_all(sockets_[i], &size, sizeof(size));
+            _data.resize((size_t)size);
+            if (size != 0)
+                recv_all(sockets_[i], &_data[0], (size_t)size);
+        }
+    }
+    else
+    {
+        unsigned long long size = data.size();
+        send_all(sockets_[0], &size, sizeof(size));
+        if (size != 0)
+            send_all(sockets_[0], &data[0], (size_t)size);
+    }
+    seconds_ += seconds_since(begin);
+}
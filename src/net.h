@@ -0,0 +1,55 @@
+#ifndef GBDT_NET_H
+#define GBDT_NET_H
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// Collective communication of worker processes in distributed training.
+// Worker 0 listens on "host:port", the other workers connect to it.
+// Worker 0 sums data of all workers in the order of ranks and sends the sum back,
+// so all workers get the same result bit by bit.
+class AllReducer
+{
+private:
+    size_t rank_;
+    size_t size_;
+    // worker 0 has sockets to worker 1, 2, ..., the others have one socket to worker 0
+    std::vector<int> sockets_;
+    // bytes sent and received, and seconds spent, since the last 'reset_stat'
+    size_t bytes_;
+    double seconds_;
+
+    AllReducer(const AllReducer&);
+    AllReducer& operator=(const AllReducer&);
+
+    int listen_workers(const std::string& host, const std::string& port);
+    int connect_master(const std::string& host, const std::string& port);
+    void send_all(int fd, const void * data, size_t size);
+    void recv_all(int fd, void * data, size_t size);
+
+public:
+    AllReducer();
+    ~AllReducer();
+
+    // 'master' is "host:port" of worker 0, return -1 if failed
+    int init(size_t rank, size_t size, const std::string& master);
+
+    size_t rank() const {return rank_;}
+    size_t size() const {return size_;}
+    size_t bytes() const {return bytes_;}
+    double seconds() const {return seconds_;}
+    void reset_stat() {bytes_ = 0; seconds_ = 0.0;}
+
+    // sum 'data[0, n)' of all workers in place,
+    // the process exits if communication fails.
+    void sum(double * data, size_t n);
+    // send 'data' of worker 0 to all workers,
+    // the process exits if communication fails.
+    void broadcast(std::vector<char> * data);
+    // worker 0 gets 'data' of all workers in 'all' in the order of ranks,
+    // the process exits if communication fails.
+    void gather(const std::vector<char>& data, std::vector<std::vector<char> > * all);
+};
+
+#endif// GBDT_NET_H
@@ -1,63 +1,188 @@
 #include "node.h"
+#include "block.h"
+#include "net.h"
+#include "random.h"
+#include "thread.h"
 #include <assert.h>
+#include <math.h>
 #include <stdlib.h>
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <list>
+#include <queue>
 
-#if defined ENABLE_10000_RANDOM
-// If we want to get a deterministic sequence of random number,
-// turn on macro "ENABLE_10000_RANDOM".
-class Rand01
+// Whether samples are sampled at 'rate', decided in parallel by chunks of samples.
+// The jth sample is sampled by the jth 32-bit random number of the tree,
+// so samples do not depend on threads.
+struct SampleTask : public ThreadTask
 {
-private:
-    static float data_[10000];
-    const float rate_;
-    size_t i_;
+    // a multiple of 4, the number of 32-bit random numbers of a counter
+    static const size_t CHUNK_SIZE = 65536;
 
-public:
-    explicit Rand01(double rate)
-        : rate_((float)rate), i_(0) {}
+    const CounterRandom& random;
+    // a sample is sampled if its random number is less than it
+    const unsigned long long threshold;
+    std::vector<char>& sampled;
 
-    bool is_one()
+    SampleTask(const CounterRandom& _random, double rate, std::vector<char>& _sampled)
+        : random(_random), threshold((unsigned long long)(rate * 4294967296.0)), sampled(_sampled) {}
+
+    static size_t get_chunk_count(size_t n) {return (n + CHUNK_SIZE - 1) / CHUNK_SIZE;}
+
+    virtual void run(size_t i)
     {
-        i_ = (i_+1) % 10000;
-        return data_[i_] < rate_;
+        uint32_t numbers[4];
+        for (size_t j=i*CHUNK_SIZE, s=std::min(j+CHUNK_SIZE, sampled.size()); j<s; j++)
+        {
+            if ((j & 3) == 0)
+                random.get(j >> 2, numbers);
+            sampled[j] = numbers[j & 3] < threshold;
+        }
     }
 };
 
-float Rand01::data_[10000] = {
-#include "10000float.inl"
+#define X_LIES_LEFT(x, _split_x_value, _split_x_type) \
+    (_split_x_type)?((x.d()) <= (_split_x_value.d())):((x.i()) == (_split_x_value.i()))
+
+// Split values are candidates in histogram-based splitting, see 'build_x_bins',
+// so a x lies left if and only if its bin lies left.
+#define X_BIN_LIES_LEFT(bin, _split_x_bin, _split_x_type) \
+    (_split_x_type)?((bin) <= (_split_x_bin)):((bin) == (_split_x_bin))
+
+// Kernels over samples in splitting are specialized at compile time
+// by the type of the feature, 'Type' being NumericalX or CategoryX,
+// and by weights of samples, 'Weights' being SampleWeights or UnitWeights,
+// so they are chosen once per feature instead of testing them for every sample.
+struct NumericalX
+{
+    // bins or x values from the first one to a split value lie left
+    static const bool CUMULATIVE = true;
+    static bool lies_left(const CompoundValue& x, const CompoundValue& split_x_value)
+    {
+        return x.d() <= split_x_value.d();
+    }
+    static bool lies_left(XBin bin, XBin split_x_bin) {return bin <= split_x_bin;}
+    static bool equal(const CompoundValue& a, const CompoundValue& b) {return a.d() == b.d();}
 };
-#else
-class Rand01
+
+struct CategoryX
 {
-private:
-    const int threshold_1_;
-    unsigned seed_;
+    // only the bin or x value of a split value lies left
+    static const bool CUMULATIVE = false;
+    static bool lies_left(const CompoundValue& x, const CompoundValue& split_x_value)
+    {
+        return x.i() == split_x_value.i();
+    }
+    static bool lies_left(XBin bin, XBin split_x_bin) {return bin == split_x_bin;}
+    static bool equal(const CompoundValue& a, const CompoundValue& b) {return a.i() == b.i();}
+};
 
-public:
-    explicit Rand01(double rate_1)
-        : threshold_1_((int)(rate_1 * RAND_MAX)), seed_(0) {}
+// bin index of a split value, which is one of the candidates 'x_values'
+static XBin get_split_x_bin(
+    const CompoundValueVector& x_values,
+    const CompoundValue& x_value,
+    kXType x_type)
+{
+    CompoundValueVector::const_iterator it;
+    if (x_type == kXType_Numerical)
+        it = std::lower_bound(x_values.begin(), x_values.end(), x_value, CompoundValueDoubleLess());
+    else
+        it = std::lower_bound(x_values.begin(), x_values.end(), x_value, CompoundValueIntLess());
+    assert(it != x_values.end());
+    return (XBin)(it - x_values.begin());
+}
+
+// Weighted square loss of a split is
+// sum(w*r*r) - sum(w*r)^2/sum(w) on the left - sum(w*r)^2/sum(w) on the right.
+static double split_loss(
+    const HistBin& total,
+    double yy,
+    double y_left,
+    double n_left,
+    double * mean_left,
+    double * mean_right)
+{
+    double y_right = total.y - y_left;
+    double n_right = total.w - n_left;
+    *mean_left = (n_left < EPS) ? 0.0 : y_left / n_left;
+    *mean_right = (n_right < EPS) ? 0.0 : y_right / n_right;
+    return yy - *mean_left * y_left - *mean_right * y_right;
+}
+
+// status of sweeping samples of a node sorted by a feature,
+// every unique x value is a split candidate.
+struct SweepStatus
+{
+    // statistics of all samples of the node
+    HistBin total;
+    double yy;
+    // statistics of swept samples lying left
+    double y_left;
+    double n_left;
+    // x value of the last swept sample
+    CompoundValue last_x;
+    bool started;
+    // the best split by now
+    CompoundValue x_value;
+    double mean_left;
+    double mean_right;
+    double loss;
 
-    bool is_one()
+    void reset(const HistBin& _total, double _yy)
     {
-#if defined _WIN32
-        int i = rand();
-#else
-        int i = rand_r(&seed_);
-#endif
-        return i < threshold_1_;
+        total = _total;
+        yy = _yy;
+        y_left = 0.0;
+        n_left = 0.0;
+        started = false;
+        mean_left = 0.0;
+        mean_right = 0.0;
+        loss = std::numeric_limits<double>::max();
     }
-};
-#endif
 
-#define X_LIES_LEFT(x, _split_x_value, _split_x_type) \
-    (_split_x_type)?((x.d()) <= (_split_x_value.d())):((x.i()) == (_split_x_value.i()))
+    // samples with the same x value go together,
+    // the split is evaluated when x value changes.
+    template <class Type>
+    void sweep(const CompoundValue& x, double response, double weight)
+    {
+        if (started && !Type::equal(x, last_x))
+            finish<Type>();
+        y_left += response * weight;
+        n_left += weight;
+        last_x = x;
+        started = true;
+    }
+
+    template <class Type>
+    void finish()
+    {
+        if (!started)
+            return;
+
+        double _mean_left, _mean_right;
+        double _loss = split_loss(total, yy, y_left, n_left, &_mean_left, &_mean_right);
+        if (_loss < loss)
+        {
+            x_value = last_x;
+            mean_left = _mean_left;
+            mean_right = _mean_right;
+            loss = _loss;
+        }
+
+        if (!Type::CUMULATIVE)
+        {
+            // only x values equal to one value lie left
+            y_left = 0.0;
+            n_left = 0.0;
+        }
+    }
+};
 
 TreeNodeBase::TreeNodeBase(const TreeParam& param, size_t level)
     : param_(param), level_(level),
-    left_(0), right_(0),
-    total_loss_(0.0), loss_(0.0) {}
+    left_(0), right_(0), root_(this), begin_(0), end_(0), global_size_(0),
+    total_loss_(0.0), loss_(0.0), gain_(0.0), y_left_(0.0), y_right_(0.0), pool_(0), reducer_(0), buffers_(0), tree_index_(0) {}
 
 TreeNodeBase::~TreeNodeBase()
 {
@@ -70,66 +195,331 @@ TreeNodeBase::~TreeNodeBase()
 TreeNodeBase * TreeNodeBase::train(
     const XYSet& full_set,
     const TreeParam& param,
-    std::vector<double> * full_fx) const
+    ThreadPool * pool,
+    std::vector<double> * full_fx,
+    std::vector<double> * full_response,
+    size_t tree_index,
+    TreeBuffers * buffers) const
 {
     TreeNodeBase * root = clone(param, 0);
-    root->do_train(full_set, param, full_fx);
+    root->reducer_ = reducer_;
+    root->tree_index_ = tree_index;
+    root->do_train(full_set, param, pool, full_fx, full_response, buffers);
     return root;
 }
 
+bool TreeNodeBase::distributed() const
+{
+    return reducer() && reducer()->size() > 1;
+}
+
 double TreeNodeBase::predict(const CompoundValueVector& X) const
 {
     return __predict(this, X);
 }
 
+double TreeNodeBase::predict(const XY& xy) const
+{
+    // x columns are released when x bins are built
+    if (xy.has_x_bins())
+        return __predict_bins(this, xy);
+    return __predict(this, xy);
+}
+
+// whether all samples are used by every tree
+static bool samples_all(const TreeParam& param)
+{
+    return param.gbdt_sample_method != "goss" && param.gbdt_sample_rate >= 1.0;
+}
+
 void TreeNodeBase::do_train(
     const XYSet& full_set,
     const TreeParam& param,
-    std::vector<double> * full_fx)
+    ThreadPool * pool,
+    std::vector<double> * full_fx,
+    std::vector<double> * full_response,
+    TreeBuffers * buffers)
 {
     assert(full_set.size() == full_fx->size());
+    pool_ = pool;
+    buffers_ = buffers;
+    if (buffers_)
+        swap_buffers();
     leaf() = false;
-    sample_and_update_response(full_set, param, *full_fx);
+    sample_and_update_response(full_set, param, *full_fx, full_response);
     build_tree();
-    update_fx(full_set, full_fx);
+    if (full_response)
+    {
+        if (samples_all(param))
+            response_.swap(*full_response);
+        total_loss() = update_fx_response(full_set, true, full_fx, full_response);
+    }
+    else
+    {
+        update_fx(full_set, full_fx);
+    }
     clear_tree();
 }
 
 void TreeNodeBase::sample_and_update_response(
     const XYSet& full_set,
     const TreeParam& param,
-    const std::vector<double>& full_fx)
+    const std::vector<double>& full_fx,
+    std::vector<double> * full_response)
 {
     assert(is_root());
     XYSetRef& xy_set = set();
-    if (param.gbdt_sample_rate >= 1.0)
+    if (param.gbdt_sample_method == "goss")
+    {
+        sample_goss(full_set, param, full_fx, full_response);
+    }
+    else if (samples_all(param))
     {
         xy_set.load(full_set);
-        update_response(full_fx);
+        if (full_response)
+            response_.swap(*full_response);
+        else
+            update_response(full_fx);
     }
     else
     {
-        std::vector<double> sampled_fx;
-        // sample 'full_set' and 'full_fx' together
-        xy_set.spec() = &full_set.spec();
-        xy_set.x_values() = &full_set.x_values();
-        Rand01 r(param.gbdt_sample_rate);
+        // Sampled ones are indices of 'full_set',
+        // their pseudo responses are picked from 'full_response', or computed from 'full_fx' in place.
+        std::vector<char> sampled;
+        sample(full_set.size(), param.gbdt_sample_rate, &sampled);
+        xy_set.set() = &full_set;
         for (size_t i=0, s=full_set.size(); i<s; i++)
         {
-            if (r.is_one())
+            if (sampled[i])
             {
-                xy_set.add(full_set.get(i));
-                sampled_fx.push_back(full_fx[i]);
+                xy_set.add(i);
+                if (full_response)
+                    response_.push_back((*full_response)[i]);
             }
         }
-        update_response(sampled_fx);
+        if (!full_response)
+            update_response(full_fx);
     }
 
     assert(xy_set.get_x_type_size() != 0);
     assert(xy_set.size() != 0);
+    xy_set.find_unit_weights();
+
+    begin_ = 0;
+    end_ = xy_set.size();
+    global_size_ = end_;
+    if (distributed())
+    {
+        double n = (double)end_;
+        reducer()->sum(&n, 1);
+        global_size_ = (size_t)n;
+    }
+    indices_.resize(end_);
+    for (size_t i=0; i<end_; i++)
+        indices_[i] = i;
+    lies_left_.resize(end_);
+    buffer_.resize(end_);
+    sample_x(param);
+    if (param.tree_method == "exact")
+        build_sorted_indices(full_set);
+}
+
+void TreeNodeBase::sample_goss(
+    const XYSet& full_set,
+    const TreeParam& param,
+    const std::vector<double>& full_fx,
+    const std::vector<double> * full_response)
+{
+    XYSetRef& xy_set = set();
+    size_t n = full_set.size();
+    // pseudo responses of all samples decide which ones are sampled
+    std::vector<double> all_response;
+    if (full_response == 0)
+    {
+        xy_set.load(full_set);
+        update_response(full_fx);
+        all_response.swap(response_);
+        xy_set.reset();
+    }
+    const std::vector<double>& response = full_response ? *full_response : all_response;
+
+    // samples of the largest "goss_top_rate" absolute pseudo responses are all kept,
+    // those equal to the smallest of them are kept in order until there are enough
+    size_t top_size = std::min((size_t)(param.goss_top_rate * n), n);
+    std::vector<char> is_top(n, 0);
+    if (top_size != 0)
+    {
+        std::vector<double> abs_response(n);
+        for (size_t i=0; i<n; i++)
+            abs_response[i] = fabs(response[i]);
+        std::nth_element(abs_response.begin(), abs_response.begin() + (top_size - 1), abs_response.end(),
+            std::greater<double>());
+        double threshold = abs_response[top_size - 1];
+        size_t greater_size = 0;
+        for (size_t i=0; i<n; i++)
+        {
+            if (fabs(response[i]) > threshold)
+            {
+                is_top[i] = 1;
+                greater_size++;
+            }
+        }
+        for (size_t i=0; i<n && greater_size<top_size; i++)
+        {
+            if (fabs(response[i]) == threshold)
+            {
+                is_top[i] = 1;
+                greater_size++;
+            }
+        }
+    }
+
+    // The others are sampled as "goss_other_rate" of all samples,
+    // their weights are scaled up, so that sums of weighted responses stay unbiased.
+    double other_rate = param.goss_other_rate / (1.0 - param.goss_top_rate);
+    double other_scale = 1.0 / other_rate;
+    std::vector<char> sampled;
+    sample(n, other_rate, &sampled);
+    xy_set.set() = &full_set;
+    for (size_t i=0; i<n; i++)
+    {
+        if (is_top[i])
+            xy_set.add(i, 1.0);
+        else if (sampled[i])
+            xy_set.add(i, other_scale);
+        else
+            continue;
+        response_.push_back(response[i]);
+    }
+}
+
+void TreeNodeBase::sample(size_t n, double rate, std::vector<char> * sampled) const
+{
+    CounterRandom random(param().seed, tree_index_);
+    sampled->resize(n);
+    SampleTask task(random, rate, *sampled);
+    pool_->parallel_for(SampleTask::get_chunk_count(n), &task);
+}
+
+// Choose 'rate' of features 'x_indices' at random, at least one, in ascending order.
+// The ith feature is chosen by the 'first + i'th number of 'random',
+// those of the smallest numbers are chosen.
+static void sample_x_indices(
+    const CounterRandom& random,
+    unsigned long long first,
+    double rate,
+    const std::vector<size_t>& x_indices,
+    std::vector<size_t> * sampled)
+{
+    size_t n = x_indices.size();
+    size_t k = std::min(std::max((size_t)(rate * n + 0.5), (size_t)1), n);
+    if (k == n)
+    {
+        *sampled = x_indices;
+        return;
+    }
+
+    std::vector<std::pair<double, size_t> > numbers(n);
+    for (size_t i=0; i<n; i++)
+        numbers[i] = std::make_pair(random.uniform(first + x_indices[i]), x_indices[i]);
+    std::nth_element(numbers.begin(), numbers.begin() + k, numbers.end());
+    sampled->resize(k);
+    for (size_t i=0; i<k; i++)
+        (*sampled)[i] = numbers[i].second;
+    std::sort(sampled->begin(), sampled->end());
+}
+
+// Features are sampled by another stream of the tree than samples,
+// the ith feature of the tree is chosen by the ith number,
+// and that of level l by the '(l + 1) * x_size + i'th number.
+static CounterRandom get_x_random(const TreeParam& param, size_t tree_index)
+{
+    return CounterRandom(param.seed, ~(unsigned long long)tree_index);
+}
+
+void TreeNodeBase::sample_x(const TreeParam& param)
+{
+    size_t x_size = set_.get_x_type_size();
+    std::vector<size_t> all(x_size);
+    for (size_t i=0; i<x_size; i++)
+        all[i] = i;
+    sample_x_indices(get_x_random(param, tree_index_), 0, param.colsample_bytree, all, &x_indices_);
+    if (x_indices_.size() == x_size)
+        return;
+
+    // histograms and sorted indices of features not used are neither built nor partitioned
+    std::vector<char> x_used(x_size, 0);
+    for (size_t i=0, s=x_indices_.size(); i<s; i++)
+        x_used[x_indices_[i]] = 1;
+    set_.use_x(x_used);
+}
+
+const std::vector<size_t>& TreeNodeBase::get_x_indices(std::vector<size_t> * buffer) const
+{
+    // Features of a level are sampled from those of the tree when they are searched,
+    // so nodes of the same level search the same features.
+    const TreeParam& _param = param();
+    if (_param.colsample_bylevel >= 1.0)
+        return root_->x_indices_;
+    size_t first = (level_ + 1) * root_->set_.get_x_type_size();
+    sample_x_indices(get_x_random(_param, root_->tree_index_), first, _param.colsample_bylevel,
+        root_->x_indices_, buffer);
+    return *buffer;
+}
+
+void TreeNodeBase::swap_buffers()
+{
+    set_.swap(buffers_->set);
+    response_.swap(buffers_->response);
+    indices_.swap(buffers_->indices);
+    sorted_indices_.swap(buffers_->sorted_indices);
+    lies_left_.swap(buffers_->lies_left);
+    buffer_.swap(buffers_->buffer);
+    node_of_.swap(buffers_->node_of);
+}
+
+void TreeNodeBase::build_sorted_indices(const XYSet& full_set)
+{
+    // pick sampled ones from pre-sorted indices of 'full_set'
+    const XYSetRef& xy_set = set();
+    assert(full_set.sorted_indices().size() == xy_set.get_x_type_size());
+    const size_t npos = (size_t)-1;
+    std::vector<size_t> sampled_index(full_set.size(), npos);
+    for (size_t i=0, s=xy_set.size(); i<s; i++)
+        sampled_index[xy_set.get_index(i)] = i;
+
+    sorted_indices_.resize(xy_set.get_x_type_size());
+    for (size_t x_index=0, s=sorted_indices_.size(); x_index<s; x_index++)
+    {
+        const std::vector<size_t>& full_sorted_indices = full_set.get_sorted_indices(x_index);
+        std::vector<size_t>& _sorted_indices = sorted_indices_[x_index];
+        _sorted_indices.clear();
+        if (!xy_set.uses_x(x_index))
+            continue;
+        _sorted_indices.reserve(xy_set.size());
+        for (size_t i=0, t=full_sorted_indices.size(); i<t; i++)
+        {
+            size_t index = sampled_index[full_sorted_indices[i]];
+            if (index != npos)
+                _sorted_indices.push_back(index);
+        }
+        assert(_sorted_indices.size() == xy_set.size());
+    }
 }
 
 void TreeNodeBase::build_tree()
+{
+    if (param().tree_growth == "leafwise")
+        build_tree_leafwise();
+    else if (param().tree_growth == "levelwise")
+        build_tree_levelwise();
+    else if (pool()->size() > 1 && !distributed())
+        build_tree_parallel();
+    else
+        build_tree_depthfirst();
+}
+
+void TreeNodeBase::build_tree_depthfirst()
 {
     assert(is_root());
     const TreeParam& _param = param();
@@ -142,72 +532,797 @@ void TreeNodeBase::build_tree()
         TreeNodeBase * node = stack.back();
         stack.pop_back();
 
-        size_t level = node->level();
-        if (level >= _param.max_level
-            || leaf_size >= _param.max_leaf_number
-            || node->set().size() <= _param.min_values_in_leaf)
+        if (leaf_size >= _param.max_leaf_number || !node->can_split())
         {
-            node->leaf() = true;
-            node->update_predicted_y();
-            node->shrink();
+            node->make_leaf();
             leaf_size++;
             continue;
         }
 
+        node->find_split();
         node->split();
         stack.push_back(node->left());
         stack.push_back(node->right());
     }
 }
 
-void TreeNodeBase::split()
+// build subtrees of two children in parallel
+struct SubtreeTask : public ThreadTask
 {
-    const XYSetRef& xy_set = set();
-    assert(xy_set.size() != 0);
-    double y_left = 0.0;
-    double y_right = 0.0;
-    min_loss_on_all_features(&split_x_index(),
+    TreeNodeBase * nodes[2];
+    // number of leaf nodes, including nodes not built yet
+    std::atomic<size_t>& leaf_size;
+
+    SubtreeTask(TreeNodeBase * left, TreeNodeBase * right, std::atomic<size_t>& _leaf_size)
+        : leaf_size(_leaf_size)
+    {
+        nodes[0] = left;
+        nodes[1] = right;
+    }
+
+    // a split turns a leaf node into two, it is taken from the budget before it is done
+    static bool reserve_split(const TreeNodeBase * node, std::atomic<size_t>& leaf_size)
+    {
+        size_t max_leaf_number = node->param().max_leaf_number;
+        size_t n = leaf_size;
+        while (n < max_leaf_number)
+        {
+            if (leaf_size.compare_exchange_weak(n, n + 1))
+                return true;
+        }
+        return false;
+    }
+
+    static void build(TreeNodeBase * node, std::atomic<size_t>& leaf_size)
+    {
+        if (!node->can_split() || !reserve_split(node, leaf_size))
+        {
+            node->make_leaf();
+            return;
+        }
+
+        node->find_split();
+        node->split();
+        SubtreeTask task(node->left(), node->right(), leaf_size);
+        node->pool()->parallel_for(2, &task);
+    }
+
+    virtual void run(size_t i)
+    {
+        build(nodes[i], leaf_size);
+    }
+};
+
+void TreeNodeBase::build_tree_parallel()
+{
+    // Subtrees of two children are independent, they are built in parallel.
+    // Idle threads steal subtrees near the root first, which are the largest ones.
+    assert(is_root());
+    std::atomic<size_t> leaf_size(1);
+    SubtreeTask::build(this, leaf_size);
+}
+
+struct TreeNodeGainLess
+{
+    bool operator()(const TreeNodeBase * a, const TreeNodeBase * b) const
+    {
+        return a->gain() < b->gain();
+    }
+};
+
+void TreeNodeBase::build_tree_leafwise()
+{
+    // always split the leaf with the max loss drop
+    assert(is_root());
+    const TreeParam& _param = param();
+    std::priority_queue<TreeNodeBase *, std::vector<TreeNodeBase *>, TreeNodeGainLess> heap;
+    size_t leaf_size = 1;
+
+    if (can_split())
+    {
+        find_split();
+        heap.push(this);
+    }
+    else
+    {
+        make_leaf();
+    }
+
+    while (!heap.empty())
+    {
+        TreeNodeBase * node = heap.top();
+        heap.pop();
+
+        if (leaf_size >= _param.max_leaf_number || node->gain() <= 0.0)
+        {
+            node->make_leaf();
+            continue;
+        }
+
+        node->split();
+        leaf_size++;
+
+        TreeNodeBase * children[2] = {node->left(), node->right()};
+        for (size_t i=0; i<2; i++)
+        {
+            TreeNodeBase * child = children[i];
+            if (child->can_split())
+            {
+                child->find_split();
+                heap.push(child);
+            }
+            else
+            {
+                child->make_leaf();
+            }
+        }
+    }
+}
+
+struct TreeNodeGainGreater
+{
+    bool operator()(const TreeNodeBase * a, const TreeNodeBase * b) const
+    {
+        return a->gain() > b->gain();
+    }
+};
+
+void TreeNodeBase::build_tree_levelwise()
+{
+    // Nodes of a level find their best splits together,
+    // with one sequential pass over all samples instead of one pass per node.
+    // If leaf nodes are going to be too many,
+    // nodes whose best splits drop the loss more are split first.
+    assert(is_root());
+    const TreeParam& _param = param();
+    std::vector<TreeNodeBase *> nodes(1, this);
+    // nodes split in the last level
+    std::vector<TreeNodeBase *> parents;
+    size_t leaf_size = 1;
+
+    while (!nodes.empty())
+    {
+        std::vector<TreeNodeBase *> open_nodes;
+        for (size_t i=0, s=nodes.size(); i<s; i++)
+        {
+            if (nodes[i]->can_split())
+                open_nodes.push_back(nodes[i]);
+            else
+                nodes[i]->make_leaf();
+        }
+
+        if (param().tree_method == "hist")
+            find_splits_hist(parents, open_nodes);
+        else
+            find_splits_exact(open_nodes);
+
+        std::stable_sort(open_nodes.begin(), open_nodes.end(), TreeNodeGainGreater());
+        parents.clear();
+        nodes.clear();
+        for (size_t i=0, s=open_nodes.size(); i<s; i++)
+        {
+            TreeNodeBase * node = open_nodes[i];
+            if (leaf_size >= _param.max_leaf_number)
+            {
+                node->make_leaf();
+                continue;
+            }
+            leaf_size++;
+            parents.push_back(node);
+        }
+
+        if (set_.x_bin_file())
+            split_data_blocks(parents);
+        for (size_t i=0, s=parents.size(); i<s; i++)
+        {
+            TreeNodeBase * node = parents[i];
+            node->split();
+            nodes.push_back(node->left());
+            nodes.push_back(node->right());
+        }
+    }
+}
+
+void TreeNodeBase::find_splits_hist(
+    const std::vector<TreeNodeBase *>& parents,
+    const std::vector<TreeNodeBase *>& nodes)
+{
+    // Only the root and smaller children that need histograms are built from samples,
+    // histograms of larger children are built by subtraction.
+    assert(is_root());
+    const size_t npos = (size_t)-1;
+    std::vector<Histogram *> hists;
+    node_of_.assign(set_.size(), npos);
+    if (parents.empty())
+    {
+        for (size_t i=0, s=nodes.size(); i<s; i++)
+        {
+            TreeNodeBase * node = nodes[i];
+            for (size_t j=node->begin_; j<node->end_; j++)
+                node_of_[indices_[j]] = hists.size();
+            hists.push_back(&node->hist_);
+        }
+    }
+
+    for (size_t i=0, s=parents.size(); i<s; i++)
+    {
+        TreeNodeBase * smaller = parents[i]->left();
+        TreeNodeBase * larger = parents[i]->right();
+        if (smaller->global_size() > larger->global_size())
+            std::swap(smaller, larger);
+        if (smaller->can_split() || larger->can_split())
+        {
+            for (size_t j=smaller->begin_; j<smaller->end_; j++)
+                node_of_[indices_[j]] = hists.size();
+            hists.push_back(&smaller->hist_);
+        }
+    }
+
+    Histogram::build(set_, node_of_, response_, hists, pool_);
+    if (distributed())
+        Histogram::allreduce(hists, reducer_);
+
+    for (size_t i=0, s=parents.size(); i<s; i++)
+    {
+        TreeNodeBase * parent = parents[i];
+        TreeNodeBase * smaller = parent->left();
+        TreeNodeBase * larger = parent->right();
+        if (smaller->global_size() > larger->global_size())
+            std::swap(smaller, larger);
+        if (larger->can_split())
+            larger->hist_.subtract(parent->hist_, smaller->hist_);
+        if (!smaller->can_split())
+            smaller->hist_.clear();
+        parent->hist_.clear();
+    }
+
+    for (size_t i=0, s=nodes.size(); i<s; i++)
+        nodes[i]->find_split();
+}
+
+// sweep samples 'sorted[0, n)' of 'xy_set' of a node sorted by a feature of x values 'x_column'
+template <class Type, class Weights>
+static void sweep_sorted(
+    const XYSetRef& xy_set,
+    const std::vector<double>& response,
+    const CompoundValueVector& x_column,
+    const size_t * sorted,
+    size_t n,
+    SweepStatus * status)
+{
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = sorted[i];
+        status->sweep<Type>(x_column[xy_set.get_index(index)], response[index], Weights::get(xy_set, index));
+    }
+    status->finish<Type>();
+}
+
+static void sweep_sorted(
+    const XYSetRef& xy_set,
+    const std::vector<double>& response,
+    const CompoundValueVector& x_column,
+    kXType x_type,
+    const size_t * sorted,
+    size_t n,
+    SweepStatus * status)
+{
+    bool numerical = x_type == kXType_Numerical;
+    if (numerical && xy_set.unit_weights())
+        sweep_sorted<NumericalX, UnitWeights>(xy_set, response, x_column, sorted, n, status);
+    else if (numerical)
+        sweep_sorted<NumericalX, SampleWeights>(xy_set, response, x_column, sorted, n, status);
+    else if (xy_set.unit_weights())
+        sweep_sorted<CategoryX, UnitWeights>(xy_set, response, x_column, sorted, n, status);
+    else
+        sweep_sorted<CategoryX, SampleWeights>(xy_set, response, x_column, sorted, n, status);
+}
+
+// sweep samples 'sorted[0, n)' of 'xy_set' of all nodes of a level sorted by a feature,
+// the ith sample lies in node 'node_of[i]' of status 'status[node_of[i]]', or in none if it is -1
+template <class Type, class Weights>
+static void sweep_sorted(
+    const XYSetRef& xy_set,
+    const std::vector<double>& response,
+    const CompoundValueVector& x_column,
+    const size_t * sorted,
+    size_t n,
+    const std::vector<size_t>& node_of,
+    std::vector<SweepStatus>& status)
+{
+    const size_t npos = (size_t)-1;
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = sorted[i];
+        size_t k = node_of[index];
+        if (k == npos)
+            continue;
+        status[k].sweep<Type>(x_column[xy_set.get_index(index)], response[index], Weights::get(xy_set, index));
+    }
+    for (size_t k=0, s=status.size(); k<s; k++)
+        status[k].finish<Type>();
+}
+
+static void sweep_sorted(
+    const XYSetRef& xy_set,
+    const std::vector<double>& response,
+    const CompoundValueVector& x_column,
+    kXType x_type,
+    const size_t * sorted,
+    size_t n,
+    const std::vector<size_t>& node_of,
+    std::vector<SweepStatus>& status)
+{
+    bool numerical = x_type == kXType_Numerical;
+    if (numerical && xy_set.unit_weights())
+        sweep_sorted<NumericalX, UnitWeights>(xy_set, response, x_column, sorted, n, node_of, status);
+    else if (numerical)
+        sweep_sorted<NumericalX, SampleWeights>(xy_set, response, x_column, sorted, n, node_of, status);
+    else if (xy_set.unit_weights())
+        sweep_sorted<CategoryX, UnitWeights>(xy_set, response, x_column, sorted, n, node_of, status);
+    else
+        sweep_sorted<CategoryX, SampleWeights>(xy_set, response, x_column, sorted, n, node_of, status);
+}
+
+// sweep samples of all nodes of a level sorted by a feature
+struct LevelSweepTask : public ThreadTask
+{
+    const TreeNodeBase * root;
+    size_t node_size;
+    const std::vector<HistBin>& totals;
+    const std::vector<double>& yys;
+    // features swept
+    const std::vector<size_t>& x_indices;
+    // status[i][k] is the status of the kth node on the ith feature swept
+    std::vector<std::vector<SweepStatus> >& status;
+
+    LevelSweepTask(
+        const TreeNodeBase * _root,
+        size_t _node_size,
+        const std::vector<HistBin>& _totals,
+        const std::vector<double>& _yys,
+        const std::vector<size_t>& _x_indices,
+        std::vector<std::vector<SweepStatus> >& _status)
+        : root(_root), node_size(_node_size), totals(_totals), yys(_yys), x_indices(_x_indices), status(_status) {}
+
+    virtual void run(size_t i)
+    {
+        const XYSetRef& xy_set = root->set_;
+        size_t x_index = x_indices[i];
+        std::vector<SweepStatus>& _status = status[i];
+        for (size_t k=0; k<node_size; k++)
+            _status[k].reset(totals[k], yys[k]);
+
+        const std::vector<size_t>& sorted = root->sorted_indices_[x_index];
+        sweep_sorted(xy_set, root->response_, xy_set.get_x_column(x_index), xy_set.get_x_type(x_index),
+            sorted.empty() ? 0 : &sorted[0], sorted.size(), root->node_of_, _status);
+    }
+};
+
+void TreeNodeBase::find_splits_exact(const std::vector<TreeNodeBase *>& nodes)
+{
+    // Sweep all samples sorted by a feature once for all nodes,
+    // a node sees its own samples in the same order as in its own sorted indices.
+    assert(is_root());
+    const size_t npos = (size_t)-1;
+    size_t node_size = nodes.size();
+    node_of_.assign(set_.size(), npos);
+    for (size_t k=0; k<node_size; k++)
+    {
+        TreeNodeBase * node = nodes[k];
+        for (size_t j=node->begin_; j<node->end_; j++)
+            node_of_[indices_[j]] = k;
+        node->loss() = std::numeric_limits<double>::max();
+    }
+
+    std::vector<HistBin> totals(node_size);
+    std::vector<double> yys(node_size, 0.0);
+    for (size_t i=0, s=set_.size(); i<s; i++)
+    {
+        size_t k = node_of_[i];
+        if (k == npos)
+            continue;
+        double weight = set_.get_weight(i);
+        double response = response_[i];
+        totals[k].y += response * weight;
+        totals[k].w += weight;
+        totals[k].n++;
+        yys[k] += response * response * weight;
+    }
+
+    // features are swept in parallel, the best splits are reduced in feature order,
+    // nodes of a level search the same features
+    std::vector<size_t> buffer;
+    const std::vector<size_t>& x_indices = nodes.empty() ? x_indices_ : nodes[0]->get_x_indices(&buffer);
+    size_t x_size = x_indices.size();
+    std::vector<std::vector<SweepStatus> > status(x_size, std::vector<SweepStatus>(node_size));
+    LevelSweepTask task(this, node_size, totals, yys, x_indices, status);
+    pool_->parallel_for(x_size, &task);
+
+    for (size_t i=0; i<x_size; i++)
+    {
+        size_t x_index = x_indices[i];
+        kXType x_type = set_.get_x_type(x_index);
+        for (size_t k=0; k<node_size; k++)
+        {
+            const SweepStatus& _status = status[i][k];
+            TreeNodeBase * node = nodes[k];
+            if (_status.loss < node->loss())
+            {
+                node->split_x_index() = x_index;
+                node->split_x_type() = x_type;
+                node->split_x_value() = _status.x_value;
+                node->y_left_ = _status.mean_left;
+                node->y_right_ = _status.mean_right;
+                node->loss() = _status.loss;
+            }
+        }
+    }
+
+    for (size_t k=0; k<node_size; k++)
+    {
+        TreeNodeBase * node = nodes[k];
+        double mean = (totals[k].w < EPS) ? 0.0 : totals[k].y / totals[k].w;
+        node->gain_ = (yys[k] - mean * totals[k].y) - node->loss();
+    }
+}
+
+bool TreeNodeBase::can_split() const
+{
+    const TreeParam& _param = param();
+    return level() < _param.max_level && global_size() > _param.min_values_in_leaf;
+}
+
+void TreeNodeBase::make_leaf()
+{
+    leaf() = true;
+    update_predicted_y();
+    shrink();
+    hist_.clear();
+}
+
+void TreeNodeBase::find_split()
+{
+    assert(global_size() != 0);
+    if (param().tree_method == "hist" && hist_.empty())
+    {
+        assert(is_root());
+        hist_.build(set_, &indices_[0], size(), response_, pool_);
+        if (distributed())
+            hist_.allreduce(reducer_);
+    }
+
+    HistBin total;
+    double yy;
+    get_total(&total, &yy);
+    min_loss_on_all_features(total, yy,
+        &split_x_index(),
         &split_x_type(),
         &split_x_value(),
-        &y_left,
-        &y_right,
+        &y_left_,
+        &y_right_,
         &loss());
 
+    double mean = (total.w < EPS) ? 0.0 : total.y / total.w;
+    gain_ = (yy - mean * total.y) - loss();
+}
+
+void TreeNodeBase::split()
+{
     TreeNodeBase * _left = fork();
     TreeNodeBase * _right = fork();
     left() = _left;
     right() = _right;
-    _left->y() = y_left;
-    _right->y() = y_right;
+    _left->y() = y_left_;
+    _right->y() = y_right_;
     split_data(_left, _right);
+    // histograms of children are built level by level for level-wise growth
+    if (param().tree_method == "hist" && param().tree_growth != "levelwise")
+        split_hist(_left, _right);
 }
 
 TreeNodeBase * TreeNodeBase::fork() const
 {
-    const XYSetRef& xy_set = set();
     TreeNodeBase * child = clone(param(), level() + 1);
-    child->set().spec() = xy_set.spec();
-    child->set().x_values() = xy_set.x_values();
+    child->root_ = root_;
     child->leaf() = false;
     return child;
 }
 
-void TreeNodeBase::split_data(TreeNodeBase * _left, TreeNodeBase * _right) const
+// Decide which side samples 'indices[0, n)' of 'xy_set' lie in, by their x values 'x_column' of a feature,
+// set 'lies_left[indices[i]]', and return the number of those lying left.
+template <class Type>
+static size_t lie_left(
+    const XYSetRef& xy_set,
+    const CompoundValueVector& x_column,
+    const CompoundValue& split_x_value,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
 {
-    const XYSetRef& xy_set = set();
+    size_t n_left = 0;
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = indices[i];
+        bool left = Type::lies_left(x_column[xy_set.get_index(index)], split_x_value);
+        lies_left[index] = left;
+        n_left += left;
+    }
+    return n_left;
+}
+
+static size_t lie_left(
+    const XYSetRef& xy_set,
+    const CompoundValueVector& x_column,
+    const CompoundValue& split_x_value,
+    kXType split_x_type,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
+{
+    if (split_x_type == kXType_Numerical)
+        return lie_left<NumericalX>(xy_set, x_column, split_x_value, indices, n, lies_left);
+    else
+        return lie_left<CategoryX>(xy_set, x_column, split_x_value, indices, n, lies_left);
+}
+
+// by bin indices 'x_bins' of a feature, 'Reader' reads them
+template <class Reader, class Type>
+static size_t lie_left(
+    const XYSetRef& xy_set,
+    const unsigned char * x_bins,
+    XBin split_x_bin,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
+{
+    size_t n_left = 0;
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = indices[i];
+        bool left = Type::lies_left(Reader::get(x_bins, xy_set.get_index(index)), split_x_bin);
+        lies_left[index] = left;
+        n_left += left;
+    }
+    return n_left;
+}
+
+template <class Type>
+static size_t lie_left(
+    const XYSetRef& xy_set,
+    const XBinColumn& x_bins,
+    XBin split_x_bin,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
+{
+    if (x_bins.width() == 4)
+        return lie_left<XBinReader<4>, Type>(xy_set, x_bins.data(), split_x_bin, indices, n, lies_left);
+    else if (x_bins.width() == 8)
+        return lie_left<XBinReader<8>, Type>(xy_set, x_bins.data(), split_x_bin, indices, n, lies_left);
+    else
+        return lie_left<XBinReader<16>, Type>(xy_set, x_bins.data(), split_x_bin, indices, n, lies_left);
+}
+
+static size_t lie_left(
+    const XYSetRef& xy_set,
+    const XBinColumn& x_bins,
+    XBin split_x_bin,
+    kXType split_x_type,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
+{
+    if (split_x_type == kXType_Numerical)
+        return lie_left<NumericalX>(xy_set, x_bins, split_x_bin, indices, n, lies_left);
+    else
+        return lie_left<CategoryX>(xy_set, x_bins, split_x_bin, indices, n, lies_left);
+}
+
+// by bin indices of the 'x_index'th feature of sparse samples
+template <class Type>
+static size_t lie_left_sparse(
+    const XYSetRef& xy_set,
+    size_t x_index,
+    XBin split_x_bin,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
+{
+    const XYSet& full_set = *xy_set.set();
+    size_t n_left = 0;
+    for (size_t i=0; i<n; i++)
+    {
+        size_t index = indices[i];
+        bool left = Type::lies_left(full_set.get_x_bin(xy_set.get_index(index), x_index), split_x_bin);
+        lies_left[index] = left;
+        n_left += left;
+    }
+    return n_left;
+}
+
+static size_t lie_left_sparse(
+    const XYSetRef& xy_set,
+    size_t x_index,
+    XBin split_x_bin,
+    kXType split_x_type,
+    const size_t * indices,
+    size_t n,
+    char * lies_left)
+{
+    if (split_x_type == kXType_Numerical)
+        return lie_left_sparse<NumericalX>(xy_set, x_index, split_x_bin, indices, n, lies_left);
+    else
+        return lie_left_sparse<CategoryX>(xy_set, x_index, split_x_bin, indices, n, lies_left);
+}
+
+void TreeNodeBase::split_data(TreeNodeBase * _left, TreeNodeBase * _right)
+{
+    TreeNodeBase * _root = root_;
+    const XYSetRef& xy_set = _root->set_;
     size_t _split_x_index = split_x_index();
     const CompoundValue& _split_x_value = split_x_value();
-    for (size_t i=0, s=xy_set.size(); i<s; i++)
+    kXType _split_x_type = split_x_type();
+    size_t n_left = 0;
+    if (xy_set.x_bin_file())
     {
-        const XY& xy = xy_set.get(i);
-        const CompoundValue& x = xy.x(_split_x_index);
-        if (X_LIES_LEFT(x, _split_x_value, split_x_type()))
-            _left->add_data(xy, this, i);
+        // samples of nodes of a level are decided together by 'split_data_blocks'
+        for (size_t i=0, s=size(); i<s; i++)
+            n_left += _root->lies_left_[get_index(i)];
+    }
+    else if (xy_set.has_x_bins())
+    {
+        split_x_bin_ = get_split_x_bin(xy_set.get_x_values(_split_x_index), _split_x_value, _split_x_type);
+        XBin _split_x_bin = split_x_bin_;
+        // x bins of sparse samples are stored sample by sample or in bundles
+        if (xy_set.is_sparse())
+            n_left = lie_left_sparse(xy_set, _split_x_index, _split_x_bin, _split_x_type,
+                &_root->indices_[begin_], size(), &_root->lies_left_[0]);
         else
-            _right->add_data(xy, this, i);
+            n_left = lie_left(xy_set, xy_set.get_x_bins(_split_x_index), _split_x_bin, _split_x_type,
+                &_root->indices_[begin_], size(), &_root->lies_left_[0]);
+    }
+    else
+    {
+        n_left = lie_left(xy_set, xy_set.get_x_column(_split_x_index), _split_x_value, _split_x_type,
+            &_root->indices_[begin_], size(), &_root->lies_left_[0]);
+    }
+
+    partition(&_root->indices_[0], n_left);
+    // sorted indices are swept as a whole for level-wise growth
+    if (param().tree_growth != "levelwise")
+    {
+        for (size_t x_index=0, s=_root->sorted_indices_.size(); x_index<s; x_index++)
+            if (xy_set.uses_x(x_index))
+                partition(&_root->sorted_indices_[x_index][0], n_left);
+    }
+
+    _left->begin_ = begin_;
+    _left->end_ = begin_ + n_left;
+    _right->begin_ = begin_ + n_left;
+    _right->end_ = end_;
+    assert(size() == _left->size() + _right->size());
+
+    _left->global_size_ = _left->size();
+    _right->global_size_ = _right->size();
+    if (distributed())
+    {
+        double n[2] = {(double)_left->size(), (double)_right->size()};
+        reducer()->sum(n, 2);
+        _left->global_size_ = (size_t)n[0];
+        _right->global_size_ = (size_t)n[1];
+    }
+}
+
+// decide which side samples in a block lie in, the ith part is a range of the samples
+struct LiesLeftBlockTask : public ThreadTask
+{
+    TreeNodeBase * root;
+    const std::vector<TreeNodeBase *>& nodes;
+    const XBinBlock& block;
+    // samples [begin, end) of root's 'set_' are in the block
+    size_t begin;
+    size_t end;
+    size_t part_size;
+
+    LiesLeftBlockTask(
+        TreeNodeBase * _root,
+        const std::vector<TreeNodeBase *>& _nodes,
+        const XBinBlock& _block,
+        size_t _begin,
+        size_t _end,
+        size_t _part_size)
+        : root(_root), nodes(_nodes), block(_block), begin(_begin), end(_end), part_size(_part_size) {}
+
+    virtual void run(size_t p)
+    {
+        const size_t npos = (size_t)-1;
+        const XYSetRef& xy_set = root->set_;
+        const std::vector<size_t>& node_of = root->node_of_;
+        std::vector<char>& lies_left = root->lies_left_;
+        size_t n = end - begin;
+        for (size_t i=begin+n*p/part_size, s=begin+n*(p+1)/part_size; i<s; i++)
+        {
+            size_t k = node_of[i];
+            if (k == npos)
+                continue;
+            const TreeNodeBase * node = nodes[k];
+            XBin bin = block.get(node->split_x_index(), xy_set.get_index(i));
+            lies_left[i] = X_BIN_LIES_LEFT(bin, node->split_x_bin_, node->split_x_type());
+        }
+    }
+};
+
+void TreeNodeBase::split_data_blocks(const std::vector<TreeNodeBase *>& nodes)
+{
+    // Samples of all nodes to split in a level are decided in one pass over blocks of x bins,
+    // instead of reading bins of a feature of a node randomly.
+    assert(is_root());
+    const size_t npos = (size_t)-1;
+    node_of_.assign(set_.size(), npos);
+    for (size_t k=0, s=nodes.size(); k<s; k++)
+    {
+        TreeNodeBase * node = nodes[k];
+        node->split_x_bin_ = get_split_x_bin(set_.get_x_values(node->split_x_index()),
+            node->split_x_value(), node->split_x_type());
+        for (size_t j=node->begin_; j<node->end_; j++)
+            node_of_[indices_[j]] = k;
     }
 
-    assert(xy_set.size() == _left->set().size() + _right->set().size());
+    XBinBlockReader reader(*set_.x_bin_file());
+    for (const XBinBlock * block; (block = reader.next()) != 0;)
+    {
+        size_t begin = set_.lower_bound(block->begin());
+        size_t end = set_.lower_bound(block->end());
+        LiesLeftBlockTask task(this, nodes, *block, begin, end, pool_->size());
+        pool_->parallel_for(pool_->size(), &task);
+    }
+}
+
+void TreeNodeBase::partition(size_t * indices, size_t n_left)
+{
+    // stable in-place partition of 'indices[begin_, end_)',
+    // samples lying left go first,
+    // 'buffer_[begin_, end_)' is used, so disjoint nodes can be partitioned in parallel.
+    const std::vector<char>& lies_left = root_->lies_left_;
+    size_t * right = &root_->buffer_[0] + begin_;
+    size_t * left = indices + begin_;
+    for (size_t i=begin_; i<end_; i++)
+    {
+        size_t index = indices[i];
+        if (lies_left[index])
+            *left++ = index;
+        else
+            *right++ = index;
+    }
+    assert(left == indices + begin_ + n_left);
+    std::copy(&root_->buffer_[0] + begin_, right, left);
+}
+
+void TreeNodeBase::split_hist(TreeNodeBase * _left, TreeNodeBase * _right)
+{
+    // Children that will surely be leaves need no histograms.
+    // Histograms of the larger child are built by subtraction,
+    // only the smaller child is built from its samples.
+    TreeNodeBase * smaller = _left;
+    TreeNodeBase * larger = _right;
+    if (smaller->global_size() > larger->global_size())
+        std::swap(smaller, larger);
+
+    bool smaller_can_split = smaller->can_split();
+    bool larger_can_split = larger->can_split();
+
+    if (smaller_can_split || larger_can_split)
+    {
+        smaller->hist_.build(root_->set_, &root_->indices_[0] + smaller->begin_, smaller->size(), root_->response_, pool());
+        if (distributed())
+            smaller->hist_.allreduce(reducer());
+    }
+    if (larger_can_split)
+        larger->hist_.subtract(hist_, smaller->hist_);
+    if (!smaller_can_split)
+        smaller->hist_.clear();
+    hist_.clear();
 }
 
 void TreeNodeBase::shrink()
@@ -217,18 +1332,76 @@ void TreeNodeBase::shrink()
     y() = y() * param().learning_rate;
 }
 
+void TreeNodeBase::get_leaves(const TreeNodeBase * node, std::vector<const TreeNodeBase *> * leaves)
+{
+    if (node->is_leaf())
+    {
+        leaves->push_back(node);
+        return;
+    }
+    get_leaves(node->left(), leaves);
+    get_leaves(node->right(), leaves);
+}
+
 void TreeNodeBase::update_fx(const XYSet& full_set, std::vector<double> * full_fx) const
 {
+    // Sampled training samples lying in a leaf node are known by its range of 'indices_',
+    // only samples not sampled are predicted by walking down the tree.
     assert(is_root());
-    for (size_t i=0, s=full_set.size(); i<s; i++)
+    std::vector<const TreeNodeBase *> leaves;
+    get_leaves(this, &leaves);
+
+    bool all_sampled = set_.size() == full_set.size();
+    std::vector<char> sampled;
+    if (!all_sampled)
+        sampled.resize(full_set.size(), 0);
+
+    for (size_t k=0, s=leaves.size(); k<s; k++)
     {
-        const XY& xy = full_set.get(i);
-        (*full_fx)[i] += predict(xy.X());
+        const TreeNodeBase * leaf = leaves[k];
+        double _y = leaf->y();
+        for (size_t i=0, t=leaf->size(); i<t; i++)
+        {
+            size_t index = set_.get_index(leaf->get_index(i));
+            (*full_fx)[index] += _y;
+            if (!all_sampled)
+                sampled[index] = 1;
+        }
+    }
+
+    if (!all_sampled)
+        add_unsampled_fx(full_set, sampled, full_fx);
+}
+
+void TreeNodeBase::add_unsampled_fx(
+    const XYSet& full_set,
+    const std::vector<char>& sampled,
+    std::vector<double> * full_fx) const
+{
+    if (full_set.x_bin_file() == 0)
+    {
+        for (size_t i=0, s=full_set.size(); i<s; i++)
+        {
+            if (!sampled[i])
+                (*full_fx)[i] += predict(full_set.get(i));
+        }
+        return;
+    }
+
+    XBinBlockReader reader(*full_set.x_bin_file());
+    for (const XBinBlock * block; (block = reader.next()) != 0;)
+    {
+        for (size_t i=block->begin(), s=block->end(); i<s; i++)
+        {
+            if (!sampled[i])
+                (*full_fx)[i] += __predict_bins(this, XBinBlockRow(*block, i));
+        }
     }
 }
 
 void TreeNodeBase::clear_tree()
 {
+    hist_.clear();
     clear();
     if (left())
         left()->clear_tree();
@@ -236,7 +1409,74 @@ void TreeNodeBase::clear_tree()
         right()->clear_tree();
 }
 
+void TreeNodeBase::get_total(HistBin * total, double * yy) const
+{
+    if (!hist_.empty())
+    {
+        *total = hist_.total();
+        *yy = hist_.yy();
+        return;
+    }
+
+    *total = HistBin();
+    *yy = 0.0;
+    for (size_t i=0, s=size(); i<s; i++)
+    {
+        double weight = get_weight(i);
+        double response = get_response(i);
+        total->y += response * weight;
+        total->w += weight;
+        *yy += response * response * weight;
+    }
+    total->n = size();
+}
+
+// the best split of a node on one feature
+struct FeatureSplit
+{
+    CompoundValue x_value;
+    double y_left;
+    double y_right;
+    double loss;
+};
+
+// find the best splits of a node on features
+struct FeatureSplitTask : public ThreadTask
+{
+    const TreeNodeBase * node;
+    const HistBin& total;
+    double yy;
+    // splits[i] is the best split on feature 'x_indices[i]'
+    const std::vector<size_t>& x_indices;
+    std::vector<FeatureSplit>& splits;
+
+    FeatureSplitTask(
+        const TreeNodeBase * _node,
+        const HistBin& _total,
+        double _yy,
+        const std::vector<size_t>& _x_indices,
+        std::vector<FeatureSplit>& _splits)
+        : node(_node), total(_total), yy(_yy), x_indices(_x_indices), splits(_splits) {}
+
+    virtual void run(size_t i)
+    {
+        size_t x_index = x_indices[i];
+        kXType x_type = node->root_->set_.get_x_type(x_index);
+        FeatureSplit& split = splits[i];
+        split.y_left = 0.0;
+        split.y_right = 0.0;
+        if (node->param().tree_method == "hist")
+            node->min_loss_on_one_feature_hist(x_index, x_type, total, yy,
+                &split.x_value, &split.y_left, &split.y_right, &split.loss);
+        else
+            node->min_loss_on_one_feature(x_index, x_type, total, yy,
+                &split.x_value, &split.y_left, &split.y_right, &split.loss);
+    }
+};
+
 void TreeNodeBase::min_loss_on_all_features(
+    const HistBin& total,
+    double yy,
     size_t * _split_x_index,
     kXType * _split_x_type,
     CompoundValue * _split_x_value,
@@ -244,24 +1484,30 @@ void TreeNodeBase::min_loss_on_all_features(
     double * _y_right,
     double * min_loss) const
 {
-    const XYSetRef& xy_set = set();
+    // Features are searched in parallel.
+    // The best splits are reduced in feature order,
+    // so a tie goes to the lowest feature index whatever the number of threads is.
+    const XYSetRef& xy_set = root_->set_;
+    std::vector<size_t> buffer;
+    const std::vector<size_t>& x_indices = get_x_indices(&buffer);
+    size_t x_size = x_indices.size();
+    std::vector<FeatureSplit> splits(x_size);
+    FeatureSplitTask task(this, total, yy, x_indices, splits);
+    pool()->parallel_for(x_size, &task);
+
     *min_loss = std::numeric_limits<double>::max();
-    for (size_t x_index=0, s=xy_set.get_x_type_size(); x_index<s; x_index++)
-    {
-        kXType x_type = xy_set.get_x_type(x_index);
-        CompoundValue x_value;
-        double y_left = 0.0;
-        double y_right = 0.0;
-        double loss;
-        min_loss_on_one_feature(x_index, x_type, &x_value, &y_left, &y_right, &loss);
-        if (loss < *min_loss)
+    for (size_t i=0; i<x_size; i++)
+    {
+        const FeatureSplit& split = splits[i];
+        size_t x_index = x_indices[i];
+        if (split.loss < *min_loss)
         {
             *_split_x_index = x_index;
-            *_split_x_type = x_type;
-            *_split_x_value = x_value;
-            *_y_left = y_left;
-            *_y_right = y_right;
-            *min_loss = loss;
+            *_split_x_type = xy_set.get_x_type(x_index);
+            *_split_x_value = split.x_value;
+            *_y_left = split.y_left;
+            *_y_right = split.y_right;
+            *min_loss = split.loss;
         }
     }
 }
@@ -269,113 +1515,126 @@ void TreeNodeBase::min_loss_on_all_features(
 void TreeNodeBase::min_loss_on_one_feature(
     size_t _split_x_index,
     kXType _split_x_type,
+    const HistBin& total,
+    double yy,
     CompoundValue * _split_x_value,
     double * _y_left,
     double * _y_right,
     double * min_loss) const
 {
-    const CompoundValueVector& unique_x_values = set().get_x_values(_split_x_index);
+    // sweep samples of this node sorted by the feature
+    const XYSetRef& xy_set = root_->set_;
+    const size_t * sorted = &root_->sorted_indices_[_split_x_index][begin_];
+    SweepStatus status;
+    status.reset(total, yy);
+    sweep_sorted(xy_set, root_->response_, xy_set.get_x_column(_split_x_index), _split_x_type,
+        sorted, size(), &status);
+
+    *_split_x_value = status.x_value;
+    *_y_left = status.mean_left;
+    *_y_right = status.mean_right;
+    *min_loss = status.loss;
+}
+
+// the best split on bins of a feature of split candidates 'unique_x_values'
+template <class Type>
+static void min_loss_on_bins(
+    const CompoundValueVector& unique_x_values,
+    const HistBin * bins,
+    const HistBin& total,
+    double yy,
+    CompoundValue * _split_x_value,
+    double * _y_left,
+    double * _y_right,
+    double * min_loss)
+{
+    double y_left = 0.0;
+    double n_left = 0.0;
     *min_loss = std::numeric_limits<double>::max();
+    // the last bin holds x values greater than(or not in) all candidates
     for (size_t i=0, s=unique_x_values.size(); i<s; i++)
     {
-        const CompoundValue& x_value = unique_x_values[i];
-        double y_left;
-        double y_right;
-        double loss;
-        loss_x(_split_x_index, _split_x_type, x_value, &y_left, &y_right, &loss);
+        if (Type::CUMULATIVE)
+        {
+            // bins from 0 to i lie left
+            y_left += bins[i].y;
+            n_left += bins[i].w;
+        }
+        else
+        {
+            // only bin i lies left
+            y_left = bins[i].y;
+            n_left = bins[i].w;
+        }
+
+        double mean_left, mean_right;
+        double loss = split_loss(total, yy, y_left, n_left, &mean_left, &mean_right);
         if (loss < *min_loss)
         {
-            *_split_x_value = x_value;
-            *_y_left = y_left;
-            *_y_right = y_right;
+            *_split_x_value = unique_x_values[i];
+            *_y_left = mean_left;
+            *_y_right = mean_right;
             *min_loss = loss;
         }
     }
 }
 
-void TreeNodeBase::loss_x(
+void TreeNodeBase::min_loss_on_one_feature_hist(
     size_t _split_x_index,
     kXType _split_x_type,
-    const CompoundValue& _split_x_value,
+    const HistBin& total,
+    double yy,
+    CompoundValue * _split_x_value,
     double * _y_left,
     double * _y_right,
-    double * _loss) const
+    double * min_loss) const
 {
-    const XYSetRef& xy_set = set();
-    double n_left = 0.0;
-    double n_right = 0.0;
-    double y_left = 0.0;
-    double y_right = 0.0;
-
-    for (size_t i=0, s=xy_set.size(); i<s; i++)
-    {
-        const XY& xy = xy_set.get(i);
-        const CompoundValue& x = xy.x(_split_x_index);
-        double weight = xy.weight();
-        double response = response_[i];
-        if (X_LIES_LEFT(x, _split_x_value, _split_x_type))
-        {
-            y_left += response * weight;
-            n_left += weight;
-        }
-        else
-        {
-            y_right += response * weight;
-            n_right += weight;
-        }
-    }
-
-    if (y_left < EPS && n_left < EPS)
-        y_left = 0.0;
+    const CompoundValueVector& unique_x_values = root_->set_.get_x_values(_split_x_index);
+    const HistBin * bins = hist_.get_bins(_split_x_index);
+    if (_split_x_type == kXType_Numerical)
+        min_loss_on_bins<NumericalX>(unique_x_values, bins, total, yy, _split_x_value, _y_left, _y_right, min_loss);
     else
-        y_left /= n_left;
+        min_loss_on_bins<CategoryX>(unique_x_values, bins, total, yy, _split_x_value, _y_left, _y_right, min_loss);
+}
 
-    if (y_right < EPS && n_right < EPS)
-        y_right = 0.0;
-    else
-        y_right /= n_right;
+static inline const CompoundValue& get_x(const CompoundValueVector& X, size_t x_index)
+{
+    return X[x_index];
+}
 
-    *_y_left = y_left;
-    *_y_right = y_right;
-    __loss_x(_split_x_index, _split_x_type, _split_x_value, y_left, y_right, _loss);
+static inline const CompoundValue& get_x(const XY& xy, size_t x_index)
+{
+    return xy.x(x_index);
 }
 
-void TreeNodeBase::__loss_x(
-    size_t _split_x_index,
-    kXType _split_x_type,
-    const CompoundValue& _split_x_value,
-    double _y_left,
-    double _y_right,
-    double * _loss) const
+template <class Sample>
+double TreeNodeBase::__predict(const TreeNodeBase * node, const Sample& X)
 {
-    const XYSetRef& xy_set = set();
-    double ls_loss = 0.0;
-    for (size_t i=0, s=xy_set.size(); i<s; i++)
+    for (;;)
     {
-        const XY& xy = xy_set.get(i);
-        const CompoundValue& x = xy.x(_split_x_index);
-        double weight = xy.weight();
-        double diff;
-        if (X_LIES_LEFT(x, _split_x_value, _split_x_type))
-            diff = response_[i] - _y_left;
+        if (node->is_leaf())
+            return node->y();
+
+        const CompoundValue& x = get_x(X, node->split_x_index());
+        const CompoundValue& _split_x_value = node->split_x_value();
+        if (X_LIES_LEFT(x, _split_x_value, node->split_x_type()))
+            node = node->left();
         else
-            diff = response_[i] - _y_right;
-        // weighted square loss
-        ls_loss += (diff * diff * weight);
+            node = node->right();
+        assert(node);
     }
-    *_loss = ls_loss;
 }
 
-double TreeNodeBase::__predict(const TreeNodeBase * node, const CompoundValueVector& X)
+template <class Sample>
+double TreeNodeBase::__predict_bins(const TreeNodeBase * node, const Sample& xy)
 {
     for (;;)
     {
         if (node->is_leaf())
             return node->y();
 
-        const CompoundValue& x = X[node->split_x_index()];
-        const CompoundValue& _split_x_value = node->split_x_value();
-        if (X_LIES_LEFT(x, _split_x_value, node->split_x_type()))
+        XBin bin = xy.x_bin(node->split_x_index());
+        if (X_BIN_LIES_LEFT(bin, node->split_x_bin_, node->split_x_type()))
             node = node->left();
         else
             node = node->right();
@@ -390,19 +1649,37 @@ double TreeNodeBase::total_loss(
     return 0.0;
 }
 
-void TreeNodeBase::add_data(const XY& xy, const TreeNodeBase * parent, size_t _index)
+double TreeNodeBase::update_fx_response(
+    const XYSet& full_set,
+    bool add_tree,
+    std::vector<double> * full_fx,
+    std::vector<double> * full_response) const
 {
-    assert(!is_root());
-    set().add(xy);
-    response_.push_back(parent->response_[_index]);
+    assert(0);
+    return 0.0;
 }
 
 void TreeNodeBase::clear()
 {
+    std::vector<size_t>().swap(x_indices_);
+    // memory of the root is given back to be used by the next tree
+    if (buffers_)
+    {
+        swap_buffers();
+        buffers_->reset();
+        buffers_ = 0;
+        return;
+    }
+
+    // release memory, trained trees are kept until training ends
     set().clear();
-    response_.clear();
+    std::vector<double>().swap(response_);
+    std::vector<size_t>().swap(indices_);
+    std::vector<std::vector<size_t> >().swap(sorted_indices_);
+    std::vector<char>().swap(lies_left_);
+    std::vector<size_t>().swap(buffer_);
+    std::vector<size_t>().swap(node_of_);
 }
-
 /************************************************************************/
 /* TreeNodePredictor */
 /************************************************************************/
@@ -1,28 +1,103 @@
 #ifndef GBDT_NODE_H
 #define GBDT_NODE_H
 
+#include "hist.h"
 #include "param.h"
 #include "sample.h"
+#include <assert.h>
+#include <algorithm>
+
+class AllReducer;
+class ThreadPool;
+
+// Memory of vectors of the root node over samples, see TreeNodeBase.
+// It is kept from one tree to the next, so that trees do not allocate it again.
+struct TreeBuffers
+{
+    XYSetRef set;
+    std::vector<double> response;
+    std::vector<size_t> indices;
+    std::vector<std::vector<size_t> > sorted_indices;
+    std::vector<char> lies_left;
+    std::vector<size_t> buffer;
+    std::vector<size_t> node_of;
+
+    // empty them but keep their memory
+    void reset()
+    {
+        set.reset();
+        response.clear();
+        indices.clear();
+        lies_left.clear();
+        buffer.clear();
+        node_of.clear();
+    }
+};
 
 class TreeNodeBase
 {
 private:
+    friend struct FeatureSplitTask;
+    friend struct LevelSweepTask;
+    friend struct LiesLeftBlockTask;
+    friend struct SubtreeTask;
+
     const TreeParam& param_;
     const size_t level_;
 
     TreeNodeBase * left_;
     TreeNodeBase * right_;
-    XYSetRef set_;
+    // root of the tree being trained, which holds training samples of all nodes
+    TreeNodeBase * root_;
+    // training samples of this node are root_->indices_[begin_, end_)
+    size_t begin_;
+    size_t end_;
+    // number of training samples of this node in all workers
+    size_t global_size_;
+    // histograms of training samples of this node, only for histogram-based splitting
+    Histogram hist_;
     // loss of current tree and all preceding trees
     double total_loss_;
     // loss of current split
     double loss_;
+    // loss drop of current split
+    double gain_;
+    // predicted y of children of current split
+    double y_left_;
+    double y_right_;
+
+    // root node only
+    // threads used in training
+    ThreadPool * pool_;
+    // communication with other workers in distributed training, 0 if not distributed
+    AllReducer * reducer_;
+    // memory of the following vectors lent by the trainer, 0 if they are allocated by this tree
+    TreeBuffers * buffers_;
+    // index of this tree in the model, random numbers of sampling are of it and "seed"
+    size_t tree_index_;
+    // sampled training samples
+    XYSetRef set_;
+    // features used by this tree in ascending order, see "colsample_bytree"
+    std::vector<size_t> x_indices_;
+    // indices of 'set_', partitioned in place when a node is split
+    std::vector<size_t> indices_;
+    // sorted_indices_[i] is 'indices_' sorted by the ith feature,
+    // partitioned in place in the same way, only for exact splitting.
+    std::vector<std::vector<size_t> > sorted_indices_;
+    // whether a sample of 'set_' lies left when a node is split
+    std::vector<char> lies_left_;
+    // buffer for partitioning
+    std::vector<size_t> buffer_;
+    // index of the node that a sample of 'set_' lies in, for level-wise growth
+    std::vector<size_t> node_of_;
 
     // inner node only
     // split position information
     size_t split_x_index_;
     kXType split_x_type_;
     CompoundValue split_x_value_;
+    // bin index of 'split_x_value_', only for histogram-based splitting
+    XBin split_x_bin_;
 
     // leaf node only
     bool leaf_;
@@ -30,7 +105,8 @@ private:
     double y_;
 
 protected:
-    // pseudo response
+    // root node only
+    // pseudo response of 'set_'
     std::vector<double> response_;
 
 public:
@@ -43,10 +119,30 @@ public:
     const TreeNodeBase * right() const {return right_;}
     XYSetRef& set() {return set_;}
     const XYSetRef& set() const {return set_;}
+    const TreeNodeBase * root() const {return root_;}
+    ThreadPool * pool() const {return root_->pool_;}
+    AllReducer *& reducer() {return root_->reducer_;}
+    AllReducer * reducer() const {return root_->reducer_;}
+    bool distributed() const;
+    // number of training samples in this node
+    size_t size() const {return end_ - begin_;}
+    size_t global_size() const {return global_size_;}
+    // Features whose candidates are searched for the split of this node in ascending order,
+    // they are sampled into 'buffer' if "colsample_bylevel" is less than 1.
+    const std::vector<size_t>& get_x_indices(std::vector<size_t> * buffer) const;
+    // index of the ith training sample of this node in root's 'set_' and 'response_'
+    size_t get_index(size_t i) const {return root_->indices_[begin_ + i];}
+    // the ith training sample of this node
+    XY get(size_t i) const {return root_->set_.get(get_index(i));}
+    // weight of the ith training sample of this node, scaled by sampling
+    double get_weight(size_t i) const {return root_->set_.get_weight(get_index(i));}
+    // pseudo response of the ith training sample of this node
+    double get_response(size_t i) const {return root_->response_[get_index(i)];}
     double& total_loss() {return total_loss_;}
     double total_loss() const {return total_loss_;}
     double& loss() {return loss_;}
     double loss() const {return loss_;}
+    double gain() const {return gain_;}
     size_t& split_x_index() {return split_x_index_;}
     size_t split_x_index() const {return split_x_index_;}
     kXType& split_x_type() {return split_x_type_;}
@@ -66,31 +162,112 @@ protected:
 
 public:
     virtual ~TreeNodeBase();
+    // If 'full_response' is not 0, pseudo responses are taken from it,
+    // and it is updated for the next tree by 'update_fx_response'.
+    // 'tree_index' is the index of the tree in the model, which samples are sampled by.
+    // If 'buffers' is not 0, vectors over samples use its memory and give it back when trained.
     TreeNodeBase * train(
         const XYSet& full_set,
         const TreeParam& param,
-        std::vector<double> * full_fx) const;
+        ThreadPool * pool,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response,
+        size_t tree_index,
+        TreeBuffers * buffers = 0) const;
     double predict(const CompoundValueVector& X) const;
+    double predict(const XY& xy) const;
 
 protected:
     void do_train(
         const XYSet& full_set,
         const TreeParam& param,
-        std::vector<double> * full_fx);
+        ThreadPool * pool,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response,
+        TreeBuffers * buffers);
+    // 'Kernel' is a kernel of a loss computing samples in batches, see loss.h.
+    // For every sample in 'full_set', add the output of this tree to its fx if 'add_tree',
+    // then compute its pseudo response for the next tree and its weighted loss in batches,
+    // and return the total loss.
+    template <class Kernel>
+    double fused_update(
+        const XYSet& full_set,
+        bool add_tree,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response) const;
+    // Pseudo responses of samples 'full_set.get(indices[i])', i in [0, n), or [0, n) if 'indices' is 0,
+    // are written to 'response[0, n)', and their total weighted loss is returned if 'with_loss'.
+    // 'fx' is of all samples of 'full_set'.
+    // Samples are computed by 'Kernel' in blocks, y, weight and fx of a block are gathered into arrays.
+    template <class Kernel>
+    static double batch_update(
+        const XYSet& full_set,
+        const size_t * indices,
+        size_t n,
+        const double * fx,
+        double * response,
+        bool with_loss);
+    // "total_loss" and "update_response" by 'Kernel'
+    template <class Kernel>
+    static double batch_total_loss(
+        const XYSet& full_set,
+        const std::vector<double>& full_fx);
+    template <class Kernel>
+    void batch_update_response(const std::vector<double>& fx);
 
 private:
+    // If all samples are used, 'full_response' is moved to 'response_' without copying,
+    // and moved back after the tree is built.
     void sample_and_update_response(
         const XYSet& full_set,
         const TreeParam& param,
-        const std::vector<double>& full_fx);
+        const std::vector<double>& full_fx,
+        std::vector<double> * full_response);
+    // gradient-based one-side sampling, see "gbdt_sample_method"
+    void sample_goss(
+        const XYSet& full_set,
+        const TreeParam& param,
+        const std::vector<double>& full_fx,
+        const std::vector<double> * full_response);
+    // (*sampled)[i] is whether the ith of 'n' samples is sampled at 'rate'
+    void sample(size_t n, double rate, std::vector<char> * sampled) const;
+    // sample features used by this tree, see "colsample_bytree"
+    void sample_x(const TreeParam& param);
+    void build_sorted_indices(const XYSet& full_set);
+    void swap_buffers();
     void build_tree();
+    void build_tree_depthfirst();
+    void build_tree_parallel();
+    void build_tree_leafwise();
+    void build_tree_levelwise();
+    void find_splits_hist(
+        const std::vector<TreeNodeBase *>& parents,
+        const std::vector<TreeNodeBase *>& nodes);
+    void find_splits_exact(const std::vector<TreeNodeBase *>& nodes);
+    bool can_split() const;
+    void make_leaf();
+    void find_split();
     void split();
     TreeNodeBase * fork() const;
-    void split_data(TreeNodeBase * _left, TreeNodeBase * _right) const;
+    void split_data(TreeNodeBase * _left, TreeNodeBase * _right);
+    // decide which side samples lie in for nodes of a level, when x bins are read from disk
+    void split_data_blocks(const std::vector<TreeNodeBase *>& nodes);
+    void partition(size_t * indices, size_t n_left);
+    void split_hist(TreeNodeBase * _left, TreeNodeBase * _right);
     void shrink();
     void update_fx(const XYSet& full_set, std::vector<double> * full_fx) const;
+    // add the output of this tree to fx of samples not sampled,
+    // they are predicted in a pass over x bins if they are read from disk
+    void add_unsampled_fx(
+        const XYSet& full_set,
+        const std::vector<char>& sampled,
+        std::vector<double> * full_fx) const;
+    static void get_leaves(const TreeNodeBase * node, std::vector<const TreeNodeBase *> * leaves);
     void clear_tree();
+    void get_total(HistBin * total, double * yy) const;
     void min_loss_on_all_features(
+        const HistBin& total,
+        double yy,
         size_t * _split_x_index,
         kXType * _split_x_type,
         CompoundValue * _split_x_value,
@@ -100,30 +277,39 @@ private:
     void min_loss_on_one_feature(
         size_t _split_x_index,
         kXType _split_x_type,
+        const HistBin& total,
+        double yy,
         CompoundValue * _split_x_value,
         double * _y_left,
         double * _y_right,
         double * min_loss) const;
-    void loss_x(
+    void min_loss_on_one_feature_hist(
         size_t _split_x_index,
         kXType _split_x_type,
-        const CompoundValue& _split_x_value,
+        const HistBin& total,
+        double yy,
+        CompoundValue * _split_x_value,
         double * _y_left,
         double * _y_right,
-        double * _loss) const;
-    void __loss_x(
-        size_t _split_x_index,
-        kXType _split_x_type,
-        const CompoundValue& _split_x_value,
-        double _y_left,
-        double _y_right,
-        double * _loss) const;
-    static double __predict(const TreeNodeBase * node, const CompoundValueVector& X);
+        double * min_loss) const;
+    // 'Sample' is CompoundValueVector or XY
+    template <class Sample>
+    static double __predict(const TreeNodeBase * node, const Sample& X);
+    // 'Sample' is XY or XBinBlockRow
+    template <class Sample>
+    static double __predict_bins(const TreeNodeBase * node, const Sample& xy);
 
 public:
     virtual double total_loss(
         const XYSet& full_set,
         const std::vector<double>& full_fx) const;
+    // For a loss that the pseudo response of a sample only depends on its y and fx,
+    // see 'fused_update', losses of others do not support it.
+    virtual double update_fx_response(
+        const XYSet& full_set,
+        bool add_tree,
+        std::vector<double> * full_fx,
+        std::vector<double> * full_response) const;
     virtual TreeNodeBase * clone(
         const TreeParam& param,
         size_t level) const = 0;
@@ -134,12 +320,116 @@ public:
         double * y0) const = 0;
 
 protected:
-    virtual void add_data(const XY& xy, const TreeNodeBase * parent, size_t _index);
     virtual void clear();
+    // 'fx' is of all samples of the referred set of 'set()',
+    // that of the ith sampled one is fx[set().get_index(i)].
     virtual void update_response(const std::vector<double>& fx) = 0;
     virtual void update_predicted_y() = 0;
 };
 
+template <class Kernel>
+double TreeNodeBase::fused_update(
+    const XYSet& full_set,
+    bool add_tree,
+    std::vector<double> * full_fx,
+    std::vector<double> * full_response) const
+{
+    assert(full_set.size() == full_fx->size());
+    std::vector<double>& fx = *full_fx;
+    std::vector<double>& response = *full_response;
+    response.resize(full_set.size());
+
+    if (add_tree)
+    {
+        assert(is_root());
+        // sampled training samples lying in leaf nodes
+        std::vector<char> done(full_set.size(), 0);
+        std::vector<const TreeNodeBase *> leaves;
+        get_leaves(this, &leaves);
+        for (size_t k=0, s=leaves.size(); k<s; k++)
+        {
+            const TreeNodeBase * leaf = leaves[k];
+            double _y = leaf->y();
+            for (size_t i=0, t=leaf->size(); i<t; i++)
+            {
+                size_t index = set_.get_index(leaf->get_index(i));
+                fx[index] += _y;
+                done[index] = 1;
+            }
+        }
+
+        // samples not sampled are predicted in a pass over x bins read from disk
+        if (full_set.x_bin_file() != 0)
+        {
+            if (set_.size() != full_set.size())
+                add_unsampled_fx(full_set, done, full_fx);
+        }
+        else
+        {
+            for (size_t i=0, s=full_set.size(); i<s; i++)
+                if (!done[i])
+                    fx[i] += predict(full_set.get(i));
+        }
+    }
+
+    if (full_set.size() == 0)
+        return 0.0;
+    return batch_update<Kernel>(full_set, 0, full_set.size(), &fx[0], &response[0], true);
+}
+
+template <class Kernel>
+double TreeNodeBase::batch_update(
+    const XYSet& full_set,
+    const size_t * indices,
+    size_t n,
+    const double * fx,
+    double * response,
+    bool with_loss)
+{
+    static const size_t BLOCK_SIZE = 256;
+    double y[BLOCK_SIZE];
+    double w[BLOCK_SIZE];
+    double _fx[BLOCK_SIZE];
+    double loss = 0.0;
+    for (size_t begin=0; begin<n; begin+=BLOCK_SIZE)
+    {
+        size_t size = std::min(n - begin, BLOCK_SIZE);
+        for (size_t i=0; i<size; i++)
+        {
+            size_t index = indices ? indices[begin+i] : begin + i;
+            y[i] = full_set.get_y(index);
+            if (with_loss)
+                w[i] = full_set.get_weight(index);
+            if (indices)
+                _fx[i] = fx[index];
+        }
+        // fx of samples in order is not gathered
+        Kernel::batch(y, indices ? _fx : fx + begin, w, size, response ? response + begin : 0, with_loss ? &loss : 0);
+    }
+    return loss;
+}
+
+template <class Kernel>
+double TreeNodeBase::batch_total_loss(
+    const XYSet& full_set,
+    const std::vector<double>& full_fx)
+{
+    assert(full_set.size() == full_fx.size());
+    if (full_set.size() == 0)
+        return 0.0;
+    return batch_update<Kernel>(full_set, 0, full_set.size(), &full_fx[0], 0, true);
+}
+
+template <class Kernel>
+void TreeNodeBase::batch_update_response(const std::vector<double>& fx)
+{
+    assert(response_.empty());
+    assert(set_.set()->size() == fx.size());
+    response_.resize(set_.size());
+    if (!response_.empty())
+        batch_update<Kernel>(*set_.set(), set_.get_indices(), set_.size(), &fx[0], &response_[0], false);
+}
+
 class TreeNodePredictor : public TreeNodeBase
 {
 private:
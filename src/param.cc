@@ -15,6 +15,9 @@ static void print_usage(const char * program, FILE * fp)
         "    -c [configuration file], specify the configuration file\n"
         "        see README.md for specifications\n"
         "        see data/heart_scale.conf or data/weibo.conf for example\n"
+        "    -r [rank], specify the rank of this worker in distributed training,\n"
+        "        it overrides \"rank\" in the configuration file\n"
+        "    -o [binary file], specify the output of gbdt-dataset\n"
         );
 }
 
@@ -25,13 +28,19 @@ struct TreeParamSpec
     void * v;
     void (* assign)(const std::string& s, void * v);
     void (* check)(void * v);
+    bool optional;
     bool _set;
 };
 
 #define DECLARE_PARAM(param, type_name, name) \
-{#type_name, #name, (void *)(&param->name), assign_##type_name, 0, false}
+{#type_name, #name, (void *)(&param->name), assign_##type_name, 0, false, false}
 #define DECLARE_PARAM2(param, type_name, name) \
-{#type_name, #name, (void *)(&param->name), assign_##type_name, check_##name, false}
+{#type_name, #name, (void *)(&param->name), assign_##type_name, check_##name, false, false}
+// optional parameters keep their default values in TreeParam() if not set
+#define DECLARE_OPTIONAL_PARAM(param, type_name, name) \
+{#type_name, #name, (void *)(&param->name), assign_##type_name, 0, true, false}
+#define DECLARE_OPTIONAL_PARAM2(param, type_name, name) \
+{#type_name, #name, (void *)(&param->name), assign_##type_name, check_##name, true, false}
 
 static void assign_int(const std::string& s, void * v)
 {
@@ -65,9 +74,9 @@ static void check_min_values_in_leaf(void * v)
 static void check_training_sample_format(void * v)
 {
     std::string format = *(std::string *)v;
-    if (format != "liblinear" && format != "gbdt")
+    if (format != "liblinear" && format != "gbdt" && format != "binary")
     {
-        fprintf(stderr, "invalid \"training_sample_format\", it should be \"liblinear\" or \"gbdt\"\n");
+        fprintf(stderr, "invalid \"training_sample_format\", it should be \"liblinear\", \"gbdt\" or \"binary\"\n");
         exit(1);
     }
 }
@@ -82,6 +91,116 @@ static void check_gbdt_loss(void * v)
     }
 }
 
+static void check_tree_method(void * v)
+{
+    std::string tree_method = *(std::string *)v;
+    if (tree_method != "exact" && tree_method != "hist")
+    {
+        fprintf(stderr, "invalid \"tree_method\", it should be \"exact\" or \"hist\"\n");
+        exit(1);
+    }
+}
+
+static void check_max_bin(void * v)
+{
+    size_t max_bin = *(size_t *)v;
+    if (max_bin < 2 || max_bin > 65536)
+    {
+        fprintf(stderr, "invalid \"max_bin\", it should be in [2, 65536]\n");
+        exit(1);
+    }
+}
+
+static void check_tree_growth(void * v)
+{
+    std::string tree_growth = *(std::string *)v;
+    if (tree_growth != "depthfirst" && tree_growth != "leafwise" && tree_growth != "levelwise")
+    {
+        fprintf(stderr, "invalid \"tree_growth\", it should be \"depthfirst\", \"leafwise\" or \"levelwise\"\n");
+        exit(1);
+    }
+}
+
+static void check_max_conflict_rate(void * v)
+{
+    double max_conflict_rate = *(double *)v;
+    if (max_conflict_rate < 0.0 || max_conflict_rate >= 1.0)
+    {
+        fprintf(stderr, "invalid \"max_conflict_rate\", it should be in [0.0, 1.0)\n");
+        exit(1);
+    }
+}
+
+static void check_gbdt_sample_method(void * v)
+{
+    std::string gbdt_sample_method = *(std::string *)v;
+    if (gbdt_sample_method != "uniform" && gbdt_sample_method != "goss")
+    {
+        fprintf(stderr, "invalid \"gbdt_sample_method\", it should be \"uniform\" or \"goss\"\n");
+        exit(1);
+    }
+}
+
+static void check_goss_top_rate(void * v)
+{
+    double goss_top_rate = *(double *)v;
+    if (goss_top_rate < 0.0 || goss_top_rate >= 1.0)
+    {
+        fprintf(stderr, "invalid \"goss_top_rate\", it should be in [0.0, 1.0)\n");
+        exit(1);
+    }
+}
+
+static void check_goss_other_rate(void * v)
+{
+    double goss_other_rate = *(double *)v;
+    if (goss_other_rate <= 0.0 || goss_other_rate > 1.0)
+    {
+        fprintf(stderr, "invalid \"goss_other_rate\", it should be in (0.0, 1.0]\n");
+        exit(1);
+    }
+}
+
+static void check_colsample_bytree(void * v)
+{
+    double colsample_bytree = *(double *)v;
+    if (colsample_bytree <= 0.0 || colsample_bytree > 1.0)
+    {
+        fprintf(stderr, "invalid \"colsample_bytree\", it should be in (0.0, 1.0]\n");
+        exit(1);
+    }
+}
+
+static void check_colsample_bylevel(void * v)
+{
+    double colsample_bylevel = *(double *)v;
+    if (colsample_bylevel <= 0.0 || colsample_bylevel > 1.0)
+    {
+        fprintf(stderr, "invalid \"colsample_bylevel\", it should be in (0.0, 1.0]\n");
+        exit(1);
+    }
+}
+
+static void check_gbdt_loss_math(void * v)
+{
+    std::string gbdt_loss_math = *(std::string *)v;
+    if (gbdt_loss_math != "fast" && gbdt_loss_math != "exact")
+    {
+        fprintf(stderr, "invalid \"gbdt_loss_math\", it should be \"fast\" or \"exact\"\n");
+        exit(1);
+    }
+}
+
+static void check_workers(void * v)
+{
+    size_t workers = *(size_t *)v;
+    if (workers == 0)
+    {
+        fprintf(stderr, "invalid \"workers\", it should be greater than 0\n");
+        exit(1);
+    }
+}
+
 static void check_lm_metric(void * v)
 {
     std::string lm_metric = *(std::string *)v;
@@ -185,6 +304,22 @@ public:
             DECLARE_PARAM(param, std_string, model),
             DECLARE_PARAM(param, double, gbdt_sample_rate),
             DECLARE_PARAM2(param, std_string, gbdt_loss),
+            DECLARE_OPTIONAL_PARAM2(param, std_string, tree_method),
+            DECLARE_OPTIONAL_PARAM2(param, size_t, max_bin),
+            DECLARE_OPTIONAL_PARAM2(param, std_string, tree_growth),
+            DECLARE_OPTIONAL_PARAM(param, size_t, threads),
+            DECLARE_OPTIONAL_PARAM2(param, size_t, workers),
+            DECLARE_OPTIONAL_PARAM(param, size_t, rank),
+            DECLARE_OPTIONAL_PARAM(param, std_string, master),
+            DECLARE_OPTIONAL_PARAM(param, size_t, memory_budget),
+            DECLARE_OPTIONAL_PARAM2(param, double, max_conflict_rate),
+            DECLARE_OPTIONAL_PARAM2(param, std_string, gbdt_sample_method),
+            DECLARE_OPTIONAL_PARAM2(param, double, goss_top_rate),
+            DECLARE_OPTIONAL_PARAM2(param, double, goss_other_rate),
+            DECLARE_OPTIONAL_PARAM(param, size_t, seed),
+            DECLARE_OPTIONAL_PARAM2(param, double, colsample_bytree),
+            DECLARE_OPTIONAL_PARAM2(param, double, colsample_bylevel),
+            DECLARE_OPTIONAL_PARAM2(param, std_string, gbdt_loss_math),
         };
         TreeParamSpec lm_specs[] =
         {
@@ -199,11 +334,15 @@ public:
             DECLARE_PARAM(param, std_string, model),
             DECLARE_PARAM2(param, std_string, lm_metric),
             DECLARE_PARAM(param, size_t, lm_ndcg_k),
+            DECLARE_OPTIONAL_PARAM2(param, std_string, tree_method),
+            DECLARE_OPTIONAL_PARAM2(param, size_t, max_bin),
+            DECLARE_OPTIONAL_PARAM2(param, std_string, tree_growth),
+            DECLARE_OPTIONAL_PARAM(param, size_t, threads),
         };
 
         TreeParamSpec * specs;
         size_t spec_length;
-        if (type == 0)
+        if (type == 0 || type == 2)
         {
             specs = gbdt_specs;
             spec_length = sizeof(gbdt_specs)/sizeof(gbdt_specs[0]);
@@ -251,7 +390,11 @@ public:
         for (size_t i=0; i<spec_length; i++)
         {
             const TreeParamSpec& spec = specs[i];
-            if (!spec._set)
+            // gbdt-dataset only needs training samples
+            if (type == 2 && strcmp(spec.name, "training_sample") != 0
+                && strcmp(spec.name, "training_sample_format") != 0)
+                continue;
+            if (!spec._set && !spec.optional)
             {
                 fprintf(stderr, "\"%s\" is not set in \"%s\"\n", spec.name, filename);
                 return -1;
@@ -262,9 +405,10 @@ public:
     }
 };
 
-static int parse_tree_param(int argc, char ** argv, TreeParam * param, int type)
+static int parse_tree_param(int argc, char ** argv, TreeParam * param, int type, std::string * output)
 {
     std::string config_filename;
+    int rank = -1;
     for (int i=1; i<argc; i++)
     {
         if (strcmp(argv[i], "-h") == 0)
@@ -277,6 +421,21 @@ static int parse_tree_param(int argc, char ** argv, TreeParam * param, int type)
             config_filename = argv[i+1];
             i++;
         }
+        else if (strcmp(argv[i], "-r") == 0 && i+1<argc)
+        {
+            rank = xatoi(argv[i+1]);
+            if (rank < 0)
+            {
+                fprintf(stderr, "invalid rank %s\n", argv[i+1]);
+                return -1;
+            }
+            i++;
+        }
+        else if (strcmp(argv[i], "-o") == 0 && i+1<argc && output)
+        {
+            *output = argv[i+1];
+            i++;
+        }
         else
         {
             fprintf(stderr, "unknown option %s\n", argv[i]);
@@ -284,22 +443,31 @@ static int parse_tree_param(int argc, char ** argv, TreeParam * param, int type)
         }
     }
 
-    if (config_filename.empty())
+    if (config_filename.empty() || (output && output->empty()))
     {
         print_usage(argv[0], stderr);
         return -1;
     }
 
     TreeParamLoader loader;
-    return loader.load(config_filename.c_str(), param, type);
+    if (loader.load(config_filename.c_str(), param, type) == -1)
+        return -1;
+    if (rank != -1)
+        param->rank = (size_t)rank;
+    return 0;
 }
 
 int gbdt_parse_tree_param(int argc, char ** argv, TreeParam * param)
 {
-    return parse_tree_param(argc, argv, param, 0);
+    return parse_tree_param(argc, argv, param, 0, 0);
 }
 
 int lm_parse_tree_param(int argc, char ** argv, TreeParam * param)
 {
-    return parse_tree_param(argc, argv, param, 1);
+    return parse_tree_param(argc, argv, param, 1, 0);
+}
+
+int dataset_parse_tree_param(int argc, char ** argv, TreeParam * param, std::string * output)
+{
+    return parse_tree_param(argc, argv, param, 2, output);
 }
@@ -26,10 +26,35 @@ struct TreeParam
     std::string lm_metric;
     size_t lm_ndcg_k;
 
-    TreeParam() {}
+    // optional ones
+    std::string tree_method;
+    size_t max_bin;
+    std::string tree_growth;
+    size_t threads;
+    size_t workers;
+    size_t rank;
+    std::string master;
+    // in MB, 0 means all training samples are in memory
+    size_t memory_budget;
+    double max_conflict_rate;
+    std::string gbdt_sample_method;
+    double goss_top_rate;
+    double goss_other_rate;
+    size_t seed;
+    double colsample_bytree;
+    double colsample_bylevel;
+    std::string gbdt_loss_math;
+
+    TreeParam()
+        : tree_method("exact"), max_bin(256), tree_growth("depthfirst"), threads(1),
+        workers(1), rank(0), master("127.0.0.1:7777"), memory_budget(0), max_conflict_rate(0.0),
+        gbdt_sample_method("uniform"), goss_top_rate(0.2), goss_other_rate(0.1), seed(0),
+        colsample_bytree(1.0), colsample_bylevel(1.0), gbdt_loss_math("fast") {}
 };
 
 int gbdt_parse_tree_param(int argc, char ** argv, TreeParam * param);
 int lm_parse_tree_param(int argc, char ** argv, TreeParam * param);
+// for gbdt-dataset, 'output' is the binary file to write
+int dataset_parse_tree_param(int argc, char ** argv, TreeParam * param, std::string * output);
 
 #endif// GBDT_PARAM_H
@@ -0,0 +1,65 @@
+#ifndef GBDT_RANDOM_H
+#define GBDT_RANDOM_H
+
+#include <stdint.h>
+
+// Counter-based random numbers by Philox4x32-10,
+// see "Parallel Random Numbers: As Easy as 1, 2, 3" (Salmon et al. 2011).
+// The ith number of a stream only depends on the seed, the stream and i,
+// so numbers can be generated by any thread in any order, and results do not depend on threads.
+class CounterRandom
+{
+private:
+    uint32_t key_[2];
+    uint32_t stream_[2];
+
+    static void mul_hi_lo(uint32_t a, uint32_t b, uint32_t * hi, uint32_t * lo)
+    {
+        uint64_t product = (uint64_t)a * b;
+        *hi = (uint32_t)(product >> 32);
+        *lo = (uint32_t)product;
+    }
+
+public:
+    // 'stream' separates numbers of one seed, e.g. one stream for every tree
+    CounterRandom(unsigned long long seed, unsigned long long stream)
+    {
+        key_[0] = (uint32_t)seed;
+        key_[1] = (uint32_t)(seed >> 32);
+        stream_[0] = (uint32_t)stream;
+        stream_[1] = (uint32_t)(stream >> 32);
+    }
+
+    // the ith 4 random 32-bit integers of the stream
+    void get(unsigned long long i, uint32_t out[4]) const
+    {
+        uint32_t c0 = (uint32_t)i, c1 = (uint32_t)(i >> 32), c2 = stream_[0], c3 = stream_[1];
+        uint32_t k0 = key_[0], k1 = key_[1];
+        for (int round=0; round<10; round++)
+        {
+            uint32_t hi0, lo0, hi1, lo1;
+            mul_hi_lo(0xD2511F53, c0, &hi0, &lo0);
+            mul_hi_lo(0xCD9E8D57, c2, &hi1, &lo1);
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+
+    // the ith uniform random number of the stream in [0, 1), of 53 random bits
+    double uniform(unsigned long long i) const
+    {
+        uint32_t out[4];
+        get(i, out);
+        return ((out[0] >> 5) * 67108864.0 + (out[1] >> 6)) * (1.0 / 9007199254740992.0);
+    }
+};
+
+#endif// GBDT_RANDOM_H
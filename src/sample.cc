@@ -1,8 +1,16 @@
 #include "sample.h"
+#include "block.h"
+#include "sketch.h"
+#include "text.h"
+#include "thread.h"
 #include "x.h"
 #include <assert.h>
+#include <limits.h>
 #include <string.h>
 #include <algorithm>
+#include <chrono>
+#include <functional>
+#include <utility>
 
 static void skip_space(const char *& cur)
 {
@@ -10,74 +18,265 @@ static void skip_space(const char *& cur)
         cur++;
 }
 
-// get some unique x values used when tree is being split
-static void get_unique_x_values(
-    XYSet * set,
-    CompoundValueVector * x_values,
-    size_t x_index,
-    kXType x_type)
+void XYSet::add(const XYRow& xy)
 {
-    x_values->clear();
-
-    if (x_type == kXType_Numerical)
+    size_t s = size();
+    if (x_columns_.size() < xy.get_x_size())
+        x_columns_.resize(xy.get_x_size(), CompoundValueVector(s));
+    for (size_t i=0, t=x_columns_.size(); i<t; i++)
     {
-        static const size_t MAX_UNIQUE_X_NUMERICAL = 100000;
+        if (i < xy.get_x_size())
+            x_columns_[i].push_back(xy.x(i));
+        else
+            x_columns_[i].push_back(CompoundValue());
+    }
+    y_.push_back(xy.y_value());
+#if !defined DISABLE_WEIGHT
+    weights_.push_back(xy.weight());
+#endif
+}
 
-        for (size_t i=0, s=std::min(MAX_UNIQUE_X_NUMERICAL, set->size()); i<s; i++)
-            x_values->push_back(set->get(i).x(x_index));
+const CompoundValue XSparseColumn::zero;
 
-        std::sort(x_values->begin(), x_values->end(), CompoundValueDoubleLess());
+void XYSet::add_sparse(const XYRow& xy)
+{
+    size_t s = size();
+    for (size_t i=0, t=xy.get_x_size(); i<t; i++)
+    {
+        size_t x_index = xy.get_x_index(i);
+        if (sparse_x_columns_.size() <= x_index)
+            sparse_x_columns_.resize(x_index + 1);
+        XSparseColumn& column = sparse_x_columns_[x_index];
+        // the last one of a feature appearing more than once is kept
+        if (!column.indices.empty() && column.indices.back() == s)
+        {
+            column.indices.pop_back();
+            column.values.pop_back();
+        }
+        if (xy.x(i).d() != 0.0)
+        {
+            column.indices.push_back(s);
+            column.values.push_back(xy.x(i));
+        }
+    }
+    y_.push_back(xy.y_value());
+#if !defined DISABLE_WEIGHT
+    weights_.push_back(xy.weight());
+#endif
+}
 
-        double _min = x_values->front().d();
-        // ensure the two continuous x values are not too near
-        double delta = (1e-3);
+void XYSet::resize_x(size_t s)
+{
+    x_columns_.resize(s, CompoundValueVector(size()));
+}
+
+void XYSet::append(std::vector<XYSet> * sets)
+{
+    size_t s = size();
+    std::vector<size_t> nonzeros(sparse_x_columns_.size());
+    for (size_t i=0, t=sets->size(); i<t; i++)
+    {
+        const XYSet& set = (*sets)[i];
+        assert(set.x_columns_.size() == x_columns_.size());
+        assert(set.sparse_x_columns_.size() <= sparse_x_columns_.size());
+        s += set.size();
+        for (size_t j=0, u=set.sparse_x_columns_.size(); j<u; j++)
+            nonzeros[j] += set.sparse_x_columns_[j].indices.size();
+    }
 
-        CompoundValueVector new_x_values;
+    for (size_t i=0, t=x_columns_.size(); i<t; i++)
+        x_columns_[i].reserve(s);
+    for (size_t i=0, t=sparse_x_columns_.size(); i<t; i++)
+    {
+        sparse_x_columns_[i].indices.reserve(sparse_x_columns_[i].indices.size() + nonzeros[i]);
+        sparse_x_columns_[i].values.reserve(sparse_x_columns_[i].values.size() + nonzeros[i]);
+    }
+    y_.reserve(s);
+#if !defined DISABLE_WEIGHT
+    weights_.reserve(s);
+#endif
 
-        double last = _min - delta * 2;
-        for (size_t i=0, s=x_values->size(); i<s; i++)
+    for (size_t i=0, t=sets->size(); i<t; i++)
+    {
+        XYSet& set = (*sets)[i];
+        for (size_t j=0, u=x_columns_.size(); j<u; j++)
         {
-            const CompoundValue& _now = (*x_values)[i];
-            double _now_d = _now.d();
-            if (_now_d - last > delta)
-            {
-                new_x_values.push_back(_now);
-                last = _now_d;
-            }
+            x_columns_[j].insert(x_columns_[j].end(), set.x_columns_[j].begin(), set.x_columns_[j].end());
+            CompoundValueVector().swap(set.x_columns_[j]);
+        }
+        // indices of sparse samples are shifted by samples before them
+        for (size_t j=0, u=set.sparse_x_columns_.size(); j<u; j++)
+        {
+            XSparseColumn& from = set.sparse_x_columns_[j];
+            XSparseColumn& to = sparse_x_columns_[j];
+            for (size_t k=0, v=from.indices.size(); k<v; k++)
+                to.indices.push_back(from.indices[k] + y_.size());
+            to.values.insert(to.values.end(), from.values.begin(), from.values.end());
+            std::vector<size_t>().swap(from.indices);
+            CompoundValueVector().swap(from.values);
         }
-        x_values->swap(new_x_values);
+        y_.insert(y_.end(), set.y_.begin(), set.y_.end());
+#if !defined DISABLE_WEIGHT
+        weights_.insert(weights_.end(), set.weights_.begin(), set.weights_.end());
+#endif
+        set.clear();
     }
-    else
+}
+
+void XYSet::swap_y(CompoundValueVector * y, std::vector<double> * weights)
+{
+    y_.swap(*y);
+#if !defined DISABLE_WEIGHT
+    weights_.swap(*weights);
+#endif
+}
+
+void XYSetRef::use_x(const std::vector<char>& x_used)
+{
+    assert(x_used.size() == get_x_type_size());
+    const size_t npos = (size_t)-1;
+    x_used_ = x_used;
+    const XBundles& x_bundles = get_x_bundles();
+    bundle_hist_indices_.assign(x_bundles.size(), std::vector<size_t>());
+    if (x_bundles.empty())
+        return;
+
+    // bins of used features in histograms, see Histogram
+    size_t x_size = get_x_type_size();
+    std::vector<size_t> hist_offsets(x_size);
+    size_t offset = 0;
+    for (size_t i=0; i<x_size; i++)
+    {
+        hist_offsets[i] = offset;
+        if (x_used[i])
+            offset += get_x_values(i).size() + 1;
+    }
+
+    // Bins of features not used are not counted,
+    // samples in them are in bins of 0 of the others, like samples in bin index 0,
+    // which are added to the bin of 0 of the first used feature, and filled up later.
+    for (size_t i=0; i<x_size; i++)
+    {
+        size_t b = x_bundles.get_bundle_of(i);
+        if (b == npos || !x_used[i])
+            continue;
+        std::vector<size_t>& hist_indices = bundle_hist_indices_[b];
+        if (hist_indices.empty())
+            hist_indices.assign(x_bundles.get_bundle(b).hist_indices.size(), hist_offsets[i] + get_zero_bin(i));
+        for (size_t k=0, start=x_bundles.get_start(i), s=x_bundles.get_bin_size(i); k<s; k++)
+            hist_indices[start + k] = hist_offsets[i] + k;
+    }
+}
+
+struct XIndexLess
+{
+    const CompoundValueVector& x_column;
+    const bool numerical;
+
+    XIndexLess(const XYSet& _set, size_t _x_index)
+        : x_column(_set.get_x_column(_x_index)),
+        numerical(_set.get_x_type(_x_index) == kXType_Numerical) {}
+
+    bool operator()(size_t a, size_t b) const
+    {
+        const CompoundValue& x_a = x_column[a];
+        const CompoundValue& x_b = x_column[b];
+        if (numerical)
+            return x_a.d() < x_b.d();
+        else
+            return x_a.i() < x_b.i();
+    }
+};
+
+// get indices of samples sorted by a feature, used by exact splitting
+struct SortIndicesTask : public ThreadTask
+{
+    XYSet * set;
+
+    explicit SortIndicesTask(XYSet * _set) : set(_set) {}
+
+    virtual void run(size_t x_index)
     {
-        static const size_t MAX_UNIQUE_X_CATEGORY = 1024;
+        std::vector<size_t>& sorted_indices = set->sorted_indices()[x_index];
+        sorted_indices.resize(set->size());
+        for (size_t i=0, s=set->size(); i<s; i++)
+            sorted_indices[i] = i;
+        std::stable_sort(sorted_indices.begin(), sorted_indices.end(), XIndexLess(*set, x_index));
+    }
+};
+
+static void get_sorted_indices(XYSet * set, ThreadPool * pool)
+{
+    set->sorted_indices().resize(set->get_x_type_size());
+    SortIndicesTask task(set);
+    pool->parallel_for(set->get_x_type_size(), &task);
+}
 
-        for (size_t i=0, s=std::min(MAX_UNIQUE_X_CATEGORY, set->size()); i<s; i++)
-            x_values->push_back(set->get(i).x(x_index));
+// chunks of lines per thread, more chunks balance threads better
+static const size_t CHUNKS_PER_THREAD = 4;
 
-        std::sort(x_values->begin(), x_values->end(), CompoundValueIntLess());
-        x_values->erase(std::unique(x_values->begin(), x_values->end(), CompoundValueIntEqual()),
-            x_values->end());
+// Text files are mapped and split into chunks of lines,
+// chunks are parsed into their own sets in parallel, and the sets are appended in order,
+// so samples are the same as parsing lines one by one.
+// 'Loader::load_chunk(i, begin, end)' parses the ith chunk.
+template <class Loader>
+struct LoadChunkTask : public ThreadTask
+{
+    Loader& loader;
+    const std::vector<const char *>& bounds;
+
+    LoadChunkTask(Loader& _loader, const std::vector<const char *>& _bounds)
+        : loader(_loader), bounds(_bounds) {}
+
+    virtual void run(size_t i)
+    {
+        loader.load_chunk(i, bounds[i], bounds[i+1]);
     }
+};
+
+// split [begin, end) into chunks, and parse them by 'loader' in parallel
+template <class Loader>
+static void load_chunks(
+    const char * begin,
+    const char * end,
+    Loader * loader,
+    ThreadPool * pool,
+    std::vector<XYSet> * sets)
+{
+    std::vector<const char *> bounds;
+    size_t chunks = pool->size() == 1 ? 1 : pool->size() * CHUNKS_PER_THREAD;
+    split_lines(begin, end, chunks, &bounds);
+    sets->clear();
+    sets->resize(bounds.size() - 1);
+    loader->resize(bounds.size() - 1);
+    LoadChunkTask<Loader> task(*loader, bounds);
+    pool->parallel_for(bounds.size() - 1, &task);
+}
+
+static double seconds_since(const std::chrono::steady_clock::time_point& begin)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
 }
 
-static void get_unique_x_values(XYSet * set)
+static void print_load_speed(const MappedFile& file, const std::chrono::steady_clock::time_point& begin)
 {
-    set->x_values().resize(set->get_x_type_size());
-    for (size_t i=0, s=set->spec().get_x_type_size(); i<s; i++)
-        get_unique_x_values(set, &set->get_x_values(i), i, set->get_x_type(i));
+    double seconds = seconds_since(begin);
+    double mb = file.size() / 1048576.0;
+    printf("loaded %.1f MB in %.3f seconds, %.1f MB/s\n", mb, seconds, seconds > 0.0 ? mb / seconds : 0.0);
 }
 
 class LibLinearLoader
 {
 private:
-    size_t x_column_;
-    size_t x_column_max_;
+    // x_column_max_[i] is the max number of features of lines in the ith chunk
+    std::vector<size_t> x_column_max_;
+    std::vector<XYSet> sets_;
 
 private:
     //+1 1:0.708333 2:1 3:1 4:-0.320755 5:-0.105023 6:-1 7:1 8:-0.419847 9:-1 10:-0.225806 12:1 13:-1
     //-1 1:0.583333 2:-1 3:0.333333 4:-0.603774 5:1 6:-1 7:1 8:0.358779 9:-1 10:-0.483871 12:-1 13:1
     //+1 1:0.166667 2:1 3:-0.333333 4:-0.433962 5:-0.383562 6:-1 7:-1 8:0.0687023 9:-1 10:-0.903226 11:-1 12:-1 13:1
-    int load_line(const char * line, XY * xy)
+    int load_line(const char * line, XYRow * xy, size_t * x_column_max)
     {
         const char * cur = line;
         char * end;
@@ -107,8 +306,8 @@ private:
             if (*cur == 0 || *cur == '\n')
                 break;
 
-            x_index = strtol(cur, &end, 10);
-            if (errno == ERANGE || cur == end)
+            x_index = parse_long(cur, &end);
+            if (errno == ERANGE || cur == end || x_index < 1)
             {
                 fprintf(stderr, "invalid x index\n");
                 return -1;
@@ -122,7 +321,7 @@ private:
             }
             cur = end + 1;
 
-            x_value = strtod(cur, &end);
+            x_value = parse_double(cur, &end);
             if (errno == ERANGE || cur == end)
             {
                 fprintf(stderr, "invalid x value\n");
@@ -132,97 +331,104 @@ private:
             skip_space(cur);
 
             x.d() = x_value;
-            if (xy->get_x_size() < (size_t)x_index + 1) 
-                xy->resize_x((size_t)x_index + 1);
-            xy->x(x_index) = x;
+            xy->add_sparse_x((size_t)x_index, x);
+            if (*x_column_max < (size_t)x_index + 1)
+                *x_column_max = (size_t)x_index + 1;
         }
-        x_column_ = xy->get_x_size();
-        if (x_column_max_ < x_column_)
-            x_column_max_ = x_column_;
         return 0;
     }
 
 public:
-    LibLinearLoader() : x_column_(0), x_column_max_(0) {}
+    void resize(size_t chunks)
+    {
+        x_column_max_.assign(chunks, 0);
+    }
+
+    void load_chunk(size_t i, const char * begin, const char * end)
+    {
+        LineReader reader(begin, end);
+        const char * line;
+        size_t length;
+        XYRow xy;
+        while (reader.next(&line, &length))
+        {
+            xy.clear();
+            if (load_line(line, &xy, &x_column_max_[i]) == -1)
+                fprintf(stderr, "parse line failed:\n\"%.*s\"\n", (int)length, line);
+            sets_[i].add_sparse(xy);
+        }
+    }
 
-    int load(const char * filename, XYSet * set)
+    int load(const char * filename, XYSet * set, ThreadPool * pool)
     {
         assert(filename);
         assert(set);
 
-        FILE * fp = yfopen(filename, "r");
-        if (fp == 0)
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        MappedFile file;
+        if (file.open(filename) == -1)
             return -1;
-        ScopedFile fp_guard(fp);
 
-        int length = 4096;
-        char * line = (char *)xmalloc(length);
-        ScopedPtrMalloc<char *> line_guard(line);
-        char * to_read = line;
-        int total_lines = 0, bad_lines = 0;
+        load_chunks(file.begin(), file.end(), this, pool, &sets_);
 
-        for (;;)
-        {
-            line[length-2] = 0;
-            if (fgets(to_read, length-(to_read-line), fp) == 0)
-                break;
-
-            if (line[length-2] != 0)
-            {
-                int line_length = length - 1;
-                length = length * 2;
-                line = (char *)xrealloc(line, length);
-                line_guard.set_for_realloc(line);
-                to_read = line + line_length;
-            }
-            else
-            {
-                to_read = line;
-
-                XY xy;
-                if (load_line(line, &xy) == -1)
-                {
-                    fprintf(stderr, "parse line failed:\n\"%s\"\n", line);
-                    bad_lines++;
-                }
-                total_lines++;
-                set->add(xy);
-            }
-        }
-
-        if (x_column_max_ == 0)
+        size_t x_column_max = 0;
+        for (size_t i=0, s=x_column_max_.size(); i<s; i++)
+            if (x_column_max < x_column_max_[i])
+                x_column_max = x_column_max_[i];
+        if (x_column_max == 0)
         {
             printf("deduce spec failed\n");
             return 1;
         }
 
-        printf("deduce spec: %d columns\n", (int)x_column_max_);
-        printf("loaded %d training samples\n", (int)set->size());
-
-        for (size_t i=0; i<x_column_max_; i++)
+        // samples are kept sparse, see "densify_x"
+        for (size_t i=0; i<x_column_max; i++)
             set->add_x_type(kXType_Numerical);
-        for (size_t i=0, s=set->size(); i<s; i++)
-            set->get(i).resize_x(x_column_max_);
+        set->sparse_x_columns().resize(x_column_max);
+        set->append(&sets_);
+
+        printf("deduce spec: %d columns\n", (int)x_column_max);
+        printf("loaded %d training samples\n", (int)set->size());
+        print_load_speed(file, begin);
 
         if (set->size() == 0)
             return -1;
-
-        get_unique_x_values(set);
         return 0;
     }
 };
 
-int load_liblinear(const char * filename, XYSet * set)
+// use a pool of one thread if 'pool' is 0
+struct ThreadPoolGuard
+{
+    ThreadPool * pool;
+    ThreadPool * own;
+
+    explicit ThreadPoolGuard(ThreadPool * _pool)
+        : pool(_pool), own(0)
+    {
+        if (pool == 0)
+            pool = own = new ThreadPool(1);
+    }
+
+    ~ThreadPoolGuard()
+    {
+        delete own;
+    }
+};
+
+int load_liblinear(const char * filename, XYSet * set, ThreadPool * pool)
 {
     LibLinearLoader loader;
+    ThreadPoolGuard guard(pool);
     set->clear();
-    return loader.load(filename, set);
+    return loader.load(filename, set, guard.pool);
 }
 
 class GBDTLoader
 {
 private:
     XYSpec spec_;
+    std::vector<XYSet> sets_;
 
 private:
     //#n c n n n n n n n n
@@ -269,14 +475,14 @@ private:
     //1 w:5 53 0 313 6 0 0 4 0 2 0
     //1 w:4 33 0 1793 341 18 0 181 0 0 0
     //1 w:5 32 0 1784 366 15 0 166 0 0 0
-    int load_xy(const char * line, XY * xy)
+    int load_xy(const char * line, XYRow * xy) const
     {
         const char * cur = line;
         char * end;
         CompoundValue x;
 
         // y
-        xy->y() = strtod(cur, &end);
+        xy->y() = parse_double(cur, &end);
         if (errno == ERANGE || cur == end)
         {
             fprintf(stderr, "invalid y value\n");
@@ -289,7 +495,7 @@ private:
         if (strncmp(cur, "w:", 2) == 0)
         {
             cur += 2;
-            xy->set_weight(strtod(cur, &end));
+            xy->set_weight(parse_double(cur, &end));
             if (errno == ERANGE || cur == end)
             {
                 fprintf(stderr, "invalid weight\n");
@@ -310,7 +516,7 @@ private:
             kXType xtype = spec_.get_x_type(i);
             if (xtype == kXType_Numerical)
             {
-                double value = strtod(cur, &end);
+                double value = parse_double(cur, &end);
                 if (errno == ERANGE || cur == end)
                 {
                     fprintf(stderr, "invalid x value\n");
@@ -320,7 +526,7 @@ private:
             }
             else
             {
-                long value = strtol(cur, &end, 10);
+                long value = parse_long(cur, &end);
                 if (errno == ERANGE || cur == end)
                 {
                     fprintf(stderr, "invalid x value\n");
@@ -338,100 +544,90 @@ private:
 public:
     GBDTLoader() : spec_() {}
 
-    int load(const char * filename, XYSet * set)
+    void resize(size_t chunks) {}
+
+    void load_chunk(size_t i, const char * begin, const char * end)
+    {
+        LineReader reader(begin, end);
+        const char * line;
+        size_t length;
+        XYRow xy;
+        while (reader.next(&line, &length))
+        {
+            xy.clear();
+            if (load_xy(line, &xy) == -1)
+                fprintf(stderr, "parse line failed:\n\"%.*s\"\n", (int)length, line);
+            sets_[i].add(xy);
+        }
+    }
+
+    int load(const char * filename, XYSet * set, ThreadPool * pool)
     {
         assert(filename);
         assert(set);
 
-        FILE * fp = yfopen(filename, "r");
-        if (fp == 0)
-        {
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        MappedFile file;
+        if (file.open(filename) == -1)
             return -1;
-        }
-        ScopedFile fp_guard(fp);
-
-        int length = 4096;
-        char * line = (char *)xmalloc(length);
-        ScopedPtrMalloc<char *> line_guard(line);
-        char * to_read = line;
-        int total_lines = 0, bad_lines = 0;
-        int loaded_spec = 0;
 
-        for (;;)
+        // the first line is the spec
+        LineReader reader(file.begin(), file.end());
+        const char * line;
+        size_t length;
+        if (!reader.next(&line, &length))
+            length = 0;
+        else if (load_spec(line, &spec_) == -1)
         {
-            line[length-2] = 0;
-            if (fgets(to_read, length-(to_read-line), fp) == 0)
-            {
-                break;
-            }
-
-            if (line[length-2] != 0)
-            {
-                int line_length = length - 1;
-                length = length * 2;
-                line = (char *)xrealloc(line, length);
-                line_guard.set_for_realloc(line);
-                to_read = line + line_length;
-            }
-            else
-            {
-                to_read = line;
-
-                if (loaded_spec == 0)
-                {
-                    if (load_spec(line, &spec_) == -1)
-                    {
-                        fprintf(stderr, "load spec failed:\n\"%s\"\n", line);
-                        return -1;
-                    }
-                    loaded_spec = 1;
-                }
-                else
-                {
-                    XY xy;
-                    if (load_xy(line, &xy) == -1)
-                    {
-                        fprintf(stderr, "parse line failed:\n\"%s\"\n", line);
-                        bad_lines++;
-                    }
-                    total_lines++;
-                    set->add(xy);
-                }
-            }
+            fprintf(stderr, "load spec failed:\n\"%.*s\"\n", (int)length, line);
+            return -1;
         }
 
+        load_chunks(file.begin() + length, file.end(), this, pool, &sets_);
+        set->resize_x(spec_.get_x_type_size());
+        set->append(&sets_);
+
         printf("loaded spec: %d colunms\n", (int)spec_.get_x_type_size());
         printf("loaded %d training samples\n", (int)set->size());
+        print_load_speed(file, begin);
 
         set->spec() = spec_;
 
         if (set->size() == 0)
             return -1;
 
-        get_unique_x_values(set);
+        get_sorted_indices(set, pool);
         return 0;
     }
 };
 
-int load_gbdt(const char * filename, XYSet * set)
+int load_gbdt(const char * filename, XYSet * set, ThreadPool * pool)
 {
     GBDTLoader loader;
+    ThreadPoolGuard guard(pool);
     set->clear();
-    return loader.load(filename, set);
+    return loader.load(filename, set, guard.pool);
 }
 
+// qid of lines before the first qid of a chunk,
+// they have the qid of the line before the chunk.
+static const long UNKNOWN_QID = LONG_MIN;
+
 class Lector4Loader
 {
 private:
-    size_t x_column_;
-    size_t x_column_max_;
+    // x_column_max_[i] is the max number of features of lines in the ith chunk
+    std::vector<size_t> x_column_max_;
+    // qids_[i] is qids of lines in the ith chunk
+    std::vector<std::vector<long> > qids_;
+    std::vector<XYSet> sets_;
 
 private:
     //2 qid:10032 1:0.056537 2:0.000000 3:0.666667 4:1.000000 5:0.067138 6:0.000000 7:0.000000 8:0.000000 9:0.000000 10:0.000000 11:0.058781 12:0.000000 13:0.591833 14:1.000000 15:0.066747 16:0.003980 17:0.000000 18:0.296296 19:0.200000 20:0.004012 21:0.946170 22:0.732324 23:0.520967 24:0.562389 25:0.000000 26:0.000000 27:0.000000 28:0.000000 29:0.504600 30:0.616488 31:0.215857 32:0.723049 33:1.000000 34:0.000000 35:0.000000 36:0.000000 37:0.953885 38:0.910033 39:0.490034 40:0.843384 41:0.000000 42:0.125000 43:0.000000 44:0.000000 45:0.000000 46:0.076923 #docid = GX029-35-5894638 inc = 0.0119881192468859 prob = 0.139842
     //0 qid:10032 1:0.279152 2:0.000000 3:0.000000 4:0.000000 5:0.279152 6:0.000000 7:0.000000 8:0.000000 9:0.000000 10:0.000000 11:0.287177 12:0.000000 13:0.000000 14:0.000000 15:0.287226 16:0.014966 17:0.076923 18:0.333333 19:0.400000 20:0.015094 21:1.000000 22:0.834615 23:1.000000 24:0.623339 25:0.000000 26:0.000000 27:0.000000 28:0.000000 29:0.000000 30:0.000000 31:0.000000 32:0.000000 33:0.000000 34:0.000000 35:0.000000 36:0.000000 37:1.000000 38:1.000000 39:1.000000 40:0.906864 41:0.500000 42:0.000000 43:0.000000 44:0.002186 45:0.250000 46:1.000000 #docid = GX030-77-6315042 inc = 1 prob = 0.341364
     //0 qid:10035 1:0.891089 2:1.000000 3:1.000000 4:0.000000 5:1.000000 6:0.000000 7:0.000000 8:0.000000 9:0.000000 10:0.000000 11:0.144213 12:1.000000 13:1.000000 14:0.000000 15:0.209717 16:0.654768 17:1.000000 18:1.000000 19:0.250000 20:0.680412 21:0.582831 22:0.569242 23:0.672193 24:0.724085 25:0.974209 26:1.000000 27:1.000000 28:1.000000 29:0.235213 30:0.000000 31:0.000000 32:0.000000 33:0.000000 34:0.000000 35:0.000000 36:0.000000 37:0.621058 38:0.610152 39:0.704347 40:0.743867 41:1.000000 42:0.207547 43:0.000000 44:0.008927 45:0.200000 46:0.166667 #docid = GX046-28-2590531 inc = 0.0121050330659901 prob = 0.119188
     //0 qid:10035 1:0.000000 2:0.000000 3:0.428571 4:0.000000 5:0.000000 6:0.000000 7:0.000000 8:0.000000 9:0.000000 10:0.000000 11:0.183841 12:0.000000 13:0.779200 14:0.000000 15:0.237050 16:0.000000 17:0.166667 18:0.113636 19:0.416667 20:0.000000 21:0.847849 22:1.000000 23:0.344452 24:0.887347 25:0.000000 26:0.000000 27:0.000000 28:0.000000 29:1.000000 30:1.000000 31:1.000000 32:1.000000 33:0.000000 34:0.000000 35:0.000000 36:0.000000 37:0.900893 38:0.951122 39:0.437382 40:0.791401 41:1.000000 42:0.452830 43:0.000000 44:0.635237 45:1.000000 46:0.000000 #docid = GX058-84-15460908 inc = 1 prob = 0.115017
-    int load_line(const char * line, XY * xy, long * qid)
+    int load_line(const char * line, XYRow * xy, long * qid, size_t * x_column_max)
     {
         const char * cur = line;
         char * end;
@@ -444,7 +640,7 @@ private:
 
         // y
         // Labels in LECTOR 4.0 are integers.
-        long _label = strtol(cur, &end, 10);
+        long _label = parse_long(cur, &end);
         if (errno == ERANGE || cur == end || _label < 0)
         {
             fprintf(stderr, "invalid y label\n");
@@ -461,7 +657,7 @@ private:
             return -1;
         }
         cur += 4;
-        *qid = strtol(cur, &end, 10);
+        *qid = parse_long(cur, &end);
         if (errno == ERANGE || cur == end)
         {
             fprintf(stderr, "invalid qid\n");
@@ -476,7 +672,7 @@ private:
             if (*cur == 0 || *cur == '\n' || *cur == '#')
                 break;
 
-            x_index = strtol(cur, &end, 10);
+            x_index = parse_long(cur, &end);
             if (errno == ERANGE || cur == end)
             {
                 fprintf(stderr, "invalid x index\n");
@@ -491,7 +687,7 @@ private:
             }
             cur = end + 1;
 
-            x_value = strtod(cur, &end);
+            x_value = parse_double(cur, &end);
             if (errno == ERANGE || cur == end)
             {
                 fprintf(stderr, "invalid x value\n");
@@ -505,59 +701,58 @@ private:
                 xy->resize_x((size_t)x_index + 1);
             xy->x(x_index) = x;
         }
-        x_column_ = xy->get_x_size();
-        if (x_column_max_ < x_column_)
-            x_column_max_ = x_column_;
+        if (*x_column_max < xy->get_x_size())
+            *x_column_max = xy->get_x_size();
         return 0;
     }
 
 public:
-    Lector4Loader() : x_column_(0), x_column_max_(0) {}
+    void resize(size_t chunks)
+    {
+        x_column_max_.assign(chunks, 0);
+        qids_.assign(chunks, std::vector<long>());
+    }
+
+    void load_chunk(size_t i, const char * begin, const char * end)
+    {
+        LineReader reader(begin, end);
+        const char * line;
+        size_t length;
+        XYRow xy;
+        long qid = UNKNOWN_QID;
+        while (reader.next(&line, &length))
+        {
+            xy.clear();
+            if (load_line(line, &xy, &qid, &x_column_max_[i]) == -1)
+                fprintf(stderr, "parse line failed:\n\"%.*s\"\n", (int)length, line);
+            qids_[i].push_back(qid);
+            sets_[i].add(xy);
+        }
+    }
 
-    int load(const char * filename, XYSet * set, std::vector<size_t> * n_samples_per_query)
+    int load(const char * filename, XYSet * set, std::vector<size_t> * n_samples_per_query, ThreadPool * pool)
     {
         assert(filename);
         assert(set);
 
-        FILE * fp = yfopen(filename, "r");
-        if (fp == 0)
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        MappedFile file;
+        if (file.open(filename) == -1)
             return -1;
-        ScopedFile fp_guard(fp);
 
-        int length = 4096;
-        char * line = (char *)xmalloc(length);
-        ScopedPtrMalloc<char *> line_guard(line);
-        char * to_read = line;
-        int total_lines = 0, bad_lines = 0;
+        load_chunks(file.begin(), file.end(), this, pool, &sets_);
 
+        // samples of a query are consecutive lines of the same qid
         bool first_qid = true;
         long qid = -1;
         size_t qid_count = 0;
-        for (;;)
+        for (size_t i=0, s=qids_.size(); i<s; i++)
         {
-            line[length-2] = 0;
-            if (fgets(to_read, length-(to_read-line), fp) == 0)
-                break;
-
-            if (line[length-2] != 0)
+            for (size_t j=0, t=qids_[i].size(); j<t; j++)
             {
-                int line_length = length - 1;
-                length = length * 2;
-                line = (char *)xrealloc(line, length);
-                line_guard.set_for_realloc(line);
-                to_read = line + line_length;
-            }
-            else
-            {
-                to_read = line;
-
-                XY xy;
                 long previous_qid = qid;
-                if (load_line(line, &xy, &qid) == -1)
-                {
-                    fprintf(stderr, "parse line failed:\n\"%s\"\n", line);
-                    bad_lines++;
-                }
+                if (qids_[i][j] != UNKNOWN_QID)
+                    qid = qids_[i][j];
 
                 if (first_qid)
                 {
@@ -576,41 +771,723 @@ public:
                         qid_count = 1;
                     }
                 }
-
-                total_lines++;
-                set->add(xy);
             }
         }
         n_samples_per_query->push_back(qid_count);
 
-        if (x_column_max_ == 0)
+        size_t x_column_max = 0;
+        for (size_t i=0, s=x_column_max_.size(); i<s; i++)
+            if (x_column_max < x_column_max_[i])
+                x_column_max = x_column_max_[i];
+        if (x_column_max == 0)
         {
             printf("deduce spec failed\n");
             return 1;
         }
 
-        printf("deduce spec: %d columns\n", (int)x_column_max_);
+        for (size_t i=0; i<x_column_max; i++)
+            set->add_x_type(kXType_Numerical);
+        set->resize_x(x_column_max);
+        for (size_t i=0, s=sets_.size(); i<s; i++)
+            sets_[i].resize_x(x_column_max);
+        set->append(&sets_);
+
+        printf("deduce spec: %d columns\n", (int)x_column_max);
         printf("loaded %d training samples, %d queries\n",
             (int)set->size(),
             (int)n_samples_per_query->size());
-
-        for (size_t i=0; i<x_column_max_; i++)
-            set->add_x_type(kXType_Numerical);
-        for (size_t i=0, s=set->size(); i<s; i++)
-            set->get(i).resize_x(x_column_max_);
+        print_load_speed(file, begin);
 
         if (set->size() == 0)
             return -1;
 
-        get_unique_x_values(set);
+        get_sorted_indices(set, pool);
         return 0;
     }
 };
 
-int load_lector4(const char * filename, XYSet * set, std::vector<size_t> * n_samples_per_query)
+int load_lector4(const char * filename, XYSet * set, std::vector<size_t> * n_samples_per_query, ThreadPool * pool)
 {
     Lector4Loader loader;
+    ThreadPoolGuard guard(pool);
     set->clear();
     n_samples_per_query->clear();
-    return loader.load(filename, set, n_samples_per_query);
+    return loader.load(filename, set, n_samples_per_query, guard.pool);
+}
+
+// "GBDTBIN" and version of binary training samples
+static const char BINARY_MAGIC[8] = {'G', 'B', 'D', 'T', 'B', 'I', 'N', 0};
+static const unsigned int BINARY_VERSION = 1;
+
+// sections of binary training samples
+enum
+{
+    kBinary_XColumns = 1,
+    kBinary_SortedIndices = 2,
+    kBinary_XBins = 4,
+};
+
+class BinaryWriter
+{
+private:
+    FILE * fp_;
+
+public:
+    explicit BinaryWriter(FILE * fp) : fp_(fp) {}
+
+    void write(const void * data, size_t size)
+    {
+        if (size != 0)
+            fwrite(data, size, 1, fp_);
+    }
+
+    void write_size(size_t size)
+    {
+        unsigned long long s = size;
+        write(&s, sizeof(s));
+    }
+};
+
+class BinaryReader
+{
+private:
+    const char * begin_;
+    const char * cur_;
+    const char * end_;
+
+public:
+    BinaryReader(const char * begin, const char * end) : begin_(begin), cur_(begin), end_(end) {}
+
+    // offset of the next byte to read in the file
+    unsigned long long offset() const {return (unsigned long long)(cur_ - begin_);}
+
+    // return -1 if the file ends
+    int skip(size_t size)
+    {
+        if ((size_t)(end_ - cur_) < size)
+            return -1;
+        cur_ += size;
+        return 0;
+    }
+
+    // return -1 if the file ends
+    int read(void * data, size_t size)
+    {
+        if ((size_t)(end_ - cur_) < size)
+            return -1;
+        if (size != 0)
+            memcpy(data, cur_, size);
+        cur_ += size;
+        return 0;
+    }
+
+    int read_size(size_t * size)
+    {
+        unsigned long long s;
+        if (read(&s, sizeof(s)) == -1)
+            return -1;
+        *size = (size_t)s;
+        return 0;
+    }
+
+    // read 'size' elements, return -1 if the file ends
+    template <class T>
+    int read_vector(size_t size, std::vector<T> * v)
+    {
+        if ((size_t)(end_ - cur_) / sizeof(T) < size)
+            return -1;
+        v->resize(size);
+        return read(size ? &(*v)[0] : 0, sizeof(T) * size);
+    }
+};
+
+int save_binary(const char * filename, const XYSet& set, size_t max_bin)
+{
+    if (set.is_sparse())
+    {
+        fprintf(stderr, "sparse training samples should be made dense before saved as binary ones\n");
+        return -1;
+    }
+
+    FILE * fp = yfopen(filename, "wb");
+    if (fp == 0)
+        return -1;
+
+    size_t size = set.size();
+    size_t x_type_size = set.get_x_type_size();
+    unsigned int sections = 0;
+    if (!set.x_columns().empty())
+        sections |= kBinary_XColumns;
+    if (!set.sorted_indices().empty())
+        sections |= kBinary_SortedIndices;
+    if (set.has_x_bins())
+        sections |= kBinary_XBins;
+    else
+        max_bin = 0;
+
+    BinaryWriter writer(fp);
+    writer.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    writer.write(&BINARY_VERSION, sizeof(BINARY_VERSION));
+    writer.write(&sections, sizeof(sections));
+    writer.write_size(size);
+    writer.write_size(x_type_size);
+    writer.write_size(set.get_x_size());
+    writer.write_size(max_bin);
+
+    for (size_t i=0; i<x_type_size; i++)
+    {
+        int x_type = (int)set.get_x_type(i);
+        writer.write(&x_type, sizeof(x_type));
+    }
+    writer.write(size ? &set.get_y_column()[0] : 0, sizeof(CompoundValue) * size);
+    for (size_t i=0; i<size; i++)
+    {
+        double weight = set.get_weight(i);
+        writer.write(&weight, sizeof(weight));
+    }
+
+    if (sections & kBinary_XColumns)
+    {
+        for (size_t i=0, s=set.get_x_size(); i<s; i++)
+            writer.write(&set.get_x_column(i)[0], sizeof(CompoundValue) * size);
+    }
+    if (sections & kBinary_SortedIndices)
+    {
+        std::vector<unsigned long long> sorted_indices(size);
+        for (size_t i=0; i<x_type_size; i++)
+        {
+            std::copy(set.get_sorted_indices(i).begin(), set.get_sorted_indices(i).end(), sorted_indices.begin());
+            writer.write(size ? &sorted_indices[0] : 0, sizeof(unsigned long long) * size);
+        }
+    }
+    if (sections & kBinary_XBins)
+    {
+        for (size_t i=0; i<x_type_size; i++)
+        {
+            const CompoundValueVector& x_values = set.get_x_values(i);
+            const XBinColumn& bins = set.get_x_bins(i);
+            writer.write_size(x_values.size());
+            writer.write(x_values.empty() ? 0 : &x_values[0], sizeof(CompoundValue) * x_values.size());
+            writer.write(bins.data(), bins.bytes());
+        }
+    }
+
+    int error = ferror(fp);
+    if (fclose(fp) != 0 || error)
+    {
+        fprintf(stderr, "write \"%s\" failed\n", filename);
+        return -1;
+    }
+    return 0;
+}
+
+class BinaryLoader
+{
+private:
+    // widths and offsets of x bins left in the file
+    std::vector<size_t> widths_;
+    std::vector<unsigned long long> offsets_;
+
+    int load_x_bins(BinaryReader * reader, XYSet * set, size_t max_bin, bool in_memory)
+    {
+        size_t size = set->size();
+        set->x_values().resize(set->get_x_type_size());
+        if (in_memory)
+            set->x_bins().resize(set->get_x_type_size());
+        for (size_t i=0, s=set->get_x_type_size(); i<s; i++)
+        {
+            size_t x_values_size;
+            if (reader->read_size(&x_values_size) == -1)
+                return -1;
+            if (x_values_size > max_bin - 1)
+            {
+                fprintf(stderr, "feature %d has more than %d split candidates\n", (int)i, (int)(max_bin - 1));
+                return -1;
+            }
+            if (reader->read_vector(x_values_size, &set->get_x_values(i)) == -1)
+                return -1;
+
+            if (!in_memory)
+            {
+                size_t width = XBinColumn::get_width(x_values_size + 1);
+                widths_.push_back(width);
+                offsets_.push_back(reader->offset());
+                if (reader->skip((size * width + 7) / 8) == -1)
+                    return -1;
+                continue;
+            }
+
+            XBinColumn& bins = set->x_bins()[i];
+            bins.init(size, x_values_size + 1);
+            if (reader->read(bins.data(), bins.bytes()) == -1)
+                return -1;
+        }
+        return 0;
+    }
+
+public:
+    int load(const char * filename, XYSet * set, size_t * max_bin, XBinFile * x_bin_file)
+    {
+        assert(filename);
+        assert(set);
+
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        MappedFile file;
+        if (file.open(filename) == -1)
+            return -1;
+
+        BinaryReader reader(file.begin(), file.end());
+        char magic[sizeof(BINARY_MAGIC)];
+        unsigned int version, sections;
+        if (reader.read(magic, sizeof(magic)) == -1
+            || memcmp(magic, BINARY_MAGIC, sizeof(magic)) != 0
+            || reader.read(&version, sizeof(version)) == -1)
+        {
+            fprintf(stderr, "\"%s\" is not binary training samples\n", filename);
+            return -1;
+        }
+        if (version != BINARY_VERSION)
+        {
+            fprintf(stderr, "version of \"%s\" is %u, but %u is supported\n", filename, version, BINARY_VERSION);
+            return -1;
+        }
+
+        size_t size, x_type_size, x_size;
+        CompoundValueVector y;
+        std::vector<double> weights;
+        if (reader.read(&sections, sizeof(sections)) == -1
+            || reader.read_size(&size) == -1
+            || reader.read_size(&x_type_size) == -1
+            || reader.read_size(&x_size) == -1
+            || reader.read_size(max_bin) == -1
+            || ((sections & kBinary_XBins) && (*max_bin < 2 || *max_bin > 65536)))
+        {
+            fprintf(stderr, "invalid header of \"%s\"\n", filename);
+            return -1;
+        }
+
+        int error = 0;
+        for (size_t i=0; i<x_type_size && !error; i++)
+        {
+            int x_type = 0;
+            error = reader.read(&x_type, sizeof(x_type));
+            set->add_x_type(x_type == kXType_Category ? kXType_Category : kXType_Numerical);
+        }
+        if (!error)
+            error = reader.read_vector(size, &y);
+        if (!error)
+            error = reader.read_vector(size, &weights);
+        if (!error)
+            set->swap_y(&y, &weights);
+
+        if (!error && (sections & kBinary_XColumns))
+        {
+            set->x_columns().resize(x_size);
+            for (size_t i=0; i<x_size && !error; i++)
+                error = reader.read_vector(size, &set->x_columns()[i]);
+        }
+        if (!error && (sections & kBinary_SortedIndices))
+        {
+            std::vector<unsigned long long> sorted_indices;
+            set->sorted_indices().resize(x_type_size);
+            for (size_t i=0; i<x_type_size && !error; i++)
+            {
+                error = reader.read_vector(size, &sorted_indices);
+                set->sorted_indices()[i].assign(sorted_indices.begin(), sorted_indices.end());
+            }
+        }
+        if (!error && (sections & kBinary_XBins))
+            error = load_x_bins(&reader, set, *max_bin, x_bin_file == 0);
+        else
+            *max_bin = 0;
+
+        if (error)
+        {
+            fprintf(stderr, "\"%s\" is truncated\n", filename);
+            return -1;
+        }
+
+        if (x_bin_file && (sections & kBinary_XBins))
+        {
+            if (x_bin_file->open(filename, size, widths_, offsets_) == -1)
+                return -1;
+            set->x_bin_file() = x_bin_file;
+        }
+
+        printf("loaded spec: %d colunms\n", (int)x_type_size);
+        printf("loaded %d training samples\n", (int)set->size());
+        print_load_speed(file, begin);
+
+        if (set->size() == 0)
+            return -1;
+        return 0;
+    }
+};
+
+int load_binary(const char * filename, XYSet * set, size_t * max_bin, XBinFile * x_bin_file)
+{
+    BinaryLoader loader;
+    set->clear();
+    return loader.load(filename, set, max_bin, x_bin_file);
+}
+
+// bin index of 'x' by split candidates 'x_values'
+static XBin get_x_bin(const CompoundValueVector& x_values, kXType x_type, const CompoundValue& x)
+{
+    if (x_type == kXType_Numerical)
+        return (XBin)(std::lower_bound(x_values.begin(), x_values.end(), x, CompoundValueDoubleLess())
+            - x_values.begin());
+
+    CompoundValueVector::const_iterator it =
+        std::lower_bound(x_values.begin(), x_values.end(), x, CompoundValueIntLess());
+    if (it != x_values.end() && it->i() == x.i())
+        return (XBin)(it - x_values.begin());
+    return (XBin)x_values.size();
+}
+
+// bin x values of features
+struct XBinTask : public ThreadTask
+{
+    XYSet * set;
+
+    explicit XBinTask(XYSet * _set) : set(_set) {}
+
+    virtual void run(size_t i)
+    {
+        const CompoundValueVector& x_values = set->get_x_values(i);
+        const CompoundValueVector& x_column = set->get_x_column(i);
+        kXType x_type = set->get_x_type(i);
+        XBinColumn& bins = set->x_bins()[i];
+        bins.init(set->size(), x_values.size() + 1);
+        for (size_t j=0, t=set->size(); j<t; j++)
+            bins.set(j, get_x_bin(x_values, x_type, x_column[j]));
+    }
+};
+
+// bin nonzero x values of features of sparse samples,
+// only those not in the bin of 0 are kept as (sample index, bin index)
+struct XSparseBinTask : public ThreadTask
+{
+    XYSet * set;
+    std::vector<std::vector<std::pair<size_t, XBin> > >& entries;
+
+    XSparseBinTask(XYSet * _set, std::vector<std::vector<std::pair<size_t, XBin> > >& _entries)
+        : set(_set), entries(_entries) {}
+
+    virtual void run(size_t i)
+    {
+        const CompoundValueVector& x_values = set->get_x_values(i);
+        XSparseColumn& x_column = set->sparse_x_columns()[i];
+        kXType x_type = set->get_x_type(i);
+        XBin zero_bin = set->x_bin_rows().get_zero_bin(i);
+        for (size_t k=0, t=x_column.indices.size(); k<t; k++)
+        {
+            XBin bin = get_x_bin(x_values, x_type, x_column.values[k]);
+            if (bin != zero_bin)
+                entries[i].push_back(std::make_pair(x_column.indices[k], bin));
+        }
+        std::vector<size_t>().swap(x_column.indices);
+        CompoundValueVector().swap(x_column.values);
+    }
+};
+
+// build x bins of sparse samples sample by sample, see XBinRows
+static void bin_sparse_x_values(XYSet * set, ThreadPool * pool)
+{
+    size_t x_type_size = set->get_x_type_size();
+    assert(x_type_size <= (size_t)(unsigned int)-1);
+    XBinRows& rows = set->x_bin_rows();
+    rows.zero_bins().resize(x_type_size);
+    for (size_t i=0; i<x_type_size; i++)
+        rows.zero_bins()[i] = get_x_bin(set->get_x_values(i), set->get_x_type(i), XSparseColumn::zero);
+
+    std::vector<std::vector<std::pair<size_t, XBin> > > entries(x_type_size);
+    XSparseBinTask task(set, entries);
+    pool->parallel_for(x_type_size, &task);
+
+    // count entries of samples, then fill them feature by feature,
+    // so that feature indices are ascending in a sample
+    std::vector<size_t>& offsets = rows.offsets();
+    offsets.assign(set->size() + 1, 0);
+    for (size_t i=0; i<x_type_size; i++)
+        for (size_t k=0, t=entries[i].size(); k<t; k++)
+            offsets[entries[i][k].first + 1]++;
+    for (size_t j=0, t=set->size(); j<t; j++)
+        offsets[j+1] += offsets[j];
+
+    rows.x_indices().resize(offsets.back());
+    rows.bins().resize(offsets.back());
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t i=0; i<x_type_size; i++)
+    {
+        for (size_t k=0, t=entries[i].size(); k<t; k++)
+        {
+            size_t p = next[entries[i][k].first]++;
+            rows.x_indices()[p] = (unsigned int)i;
+            rows.bins()[p] = entries[i][k].second;
+        }
+        std::vector<std::pair<size_t, XBin> >().swap(entries[i]);
+    }
+    std::vector<XSparseColumn>().swap(set->sparse_x_columns());
+}
+
+int bin_x_values(XYSet * set, size_t max_bin, ThreadPool * pool)
+{
+    assert(set);
+    assert(max_bin >= 2 && max_bin - 1 <= (size_t)(XBin)-1);
+
+    if (set->size() == 0 || set->get_x_values_size() != set->get_x_type_size())
+    {
+        fprintf(stderr, "build x bins failed\n");
+        return -1;
+    }
+    for (size_t i=0, s=set->get_x_type_size(); i<s; i++)
+    {
+        if (set->get_x_values(i).size() > max_bin - 1)
+        {
+            fprintf(stderr, "feature %d has more than %d split candidates\n", (int)i, (int)(max_bin - 1));
+            return -1;
+        }
+    }
+
+    if (set->is_sparse())
+    {
+        bin_sparse_x_values(set, pool);
+        return 0;
+    }
+
+    set->x_bins().resize(set->get_x_type_size());
+    XBinTask task(set);
+    pool->parallel_for(set->get_x_type_size(), &task);
+
+    std::vector<std::vector<size_t> >().swap(set->sorted_indices());
+    std::vector<CompoundValueVector>().swap(set->x_columns());
+    return 0;
+}
+
+// make x values of a feature of sparse samples dense
+struct DensifyTask : public ThreadTask
+{
+    XYSet * set;
+
+    explicit DensifyTask(XYSet * _set) : set(_set) {}
+
+    virtual void run(size_t i)
+    {
+        XSparseColumn& sparse_x_column = set->sparse_x_columns()[i];
+        CompoundValueVector& x_column = set->x_columns()[i];
+        x_column.resize(set->size());
+        for (size_t k=0, t=sparse_x_column.indices.size(); k<t; k++)
+            x_column[sparse_x_column.indices[k]] = sparse_x_column.values[k];
+        std::vector<size_t>().swap(sparse_x_column.indices);
+        CompoundValueVector().swap(sparse_x_column.values);
+    }
+};
+
+void densify_x(XYSet * set, ThreadPool * pool)
+{
+    assert(set);
+    if (!set->is_sparse())
+        return;
+    assert(!set->has_x_bins());
+
+    size_t x_size = set->get_x_size();
+    set->x_columns().resize(x_size);
+    DensifyTask task(set);
+    pool->parallel_for(x_size, &task);
+    std::vector<XSparseColumn>().swap(set->sparse_x_columns());
+    get_sorted_indices(set, pool);
+}
+
+int build_x_bins(XYSet * set, size_t max_bin, ThreadPool * pool)
+{
+    assert(set);
+    assert(max_bin >= 2);
+
+    std::vector<XSketch> sketches;
+    sketch_x_values(*set, max_bin - 1, &sketches, pool);
+    get_x_values(sketches, max_bin - 1, set);
+    return bin_x_values(set, max_bin, pool);
+}
+
+// at most so many bundles, the latest ones, are tried for a feature
+static const size_t MAX_BUNDLE_SEARCH = 64;
+
+// a bundle being built, see "bundle_x_bins"
+struct XBundleBuilder
+{
+    std::vector<size_t> x_indices;
+    // bin indices of the bundle, 0 for samples of none of its features
+    size_t bin_size;
+    // samples in which more than one feature of the bundle are not in their bins of 0
+    size_t conflicts;
+    // bits of samples in which a feature of the bundle is not in its bin of 0
+    std::vector<unsigned char> marks;
+
+    explicit XBundleBuilder(size_t n) : bin_size(1), conflicts(0), marks((n + 7) / 8, 0) {}
+
+    bool marked(size_t j) const {return (marks[j >> 3] >> (j & 7)) & 1;}
+    void mark(size_t j) {marks[j >> 3] |= (unsigned char)(1 << (j & 7));}
+};
+
+// fill bin indices of a bundle from x bins stored sample by sample
+struct XBundleTask : public ThreadTask
+{
+    XYSet * set;
+    const std::vector<XBundleBuilder>& builders;
+    // samples[i] is samples in which the ith feature is not in its bin of 0
+    const std::vector<std::vector<size_t> >& samples;
+
+    XBundleTask(
+        XYSet * _set,
+        const std::vector<XBundleBuilder>& _builders,
+        const std::vector<std::vector<size_t> >& _samples)
+        : set(_set), builders(_builders), samples(_samples) {}
+
+    virtual void run(size_t b)
+    {
+        const XBinRows& rows = set->x_bin_rows();
+        XBundles& x_bundles = set->x_bundles();
+        XBundle& bundle = x_bundles.bundles()[b];
+        const std::vector<size_t>& x_indices = builders[b].x_indices;
+        bundle.bins.init(set->size(), builders[b].bin_size);
+        // in conflicting samples, the feature of the larger index is kept
+        for (size_t i=0, s=x_indices.size(); i<s; i++)
+        {
+            size_t x_index = x_indices[i];
+            XBin start = x_bundles.starts()[x_index];
+            const std::vector<size_t>& _samples = samples[x_index];
+            for (size_t k=0, t=_samples.size(); k<t; k++)
+                bundle.bins.set(_samples[k], (XBin)(start + rows.get(_samples[k], x_index)));
+        }
+    }
+};
+
+size_t bundle_x_bins(XYSet * set, double max_conflict_rate, ThreadPool * pool)
+{
+    assert(set);
+    const size_t npos = (size_t)-1;
+    XBinRows& rows = set->x_bin_rows();
+    if (rows.empty())
+        return 0;
+
+    size_t n = set->size();
+    size_t x_size = set->get_x_type_size();
+    std::vector<std::vector<size_t> > samples(x_size);
+    for (size_t j=0; j<n; j++)
+        for (size_t k=rows.begin(j), e=rows.end(j); k<e; k++)
+            samples[rows.get_x_index(k)].push_back(j);
+
+    // features of more samples are bundled first, those always in their bins of 0 are in no bundle
+    std::vector<std::pair<size_t, size_t> > order;
+    for (size_t i=0; i<x_size; i++)
+        if (!samples[i].empty())
+            order.push_back(std::make_pair(n - samples[i].size(), i));
+    std::sort(order.begin(), order.end());
+
+    // bundles are used only if they take less memory than x bins stored sample by sample,
+    // a bundle takes at least 4 bits per sample
+    double row_bytes = (double)sizeof(size_t) * (n + 1)
+        + (double)(sizeof(unsigned int) + sizeof(XBin)) * rows.x_indices().size();
+    size_t max_bundle_size = (size_t)(row_bytes / ((double)n / 2));
+    size_t max_conflicts = (size_t)(max_conflict_rate * n);
+    std::vector<XBundleBuilder> builders;
+    std::vector<size_t> bundle_of(x_size, npos);
+    std::vector<XBin> starts(x_size, 0);
+    std::vector<size_t> bin_sizes(x_size, 0);
+    for (size_t o=0, s=order.size(); o<s; o++)
+    {
+        size_t x_index = order[o].second;
+        const std::vector<size_t>& _samples = samples[x_index];
+        size_t bin_size = set->get_x_values(x_index).size() + 1;
+        if (bin_size + 1 > (size_t)(XBin)-1 + 1)
+        {
+            printf("features are not bundled, feature %d has too many bins\n", (int)x_index);
+            return 0;
+        }
+        size_t bundle = npos;
+        size_t conflicts = 0;
+        for (size_t b=builders.size(); b>0 && b+MAX_BUNDLE_SEARCH>builders.size(); b--)
+        {
+            const XBundleBuilder& builder = builders[b-1];
+            if (builder.bin_size + bin_size > (size_t)(XBin)-1 + 1)
+                continue;
+            conflicts = builder.conflicts;
+            for (size_t k=0, t=_samples.size(); k<t && conflicts<=max_conflicts; k++)
+                conflicts += builder.marked(_samples[k]);
+            if (conflicts <= max_conflicts)
+            {
+                bundle = b - 1;
+                break;
+            }
+        }
+        if (bundle == npos)
+        {
+            if (builders.size() == max_bundle_size)
+            {
+                printf("features are not bundled, their bundles take more memory\n");
+                return 0;
+            }
+            bundle = builders.size();
+            builders.push_back(XBundleBuilder(n));
+            conflicts = 0;
+        }
+
+        XBundleBuilder& builder = builders[bundle];
+        builder.x_indices.push_back(x_index);
+        builder.conflicts = conflicts;
+        for (size_t k=0, t=_samples.size(); k<t; k++)
+            builder.mark(_samples[k]);
+        bundle_of[x_index] = bundle;
+        starts[x_index] = (XBin)builder.bin_size;
+        bin_sizes[x_index] = bin_size;
+        builder.bin_size += bin_size;
+    }
+
+    double bundle_bytes = 0.0;
+    for (size_t b=0, s=builders.size(); b<s; b++)
+        bundle_bytes += (double)n * XBinColumn::get_width(builders[b].bin_size) / 8;
+    if (builders.empty() || bundle_bytes >= row_bytes)
+    {
+        printf("features are not bundled, their bundles take more memory\n");
+        return 0;
+    }
+
+    XBundles& x_bundles = set->x_bundles();
+    x_bundles.bundle_of() = bundle_of;
+    x_bundles.starts() = starts;
+    x_bundles.bin_sizes() = bin_sizes;
+    x_bundles.zero_bins() = rows.zero_bins();
+    x_bundles.bundles().resize(builders.size());
+
+    // bins of all features in histograms, see Histogram
+    std::vector<size_t> hist_offsets(x_size);
+    for (size_t i=1; i<x_size; i++)
+        hist_offsets[i] = hist_offsets[i-1] + set->get_x_values(i-1).size() + 1;
+    for (size_t b=0, s=builders.size(); b<s; b++)
+    {
+        std::vector<size_t>& hist_indices = x_bundles.bundles()[b].hist_indices;
+        const std::vector<size_t>& x_indices = builders[b].x_indices;
+        hist_indices.resize(builders[b].bin_size);
+        hist_indices[0] = hist_offsets[x_indices[0]] + x_bundles.get_zero_bin(x_indices[0]);
+        for (size_t i=0, t=x_indices.size(); i<t; i++)
+        {
+            size_t x_index = x_indices[i];
+            for (size_t k=0; k<bin_sizes[x_index]; k++)
+                hist_indices[starts[x_index] + k] = hist_offsets[x_index] + k;
+        }
+    }
+
+    // features of a bundle are filled in ascending order
+    for (size_t b=0, s=builders.size(); b<s; b++)
+    {
+        std::sort(builders[b].x_indices.begin(), builders[b].x_indices.end());
+        std::vector<unsigned char>().swap(builders[b].marks);
+    }
+    XBundleTask task(set, builders, samples);
+    pool->parallel_for(builders.size(), &task);
+    rows.clear();
+
+    printf("bundled %d sparse features into %d bundles\n", (int)order.size(), (int)builders.size());
+    return builders.size();
 }
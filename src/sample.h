@@ -1,9 +1,15 @@
 #ifndef GBDT_TRAINING_SAMPLE_H
 #define GBDT_TRAINING_SAMPLE_H
 
+#include <assert.h>
 #include <stddef.h>
+#include <string.h>
+#include <algorithm>
 #include <vector>
 
+class ThreadPool;
+class XBinFile;
+
 #if !defined EPS
 # define EPS (1e-9)
 #endif
@@ -50,6 +56,236 @@ public:
 
 typedef std::vector<CompoundValue> CompoundValueVector;
 
+// bin index of a x value, see "build_x_bins"
+typedef unsigned short XBin;
+
+// Readers of packed bin indices, 'Width' is bits of a bin index.
+// Two 4-bit bin indices are packed in a byte, the lower half first.
+template <size_t Width>
+struct XBinReader;
+
+template <>
+struct XBinReader<4>
+{
+    static XBin get(const unsigned char * data, size_t i)
+    {
+        return (XBin)((data[i >> 1] >> ((i & 1) << 2)) & 0x0f);
+    }
+};
+
+template <>
+struct XBinReader<8>
+{
+    static XBin get(const unsigned char * data, size_t i)
+    {
+        return (XBin)data[i];
+    }
+};
+
+template <>
+struct XBinReader<16>
+{
+    static XBin get(const unsigned char * data, size_t i)
+    {
+        XBin bin;
+        memcpy(&bin, data + i * sizeof(XBin), sizeof(XBin));
+        return bin;
+    }
+};
+
+// bin indices of a feature of all samples,
+// stored in the narrowest width for the number of bins of the feature:
+// 4 bits for at most 16 bins, 8 bits for at most 256 bins, 16 bits for the others.
+class XBinColumn
+{
+private:
+    size_t width_;
+    std::vector<unsigned char> data_;
+
+public:
+    XBinColumn() : width_(16) {}
+
+    // width of bin indices less than 'bin_size'
+    static size_t get_width(size_t bin_size)
+    {
+        if (bin_size <= 16)
+            return 4;
+        else if (bin_size <= 256)
+            return 8;
+        else
+            return 16;
+    }
+
+    // 'size' bin indices of 0, the largest one is less than 'bin_size'
+    void init(size_t size, size_t bin_size)
+    {
+        width_ = get_width(bin_size);
+        data_.assign((size * width_ + 7) / 8, 0);
+    }
+
+    size_t width() const {return width_;}
+    unsigned char * data() {return &data_[0];}
+    const unsigned char * data() const {return &data_[0];}
+    // bytes of packed bin indices
+    size_t bytes() const {return data_.size();}
+
+    XBin get(size_t i) const
+    {
+        if (width_ == 4)
+            return XBinReader<4>::get(&data_[0], i);
+        else if (width_ == 8)
+            return XBinReader<8>::get(&data_[0], i);
+        else
+            return XBinReader<16>::get(&data_[0], i);
+    }
+
+    void set(size_t i, XBin bin)
+    {
+        if (width_ == 4)
+        {
+            size_t shift = (i & 1) << 2;
+            unsigned char& byte = data_[i >> 1];
+            byte = (unsigned char)((byte & ~(0x0f << shift)) | (bin << shift));
+        }
+        else if (width_ == 8)
+        {
+            data_[i] = (unsigned char)bin;
+        }
+        else
+        {
+            memcpy(&data_[i * sizeof(XBin)], &bin, sizeof(XBin));
+        }
+    }
+};
+
+// nonzero x values of a feature of sparse training samples(CSC), in the order of samples,
+// features of sparse samples are numerical and absent ones are 0, as liblinear ones
+struct XSparseColumn
+{
+    // indices of samples having nonzero x values
+    std::vector<size_t> indices;
+    CompoundValueVector values;
+
+    static const CompoundValue zero;
+
+    // x value of the ith sample
+    const CompoundValue& get(size_t i) const
+    {
+        std::vector<size_t>::const_iterator it = std::lower_bound(indices.begin(), indices.end(), i);
+        if (it == indices.end() || *it != i)
+            return zero;
+        return values[it - indices.begin()];
+    }
+};
+
+// Bin indices of sparse training samples, stored sample by sample(CSR).
+// Bin indices equal to the bin of 0 of their features are not stored,
+// so a sample takes time and memory proportional to its nonzero features.
+class XBinRows
+{
+private:
+    // entries of the jth sample are [offsets_[j], offsets_[j+1])
+    std::vector<size_t> offsets_;
+    // feature indices of entries, ascending in a sample
+    std::vector<unsigned int> x_indices_;
+    std::vector<XBin> bins_;
+    // zero_bins_[i] is the bin index of 0 of the ith feature
+    std::vector<XBin> zero_bins_;
+
+public:
+    bool empty() const {return offsets_.empty();}
+    std::vector<size_t>& offsets() {return offsets_;}
+    std::vector<unsigned int>& x_indices() {return x_indices_;}
+    std::vector<XBin>& bins() {return bins_;}
+    std::vector<XBin>& zero_bins() {return zero_bins_;}
+
+    size_t begin(size_t j) const {return offsets_[j];}
+    size_t end(size_t j) const {return offsets_[j+1];}
+    size_t get_x_index(size_t k) const {return x_indices_[k];}
+    XBin get_bin(size_t k) const {return bins_[k];}
+    XBin get_zero_bin(size_t x_index) const {return zero_bins_[x_index];}
+
+    // bin index of the ith feature of the jth sample
+    XBin get(size_t j, size_t x_index) const
+    {
+        std::vector<unsigned int>::const_iterator first = x_indices_.begin() + offsets_[j];
+        std::vector<unsigned int>::const_iterator last = x_indices_.begin() + offsets_[j+1];
+        std::vector<unsigned int>::const_iterator it = std::lower_bound(first, last, (unsigned int)x_index);
+        if (it == last || *it != x_index)
+            return zero_bins_[x_index];
+        return bins_[it - x_indices_.begin()];
+    }
+
+    void clear()
+    {
+        std::vector<size_t>().swap(offsets_);
+        std::vector<unsigned int>().swap(x_indices_);
+        std::vector<XBin>().swap(bins_);
+        zero_bins_.clear();
+    }
+};
+
+// sparse features rarely nonzero in the same sample, whose bin indices are stored in one column,
+// see "bundle_x_bins"
+struct XBundle
+{
+    // bin index 0 means all features of the bundle are in their bins of 0,
+    // bin indices of a feature are shifted to its own range, see XBundles
+    XBinColumn bins;
+    // hist_indices[b] is the index of bin index b in histograms of all features, see Histogram,
+    // samples in bin index 0 are added to the bin of 0 of the first feature, which is filled up later
+    std::vector<size_t> hist_indices;
+};
+
+// bundles of features of sparse samples
+class XBundles
+{
+private:
+    std::vector<XBundle> bundles_;
+    // bundle_of_[i] is the bundle of the ith feature, -1 if it is always in its bin of 0,
+    // its bin indices in the bundle are [starts_[i], starts_[i] + bin_sizes_[i])
+    std::vector<size_t> bundle_of_;
+    std::vector<XBin> starts_;
+    std::vector<size_t> bin_sizes_;
+    std::vector<XBin> zero_bins_;
+
+public:
+    bool empty() const {return bundles_.empty();}
+    size_t size() const {return bundles_.size();}
+    std::vector<XBundle>& bundles() {return bundles_;}
+    const XBundle& get_bundle(size_t i) const {return bundles_[i];}
+    std::vector<size_t>& bundle_of() {return bundle_of_;}
+    std::vector<XBin>& starts() {return starts_;}
+    std::vector<size_t>& bin_sizes() {return bin_sizes_;}
+    std::vector<XBin>& zero_bins() {return zero_bins_;}
+    XBin get_zero_bin(size_t x_index) const {return zero_bins_[x_index];}
+    size_t get_bundle_of(size_t x_index) const {return bundle_of_[x_index];}
+    XBin get_start(size_t x_index) const {return starts_[x_index];}
+    size_t get_bin_size(size_t x_index) const {return bin_sizes_[x_index];}
+
+    // bin index of the ith feature of the jth sample
+    XBin get(size_t j, size_t x_index) const
+    {
+        size_t bundle = bundle_of_[x_index];
+        if (bundle == (size_t)-1)
+            return zero_bins_[x_index];
+        XBin bin = bundles_[bundle].bins.get(j);
+        XBin start = starts_[x_index];
+        if (bin < start || bin >= start + bin_sizes_[x_index])
+            return zero_bins_[x_index];
+        return (XBin)(bin - start);
+    }
+
+    void clear()
+    {
+        std::vector<XBundle>().swap(bundles_);
+        bundle_of_.clear();
+        starts_.clear();
+        bin_sizes_.clear();
+        zero_bins_.clear();
+    }
+};
+
 struct CompoundValueDoubleLess
 {
     bool operator()(const CompoundValue& a, const CompoundValue& b) const
@@ -74,37 +310,77 @@ struct CompoundValueIntEqual
     }
 };
 
-// a training sample
-class XY
+// a training sample being loaded, it is added to a XYSet by 'XYSet::add'
+class XYRow
 {
 private:
     CompoundValueVector X_;// X, features
+    // Feature indices of X of a sparse row, x(i) is the x_indices_[i]th feature,
+    // they are added by "add_sparse_x" and the row is added by 'XYSet::add_sparse'.
+    std::vector<size_t> x_indices_;
     CompoundValue y_;// y or label
-#if !defined DISABLE_WEIGHT
     double weight_;
-#endif
 
 public:
+    XYRow() {clear();}
+
     size_t get_x_size() const {return X_.size();}
     CompoundValue& x(size_t i) {return X_[i];}
     const CompoundValue& x(size_t i) const {return X_[i];}
     const CompoundValueVector& X() const {return X_;}
     void add_x(const CompoundValue& _x) {X_.push_back(_x);}
     void resize_x(size_t s) {X_.resize(s);}
+    size_t get_x_index(size_t i) const {return x_indices_[i];}
+    void add_sparse_x(size_t x_index, const CompoundValue& _x)
+    {
+        x_indices_.push_back(x_index);
+        X_.push_back(_x);
+    }
 
+    const CompoundValue& y_value() const {return y_;}
     double& y() {return y_.d();}
     double y() const {return y_.d();}
 
     size_t& label() {return y_.label();}
     size_t label() const {return y_.label();}
 
-#if defined DISABLE_WEIGHT
-    void set_weight(double weight) {}
-    double weight() const {return 1.0;}
-#else
     void set_weight(double weight) {weight_ = weight;}
     double weight() const {return weight_;}
-#endif
+
+    // keep the capacity of X, so that a row can be reused without allocations
+    void clear()
+    {
+        X_.clear();
+        x_indices_.clear();
+        y_ = CompoundValue();
+        weight_ = 1.0;
+    }
+};
+
+class XYSet;
+
+// a training sample in a XYSet,
+// it is a view of the column-major storage of the set.
+class XY
+{
+private:
+    const XYSet * set_;
+    size_t i_;
+
+public:
+    XY(const XYSet * set, size_t i) : set_(set), i_(i) {}
+
+    inline size_t get_x_size() const;
+    inline const CompoundValue& x(size_t i) const;
+    // bin index of the ith feature, only if x bins are built in memory
+    inline XBin x_bin(size_t i) const;
+    inline bool has_x_bins() const;
+    // copy X, features, for prediction
+    inline void get_X(CompoundValueVector * X) const;
+
+    inline double y() const;
+    inline size_t label() const;
+    inline double weight() const;
 };
 
 struct XYLabelGreater
@@ -113,30 +389,55 @@ struct XYLabelGreater
     {
         return a.label() > b.label();
     }
-
-    bool operator()(const XY * a, const XY * b) const
-    {
-        return a->label() > b->label();
-    }
 };
 
-// a set of training samples
+// a set of training samples, stored column by column
 class XYSet
 {
 private:
     XYSpec spec_;
+    // x_values_[i] is sorted split candidates of the ith feature.
+    // It is only built for histogram-based splitting.
     std::vector<CompoundValueVector> x_values_;
-    std::vector<XY> samples_;
+    // x_bins_[i].get(j) is the bin index of the ith feature of the jth sample.
+    // It is only built for histogram-based splitting.
+    std::vector<XBinColumn> x_bins_;
+    // If it is not 0, x bins are not in memory but read from it in blocks for out-of-core training,
+    // see "load_binary", and 'x_bins_' is empty.
+    const XBinFile * x_bin_file_;
+    // sorted_indices_[i] is indices of samples sorted by the ith feature.
+    // It is only built for exact splitting.
+    std::vector<std::vector<size_t> > sorted_indices_;
+    // x_columns_[i][j] is the ith feature of the jth sample.
+    // It is released when x bins are built.
+    std::vector<CompoundValueVector> x_columns_;
+    // Nonzero x values of sparse samples, see "add_sparse", 'x_columns_' is empty then.
+    // It is released when x bins are built, or when it is made dense by "densify_x".
+    std::vector<XSparseColumn> sparse_x_columns_;
+    // x bins of sparse samples, 'x_bins_' is empty then.
+    XBinRows x_bin_rows_;
+    // x bins of sparse samples in bundles of features, 'x_bin_rows_' is released then, see "bundle_x_bins"
+    XBundles x_bundles_;
+    // y or label of samples
+    CompoundValueVector y_;
+#if !defined DISABLE_WEIGHT
+    std::vector<double> weights_;
+#endif
 
 public:
+    XYSet() : x_bin_file_(0) {}
+
     XYSpec& spec() {return spec_;}
     const XYSpec& spec() const {return spec_;}
 
     std::vector<CompoundValueVector>& x_values() {return x_values_;}
     const std::vector<CompoundValueVector>& x_values() const {return x_values_;}
 
-    std::vector<XY>& sample() {return samples_;}
-    const std::vector<XY>& sample() const {return samples_;}
+    std::vector<XBinColumn>& x_bins() {return x_bins_;}
+    const std::vector<XBinColumn>& x_bins() const {return x_bins_;}
+
+    std::vector<std::vector<size_t> >& sorted_indices() {return sorted_indices_;}
+    const std::vector<std::vector<size_t> >& sorted_indices() const {return sorted_indices_;}
 
     size_t get_x_type_size() const {return spec_.get_x_type_size();}
     kXType get_x_type(size_t i) const {return spec_.get_x_type(i);}
@@ -147,79 +448,307 @@ public:
     const CompoundValueVector& get_x_values(size_t i) const {return x_values_[i];}
     void add_x_values(const CompoundValueVector& x_values) {x_values_.push_back(x_values);}
 
-    size_t size() const {return samples_.size();}
-    XY& get(size_t i) {return samples_[i];}
-    const XY& get(size_t i) const {return samples_[i];}
-    void add(const XY& xy) {samples_.push_back(xy);}
+    bool has_x_bins() const {return !x_bins_.empty() || x_bin_file_ || !x_bin_rows_.empty() || !x_bundles_.empty();}
+    const XBinColumn& get_x_bins(size_t i) const {return x_bins_[i];}
+    XBinRows& x_bin_rows() {return x_bin_rows_;}
+    const XBinRows& x_bin_rows() const {return x_bin_rows_;}
+    XBundles& x_bundles() {return x_bundles_;}
+    const XBundles& x_bundles() const {return x_bundles_;}
+    // bin index of 0 of the ith feature of sparse samples
+    XBin get_zero_bin(size_t x_index) const
+    {
+        if (!x_bundles_.empty())
+            return x_bundles_.get_zero_bin(x_index);
+        return x_bin_rows_.get_zero_bin(x_index);
+    }
+    // bin index of the ith feature of the jth sample
+    XBin get_x_bin(size_t j, size_t x_index) const
+    {
+        if (!x_bundles_.empty())
+            return x_bundles_.get(j, x_index);
+        if (!x_bin_rows_.empty())
+            return x_bin_rows_.get(j, x_index);
+        return x_bins_[x_index].get(j);
+    }
+    const XBinFile *& x_bin_file() {return x_bin_file_;}
+    const XBinFile * x_bin_file() const {return x_bin_file_;}
+
+    const std::vector<size_t>& get_sorted_indices(size_t i) const {return sorted_indices_[i];}
+
+    std::vector<CompoundValueVector>& x_columns() {return x_columns_;}
+    const std::vector<CompoundValueVector>& x_columns() const {return x_columns_;}
+
+    std::vector<XSparseColumn>& sparse_x_columns() {return sparse_x_columns_;}
+    const XSparseColumn& get_sparse_x_column(size_t i) const {return sparse_x_columns_[i];}
+    // samples are sparse if they are added by "add_sparse", even after x bins are built
+    bool is_sparse() const {return !sparse_x_columns_.empty() || !x_bin_rows_.empty() || !x_bundles_.empty();}
+
+    size_t get_x_size() const {return sparse_x_columns_.empty() ? x_columns_.size() : sparse_x_columns_.size();}
+    const CompoundValueVector& get_x_column(size_t i) const {return x_columns_[i];}
+    // features beyond sparse samples are 0
+    const CompoundValue& get_x(size_t i, size_t x_index) const
+    {
+        if (!sparse_x_columns_.empty())
+            return x_index < sparse_x_columns_.size() ? sparse_x_columns_[x_index].get(i) : XSparseColumn::zero;
+        return x_columns_[x_index][i];
+    }
+    double get_y(size_t i) const {return y_[i].d();}
+    size_t get_label(size_t i) const {return y_[i].label();}
+#if defined DISABLE_WEIGHT
+    double get_weight(size_t i) const {return 1.0;}
+#else
+    double get_weight(size_t i) const {return weights_[i];}
+#endif
+
+    size_t size() const {return y_.size();}
+    XY get(size_t i) const {return XY(this, i);}
+    // append a sample, features not in 'xy' are 0
+    void add(const XYRow& xy);
+    // append a sparse sample, whose features are added by 'XYRow::add_sparse_x'
+    void add_sparse(const XYRow& xy);
+    // make every sample have 's' features, new features are 0
+    void resize_x(size_t s);
+    // move samples of 'sets' to the end in order, they must have as many features as this set,
+    // or no more features if they are sparse
+    void append(std::vector<XYSet> * sets);
+
+    // y or label of all samples
+    const CompoundValueVector& get_y_column() const {return y_;}
+    // swap y and weights of all samples with 'y' and 'weights',
+    // x columns are set separately, 'weights' is ignored if DISABLE_WEIGHT is defined
+    void swap_y(CompoundValueVector * y, std::vector<double> * weights);
 
     void clear()
     {
         spec_.clear();
-        samples_.clear();
+        x_values_.clear();
+        x_bins_.clear();
+        x_bin_file_ = 0;
+        sorted_indices_.clear();
+        x_columns_.clear();
+        sparse_x_columns_.clear();
+        x_bin_rows_.clear();
+        x_bundles_.clear();
+        y_.clear();
+#if !defined DISABLE_WEIGHT
+        weights_.clear();
+#endif
     }
 };
 
-// external reference to a set of training samples
+inline size_t XY::get_x_size() const {return set_->get_x_size();}
+inline const CompoundValue& XY::x(size_t i) const {return set_->get_x(i_, i);}
+inline XBin XY::x_bin(size_t i) const {return set_->get_x_bin(i_, i);}
+inline bool XY::has_x_bins() const {return set_->has_x_bins();}
+inline double XY::y() const {return set_->get_y(i_);}
+inline size_t XY::label() const {return set_->get_label(i_);}
+inline double XY::weight() const {return set_->get_weight(i_);}
+
+inline void XY::get_X(CompoundValueVector * X) const
+{
+    X->resize(get_x_size());
+    for (size_t i=0, s=X->size(); i<s; i++)
+        (*X)[i] = x(i);
+}
+
+// external reference to a subset of training samples
 class XYSetRef
 {
 private:
-    // training sample specifications
-    const XYSpec * spec_;
-    // x_values_[i] is a collection of pre-sorted x values of the ith feature.
-    // It is used when tree is being split.
-    const std::vector<CompoundValueVector> * x_values_;
-    // training samples
-    std::vector<const XY *> samples_;
+    // the referred set, its specifications, x values and x bins are shared
+    const XYSet * set_;
+    // indices_[i] is the index of the ith sample in the referred set
+    std::vector<size_t> indices_;
+    // weights_[i] is the weight of the ith sample scaled by sampling,
+    // empty if weights of the referred set are used, see "add"
+    std::vector<double> weights_;
+    // x_used_[i] is whether the ith feature is used, empty if all features are used, see "use_x"
+    std::vector<char> x_used_;
+    // bundle_hist_indices_[b] is XBundle::hist_indices of the bth bundle in histograms of used features,
+    // empty if none of its features is used, only when not all features are used
+    std::vector<std::vector<size_t> > bundle_hist_indices_;
+    // whether all samples weigh 1, see "find_unit_weights"
+    bool unit_weights_;
 
 public:
     XYSetRef() {clear();}
 
-    const XYSpec *& spec() {return spec_;}
-    const XYSpec * spec() const {return spec_;}
+    const XYSet *& set() {return set_;}
+    const XYSet * set() const {return set_;}
 
-    const std::vector<CompoundValueVector> *& x_values() {return x_values_;}
-    const std::vector<CompoundValueVector> * x_values() const {return x_values_;}
+    size_t get_x_type_size() const {return set_->get_x_type_size();}
+    kXType get_x_type(size_t i) const {return set_->get_x_type(i);}
 
-    std::vector<const XY *>& sample() {return samples_;}
-    const std::vector<const XY *>& sample() const {return samples_;}
+    size_t get_x_values_size() const {return set_->get_x_values_size();}
+    const CompoundValueVector& get_x_values(size_t i) const {return set_->get_x_values(i);}
 
-    size_t get_x_type_size() const {return spec_->get_x_type_size();}
-    kXType get_x_type(size_t i) const {return spec_->get_x_type(i);}
+    bool has_x_bins() const {return set_->has_x_bins();}
+    const XBinColumn& get_x_bins(size_t i) const {return set_->get_x_bins(i);}
+    const XBinFile * x_bin_file() const {return set_->x_bin_file();}
+    bool is_sparse() const {return set_->is_sparse();}
+    const XBinRows& get_x_bin_rows() const {return set_->x_bin_rows();}
+    const XBundles& get_x_bundles() const {return set_->x_bundles();}
+    XBin get_zero_bin(size_t x_index) const {return set_->get_zero_bin(x_index);}
 
-    size_t get_x_values_size() const {return x_values_->size();}
-    const CompoundValueVector& get_x_values(size_t i) const {return (*x_values_)[i];}
+    bool uses_x(size_t i) const {return x_used_.empty() || x_used_[i] != 0;}
+    const std::vector<char>& x_used() const {return x_used_;}
+    // hist indices of the ith bundle, see XBundle, 0 if none of its features is used
+    const size_t * get_hist_indices(size_t i) const
+    {
+        if (x_used_.empty())
+            return &get_x_bundles().get_bundle(i).hist_indices[0];
+        const std::vector<size_t>& hist_indices = bundle_hist_indices_[i];
+        return hist_indices.empty() ? 0 : &hist_indices[0];
+    }
+    // Use only features whose 'x_used' are nonzero,
+    // histograms of the others are empty, and candidates of them are not searched.
+    // Features should have been bundled if they are bundled at all.
+    void use_x(const std::vector<char>& x_used);
 
-    size_t size() const {return samples_.size();}
-    const XY& get(size_t i) const {return *samples_[i];}
+    // x_column[get_index(i)] is the x of the ith sample
+    const CompoundValueVector& get_x_column(size_t i) const {return set_->get_x_column(i);}
+
+    size_t size() const {return indices_.size();}
+    XY get(size_t i) const {return set_->get(indices_[i]);}
+    double get_weight(size_t i) const
+    {
+        return weights_.empty() ? set_->get_weight(indices_[i]) : weights_[i];
+    }
+    size_t get_index(size_t i) const {return indices_[i];}
+    const size_t * get_indices() const {return indices_.empty() ? 0 : &indices_[0];}
+    bool unit_weights() const {return unit_weights_;}
+    // Find whether all samples weigh 1 after they are added,
+    // kernels over samples are specialized for it then, see UnitWeights.
+    void find_unit_weights()
+    {
+        unit_weights_ = true;
+        for (size_t i=0, s=size(); i<s && unit_weights_; i++)
+            unit_weights_ = get_weight(i) == 1.0;
+    }
+    // the first sample whose index in the referred set is not less than 'index',
+    // indices are ascending, since samples are added in order
+    size_t lower_bound(size_t index) const
+    {
+        return (size_t)(std::lower_bound(indices_.begin(), indices_.end(), index) - indices_.begin());
+    }
 
     void load(const XYSet& set)
     {
-        spec_ = &set.spec();
-        x_values_ = &set.x_values();
-        samples_.clear();
+        set_ = &set;
+        indices_.resize(set.size());
         for (size_t i=0, s=set.size(); i<s; i++)
-            add(set.get(i));
+            indices_[i] = i;
+        weights_.clear();
+        x_used_.clear();
+        bundle_hist_indices_.clear();
+        unit_weights_ = false;
+    }
+
+    void add(size_t index)
+    {
+        assert(weights_.empty());
+        indices_.push_back(index);
     }
 
-    void add(const XY& xy)
+    // add a sample whose weight is scaled by 'scale',
+    // either all samples or none are added by it
+    void add(size_t index, double scale)
     {
-        samples_.push_back(&xy);
+        assert(weights_.size() == indices_.size());
+        indices_.push_back(index);
+        weights_.push_back(set_->get_weight(index) * scale);
     }
 
     void clear()
     {
-        spec_ = 0;
-        x_values_ = 0;
-        samples_.clear();
+        set_ = 0;
+        std::vector<size_t>().swap(indices_);
+        std::vector<double>().swap(weights_);
+        std::vector<char>().swap(x_used_);
+        std::vector<std::vector<size_t> >().swap(bundle_hist_indices_);
+        unit_weights_ = false;
     }
+
+    // empty it but keep its memory for samples added later
+    void reset()
+    {
+        set_ = 0;
+        indices_.clear();
+        weights_.clear();
+        x_used_.clear();
+        bundle_hist_indices_.clear();
+        unit_weights_ = false;
+    }
+
+    void swap(XYSetRef& other)
+    {
+        std::swap(set_, other.set_);
+        indices_.swap(other.indices_);
+        weights_.swap(other.weights_);
+        x_used_.swap(other.x_used_);
+        bundle_hist_indices_.swap(other.bundle_hist_indices_);
+        std::swap(unit_weights_, other.unit_weights_);
+    }
+};
+
+// Weights of samples in kernels specialized at compile time, 'Weights' of them is SampleWeights or UnitWeights.
+// 'w' is weights gathered from samples.
+struct SampleWeights
+{
+    static double get(const XYSetRef& set, size_t i) {return set.get_weight(i);}
+    static double get(const double * w, size_t i) {return w[i];}
+};
+
+// all samples weigh 1, weights are not read
+struct UnitWeights
+{
+    static double get(const XYSetRef& set, size_t i) {return 1.0;}
+    static double get(const double * w, size_t i) {return 1.0;}
 };
 
+// Loaders map the file and parse chunks of lines in parallel by 'pool',
+// samples are in the order of lines, 'pool' being 0 means one thread.
 // load liblinear format training samples
-int load_liblinear(const char * filename, XYSet * set);
+int load_liblinear(const char * filename, XYSet * set, ThreadPool * pool = 0);
 // load our format training samples
-int load_gbdt(const char * filename, XYSet * set);
+int load_gbdt(const char * filename, XYSet * set, ThreadPool * pool = 0);
 // load LECTOR 4.0 format training samples
 // http://research.microsoft.com/en-us/um/beijing/projects/letor//letor4dataset.aspx
-int load_lector4(const char * filename, XYSet * set, std::vector<size_t> * n_samples_per_query);
+int load_lector4(const char * filename, XYSet * set, std::vector<size_t> * n_samples_per_query, ThreadPool * pool = 0);
+
+// Binary training samples, written by gbdt-dataset and mapped by "load_binary".
+// They are the set as it is after loading: spec, y, weights,
+// and x columns with sorted indices, or split candidates with x bins built by 'max_bin'.
+// The file is of the byte order of the machine writing it.
+int save_binary(const char * filename, const XYSet& set, size_t max_bin);
+// 'max_bin' is 0 if x bins are not built.
+// If 'x_bin_file' is not 0, x bins are left in the file and read by it in blocks,
+// which is set to 'set->x_bin_file()', see XBinFile.
+int load_binary(const char * filename, XYSet * set, size_t * max_bin, XBinFile * x_bin_file = 0);
+
+// Bundle features of sparse samples with x bins, see XBundles.
+// Features are bundled greedily, a feature joins a bundle if samples in which both of them are not in their bins of 0
+// are at most 'max_conflict_rate' of all samples, and only the one of the larger feature index is kept in such samples.
+// Bundles are used only if they take less memory than x bins stored sample by sample.
+// Return the number of bundles, 0 if they are not used.
+size_t bundle_x_bins(XYSet * set, double max_conflict_rate, ThreadPool * pool);
+
+// Make x columns of sparse training samples dense, and build sorted indices for exact splitting.
+// Exact splitting and binary training samples need dense ones.
+void densify_x(XYSet * set, ThreadPool * pool);
+
+// Choose at most "max_bin - 1" split candidates(see XYSet) of every feature by quantile sketches of all samples,
+// and build x bins(see XYSet) for histogram-based splitting.
+// Numerical candidates are weighted quantiles, and category candidates are the most weighted values.
+// The ith candidate of a numerical feature is the upper bound of the ith bin,
+// and the ith candidate of a category feature is the only value of the ith bin.
+// x values greater than all candidates or not in candidates lie in the last bin.
+// Sorted indices and x columns(see XYSet) are released,
+// since samples are split and predicted by their x bins in histogram-based splitting.
+// X bins of sparse samples are built sample by sample, see XBinRows,
+// 0 lies in the bin of its sorted position, so absent features go the way of 0 in every split.
+int build_x_bins(XYSet * set, size_t max_bin, ThreadPool * pool);
+// build x bins by split candidates already in 'set', see "build_x_bins"
+int bin_x_values(XYSet * set, size_t max_bin, ThreadPool * pool);
 
 #endif// GBDT_TRAINING_SAMPLE_H
@@ -0,0 +1,83 @@
+#include "simd.h"
+
+#if defined GBDT_SIMD_X86
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+// registers eax, ebx, ecx and edx of cpuid 'leaf'
+static void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#if defined _MSC_VER
+    __cpuidex((int *)regs, (int)leaf, (int)subleaf);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// states of registers the OS saves on context switches
+static unsigned long long xgetbv0()
+{
+#if defined _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((unsigned long long)hi << 32) | lo;
+#endif
+}
+
+static kSimd detect_simd()
+{
+    unsigned int regs[4];
+    cpuid(0, 0, regs);
+    if (regs[0] < 7)
+        return kSimd_None;
+
+    // AVX and OSXSAVE, then the OS saves xmm and ymm registers
+    cpuid(1, 0, regs);
+    if ((regs[2] & (1u << 28)) == 0 || (regs[2] & (1u << 27)) == 0)
+        return kSimd_None;
+    unsigned long long xcr0 = xgetbv0();
+    if ((xcr0 & 0x6) != 0x6)
+        return kSimd_None;
+
+    cpuid(7, 0, regs);
+    bool avx2 = (regs[1] & (1u << 5)) != 0;
+    bool avx512f = (regs[1] & (1u << 16)) != 0;
+#if defined GBDT_SIMD_AVX512
+    // the OS saves opmask and zmm registers too
+    if (avx2 && avx512f && (xcr0 & 0xe6) == 0xe6)
+        return kSimd_AVX512;
+#endif
+    if (avx2)
+        return kSimd_AVX2;
+    return kSimd_None;
+}
+#else
+static kSimd detect_simd()
+{
+    return kSimd_None;
+}
+#endif
+
+kSimd get_simd()
+{
+    static const kSimd simd = detect_simd();
+    return simd;
+}
+
+const char * get_simd_name(kSimd simd)
+{
+    switch (simd)
+    {
+    case kSimd_AVX512:
+        return "avx512";
+    case kSimd_AVX2:
+        return "avx2";
+    default:
+        return "none";
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef GBDT_SIMD_H
+#define GBDT_SIMD_H
+
+// Hand-vectorized kernels are compiled for x86 instruction sets by target attributes,
+// one binary runs on any x86 CPU, and kernels are chosen by "get_simd" at run time.
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+#define GBDT_SIMD_X86 1
+#define GBDT_SIMD_AVX512 1
+#define GBDT_TARGET(isa) __attribute__((target(isa)))
+#elif defined _MSC_VER && (defined _M_X64 || defined _M_IX86)
+#define GBDT_SIMD_X86 1
+#if _MSC_VER >= 1910
+#define GBDT_SIMD_AVX512 1
+#endif
+#define GBDT_TARGET(isa)
+#endif
+
+#if defined GBDT_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// instruction sets of kernels, a later one includes former ones
+enum kSimd
+{
+    kSimd_None = 0,
+    kSimd_AVX2 = 1,
+    kSimd_AVX512 = 2,
+};
+
+// the best instruction set supported by both the CPU and the OS, detected by cpuid once
+kSimd get_simd();
+const char * get_simd_name(kSimd simd);
+
+#endif// GBDT_SIMD_H
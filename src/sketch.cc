@@ -0,0 +1,442 @@
+#include "sketch.h"
+#include <assert.h>
+#include <string.h>
+#include <algorithm>
+
+// entries of a sketch per split candidate, more entries make smaller errors
+static const size_t SKETCH_SIZE_PER_CANDIDATE = 32;
+static const size_t MIN_SKETCH_SIZE = 1024;
+static const size_t MAX_SKETCH_SIZE = 131072;
+
+template <class T>
+static void append(std::vector<char> * data, const T& t)
+{
+    data->insert(data->end(), (const char *)&t, (const char *)(&t + 1));
+}
+
+template <class T>
+static void read(const char *& p, T * t)
+{
+    memcpy(t, p, sizeof(T));
+    p += sizeof(T);
+}
+
+struct ValueWeightLess
+{
+    bool operator()(const std::pair<double, double>& a, const std::pair<double, double>& b) const
+    {
+        return a.first < b.first;
+    }
+};
+
+// exact summary of x values and their weight
+static void make_summary(std::vector<std::pair<double, double> > * buffer, SketchSummary * summary)
+{
+    std::sort(buffer->begin(), buffer->end(), ValueWeightLess());
+    summary->clear();
+    double rank = 0.0;
+    for (size_t i=0, s=buffer->size(); i<s;)
+    {
+        double value = (*buffer)[i].first;
+        double w = 0.0;
+        for (; i<s && (*buffer)[i].first == value; i++)
+            w += (*buffer)[i].second;
+        summary->push_back(SketchEntry(rank, rank + w, w, value));
+        rank += w;
+    }
+}
+
+// summary of the union of two streams
+static void combine_summary(const SketchSummary& a, const SketchSummary& b, SketchSummary * summary)
+{
+    summary->clear();
+    if (a.empty())
+    {
+        *summary = b;
+        return;
+    }
+    if (b.empty())
+    {
+        *summary = a;
+        return;
+    }
+
+    // rmin of a value of one summary in the other one is rmin_next of its preceding value,
+    // rmax is rmax_prev of its succeeding value.
+    size_t i = 0, j = 0;
+    double a_rmin = 0.0, b_rmin = 0.0;
+    while (i < a.size() && j < b.size())
+    {
+        const SketchEntry& x = a[i];
+        const SketchEntry& y = b[j];
+        if (x.value == y.value)
+        {
+            summary->push_back(SketchEntry(x.rmin + y.rmin, x.rmax + y.rmax, x.w + y.w, x.value));
+            a_rmin = x.rmin_next();
+            b_rmin = y.rmin_next();
+            i++;
+            j++;
+        }
+        else if (x.value < y.value)
+        {
+            summary->push_back(SketchEntry(x.rmin + b_rmin, x.rmax + y.rmax_prev(), x.w, x.value));
+            a_rmin = x.rmin_next();
+            i++;
+        }
+        else
+        {
+            summary->push_back(SketchEntry(y.rmin + a_rmin, y.rmax + x.rmax_prev(), y.w, y.value));
+            b_rmin = y.rmin_next();
+            j++;
+        }
+    }
+
+    for (double b_rmax = b.back().rmax; i<a.size(); i++)
+    {
+        const SketchEntry& x = a[i];
+        summary->push_back(SketchEntry(x.rmin + b_rmin, x.rmax + b_rmax, x.w, x.value));
+    }
+    for (double a_rmax = a.back().rmax; j<b.size(); j++)
+    {
+        const SketchEntry& y = b[j];
+        summary->push_back(SketchEntry(y.rmin + a_rmin, y.rmax + a_rmax, y.w, y.value));
+    }
+}
+
+// Keep at most 'size' entries of 'src', the first and last ones,
+// and those whose ranks are nearest to evenly spaced ranks.
+static void prune_summary(const SketchSummary& src, size_t size, SketchSummary * summary)
+{
+    summary->clear();
+    if (src.size() <= size)
+    {
+        *summary = src;
+        return;
+    }
+
+    assert(size >= 2);
+    double begin = src.front().rmax;
+    double range = src.back().rmin - src.front().rmax;
+    size_t n = size - 1;
+    summary->push_back(src.front());
+    size_t i = 1, last = 0;
+    for (size_t k=1; k<n; k++)
+    {
+        double dx2 = 2.0 * (range * k / n + begin);
+        while (i + 1 < src.size() && dx2 >= src[i+1].rmax + src[i+1].rmin)
+            i++;
+        if (i + 1 == src.size())
+            break;
+        if (dx2 < src[i].rmin_next() + src[i+1].rmax_prev())
+        {
+            if (i != last)
+            {
+                summary->push_back(src[i]);
+                last = i;
+            }
+        }
+        else
+        {
+            if (i + 1 != last)
+            {
+                summary->push_back(src[i+1]);
+                last = i + 1;
+            }
+        }
+    }
+    if (last != src.size() - 1)
+        summary->push_back(src.back());
+}
+
+void QuantileSketch::push(SketchSummary * summary, size_t level)
+{
+    SketchSummary combined;
+    for (; level<levels_.size() && !levels_[level].empty(); level++)
+    {
+        combine_summary(levels_[level], *summary, &combined);
+        prune_summary(combined, size_, summary);
+        levels_[level].clear();
+    }
+    if (level == levels_.size())
+        levels_.push_back(SketchSummary());
+    levels_[level].swap(*summary);
+}
+
+void QuantileSketch::flush()
+{
+    if (buffer_.empty())
+        return;
+    SketchSummary summary;
+    make_summary(&buffer_, &summary);
+    buffer_.clear();
+    push(&summary, 0);
+}
+
+void QuantileSketch::add(double x, double weight)
+{
+    assert(size_ >= 2);
+    buffer_.push_back(std::make_pair(x, weight));
+    if (buffer_.size() >= size_)
+        flush();
+}
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    for (size_t i=0, s=other.buffer_.size(); i<s; i++)
+        add(other.buffer_[i].first, other.buffer_[i].second);
+    for (size_t i=0, s=other.levels_.size(); i<s; i++)
+    {
+        if (other.levels_[i].empty())
+            continue;
+        SketchSummary summary = other.levels_[i];
+        push(&summary, i);
+    }
+}
+
+void QuantileSketch::get_summary(SketchSummary * summary) const
+{
+    std::vector<std::pair<double, double> > buffer = buffer_;
+    SketchSummary all, combined;
+    make_summary(&buffer, &all);
+    for (size_t i=0, s=levels_.size(); i<s; i++)
+    {
+        combine_summary(all, levels_[i], &combined);
+        all.swap(combined);
+    }
+    prune_summary(all, size_, summary);
+}
+
+void QuantileSketch::save(std::vector<char> * data) const
+{
+    append(data, size_);
+    append(data, buffer_.size());
+    for (size_t i=0, s=buffer_.size(); i<s; i++)
+    {
+        append(data, buffer_[i].first);
+        append(data, buffer_[i].second);
+    }
+    append(data, levels_.size());
+    for (size_t i=0, s=levels_.size(); i<s; i++)
+    {
+        append(data, levels_[i].size());
+        for (size_t j=0, t=levels_[i].size(); j<t; j++)
+            append(data, levels_[i][j]);
+    }
+}
+
+void QuantileSketch::load(const char *& p)
+{
+    size_t size;
+    read(p, &size_);
+    read(p, &size);
+    buffer_.resize(size);
+    for (size_t i=0; i<size; i++)
+    {
+        read(p, &buffer_[i].first);
+        read(p, &buffer_[i].second);
+    }
+    read(p, &size);
+    levels_.resize(size);
+    for (size_t i=0, s=levels_.size(); i<s; i++)
+    {
+        read(p, &size);
+        levels_[i].resize(size);
+        for (size_t j=0; j<size; j++)
+            read(p, &levels_[i][j]);
+    }
+}
+
+XSketch::XSketch(kXType x_type, size_t max_candidate)
+    : x_type_(x_type),
+    quantile_(std::min(std::max(max_candidate * SKETCH_SIZE_PER_CANDIDATE, MIN_SKETCH_SIZE), MAX_SKETCH_SIZE)) {}
+
+void XSketch::add(const CompoundValue& x, double weight)
+{
+    if (x_type_ == kXType_Numerical)
+        quantile_.add(x.d(), weight);
+    else
+        counts_[x.i()] += weight;
+}
+
+void XSketch::merge(const XSketch& other)
+{
+    assert(x_type_ == other.x_type_);
+    if (x_type_ == kXType_Numerical)
+    {
+        quantile_.merge(other.quantile_);
+    }
+    else
+    {
+        std::map<int, double>::const_iterator it = other.counts_.begin();
+        for (; it != other.counts_.end(); ++it)
+            counts_[it->first] += it->second;
+    }
+}
+
+// the larger weight first, and the smaller value first for ties
+struct CountGreater
+{
+    bool operator()(const std::pair<int, double>& a, const std::pair<int, double>& b) const
+    {
+        if (a.second != b.second)
+            return a.second > b.second;
+        return a.first < b.first;
+    }
+};
+
+void XSketch::get_candidates(size_t max_candidate, CompoundValueVector * x_values) const
+{
+    x_values->clear();
+    CompoundValue x;
+    if (x_type_ == kXType_Numerical)
+    {
+        SketchSummary summary;
+        quantile_.get_summary(&summary);
+        if (summary.size() <= max_candidate)
+        {
+            for (size_t i=0, s=summary.size(); i<s; i++)
+            {
+                x.d() = summary[i].value;
+                x_values->push_back(x);
+            }
+            return;
+        }
+
+        // the kth candidate is the value whose rank is nearest to 'total * k / (max_candidate + 1)'
+        double total = summary.back().rmax;
+        size_t i = 0, s = summary.size();
+        for (size_t k=1; k<=max_candidate; k++)
+        {
+            double dx2 = 2.0 * total * k / (max_candidate + 1);
+            while (i + 1 < s && dx2 >= summary[i+1].rmin + summary[i+1].rmax)
+                i++;
+            if (i + 1 == s || dx2 < summary[i].rmin_next() + summary[i+1].rmax_prev())
+                x.d() = summary[i].value;
+            else
+                x.d() = summary[i+1].value;
+            if (x_values->empty() || x.d() > x_values->back().d())
+                x_values->push_back(x);
+        }
+    }
+    else
+    {
+        std::vector<std::pair<int, double> > counts(counts_.begin(), counts_.end());
+        std::sort(counts.begin(), counts.end(), CountGreater());
+        if (counts.size() > max_candidate)
+            counts.resize(max_candidate);
+        for (size_t i=0, s=counts.size(); i<s; i++)
+        {
+            x.i() = counts[i].first;
+            x_values->push_back(x);
+        }
+        std::sort(x_values->begin(), x_values->end(), CompoundValueIntLess());
+    }
+}
+
+void XSketch::save(std::vector<char> * data) const
+{
+    append(data, x_type_);
+    if (x_type_ == kXType_Numerical)
+    {
+        quantile_.save(data);
+    }
+    else
+    {
+        append(data, counts_.size());
+        std::map<int, double>::const_iterator it = counts_.begin();
+        for (; it != counts_.end(); ++it)
+        {
+            append(data, it->first);
+            append(data, it->second);
+        }
+    }
+}
+
+void XSketch::load(const char *& p)
+{
+    read(p, &x_type_);
+    counts_.clear();
+    if (x_type_ == kXType_Numerical)
+    {
+        quantile_.load(p);
+    }
+    else
+    {
+        size_t size;
+        read(p, &size);
+        for (size_t i=0; i<size; i++)
+        {
+            int x;
+            double count;
+            read(p, &x);
+            read(p, &count);
+            counts_[x] = count;
+        }
+    }
+}
+
+// sketch x values of features
+struct XSketchTask : public ThreadTask
+{
+    const XYSet& set;
+    // sum weight of all samples
+    double total_weight;
+    std::vector<XSketch>& sketches;
+
+    XSketchTask(const XYSet& _set, double _total_weight, std::vector<XSketch>& _sketches)
+        : set(_set), total_weight(_total_weight), sketches(_sketches) {}
+
+    virtual void run(size_t x_index)
+    {
+        XSketch& sketch = sketches[x_index];
+        if (set.is_sparse())
+        {
+            // 0 of samples without the feature is added once by their sum weight
+            const XSparseColumn& x_column = set.get_sparse_x_column(x_index);
+            double weight = 0.0;
+            for (size_t k=0, s=x_column.indices.size(); k<s; k++)
+            {
+                double w = set.get_weight(x_column.indices[k]);
+                sketch.add(x_column.values[k], w);
+                weight += w;
+            }
+            if (x_column.indices.size() < set.size())
+                sketch.add(XSparseColumn::zero, std::max(total_weight - weight, 0.0));
+            return;
+        }
+
+        const CompoundValueVector& x_column = set.get_x_column(x_index);
+        for (size_t i=0, s=set.size(); i<s; i++)
+            sketch.add(x_column[i], set.get_weight(i));
+    }
+};
+
+void sketch_x_values(
+    const XYSet& set,
+    size_t max_candidate,
+    std::vector<XSketch> * sketches,
+    ThreadPool * pool)
+{
+    sketches->clear();
+    for (size_t i=0, s=set.get_x_type_size(); i<s; i++)
+        sketches->push_back(XSketch(set.get_x_type(i), max_candidate));
+    double total_weight = 0.0;
+    if (set.is_sparse())
+    {
+        for (size_t i=0, s=set.size(); i<s; i++)
+            total_weight += set.get_weight(i);
+    }
+    XSketchTask task(set, total_weight, *sketches);
+    pool->parallel_for(set.get_x_type_size(), &task);
+}
+
+void get_x_values(
+    const std::vector<XSketch>& sketches,
+    size_t max_candidate,
+    XYSet * set)
+{
+    assert(sketches.size() == set->get_x_type_size());
+    set->x_values().resize(sketches.size());
+    for (size_t i=0, s=sketches.size(); i<s; i++)
+        sketches[i].get_candidates(max_candidate, &set->get_x_values(i));
+}
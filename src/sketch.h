@@ -0,0 +1,105 @@
+#ifndef GBDT_SKETCH_H
+#define GBDT_SKETCH_H
+
+#include "sample.h"
+#include "thread.h"
+#include <map>
+#include <vector>
+
+// A weighted quantile summary.
+// An entry is a x value with the range of its rank [rmin, rmax],
+// the rank of a value is the total weight of values less than it,
+// and w is the weight of the value itself.
+// Summaries of two streams are merged into a summary of the union of them,
+// and a summary is pruned to a fixed size with a bounded error of ranks,
+// see "Greenwald and Khanna, Space-efficient online computation of quantile summaries"
+// and its weighted version in xgboost.
+struct SketchEntry
+{
+    double rmin;
+    double rmax;
+    double w;
+    double value;
+
+    SketchEntry() : rmin(0.0), rmax(0.0), w(0.0), value(0.0) {}
+    SketchEntry(double _rmin, double _rmax, double _w, double _value)
+        : rmin(_rmin), rmax(_rmax), w(_w), value(_value) {}
+
+    double rmin_next() const {return rmin + w;}
+    double rmax_prev() const {return rmax - w;}
+};
+
+typedef std::vector<SketchEntry> SketchSummary;
+
+// A quantile sketch of a stream of weighted x values, built in one pass.
+// Values are buffered and summarized by blocks,
+// summaries are merged like a binary counter and pruned to 'size' entries,
+// so that the rank error is at most about the total weight * log2(blocks) / 'size'.
+class QuantileSketch
+{
+private:
+    size_t size_;
+    // x values and their weight not summarized yet
+    std::vector<std::pair<double, double> > buffer_;
+    // levels_[i] is empty or a summary of 2^i blocks
+    std::vector<SketchSummary> levels_;
+
+    void flush();
+    void push(SketchSummary * summary, size_t level);
+
+public:
+    explicit QuantileSketch(size_t size = 0) : size_(size) {}
+
+    void add(double x, double weight);
+    void merge(const QuantileSketch& other);
+    // the summary of all values, pruned to at most 'size' entries
+    void get_summary(SketchSummary * summary) const;
+
+    // append it to 'data'
+    void save(std::vector<char> * data) const;
+    // load it from 'p', and move 'p' to the end of it
+    void load(const char *& p);
+};
+
+// sketch of x values of a feature, to choose split candidates
+class XSketch
+{
+private:
+    kXType x_type_;
+    // for a numerical feature
+    QuantileSketch quantile_;
+    // for a category feature, total weight of every x value
+    std::map<int, double> counts_;
+
+public:
+    XSketch() : x_type_(kXType_Numerical) {}
+    XSketch(kXType x_type, size_t max_candidate);
+
+    kXType x_type() const {return x_type_;}
+
+    void add(const CompoundValue& x, double weight);
+    void merge(const XSketch& other);
+
+    // Get at most 'max_candidate' sorted split candidates.
+    // Numerical ones are quantiles evenly dividing the total weight,
+    // category ones are the values of the largest total weight.
+    void get_candidates(size_t max_candidate, CompoundValueVector * x_values) const;
+
+    void save(std::vector<char> * data) const;
+    void load(const char *& p);
+};
+
+// sketch x values of every feature of 'set' in one pass, features in parallel
+void sketch_x_values(
+    const XYSet& set,
+    size_t max_candidate,
+    std::vector<XSketch> * sketches,
+    ThreadPool * pool);
+
+// set at most 'max_candidate' split candidates of every feature of 'set' by 'sketches'
+void get_x_values(
+    const std::vector<XSketch>& sketches,
+    size_t max_candidate,
+    XYSet * set);
+
+#endif// GBDT_SKETCH_H
@@ -0,0 +1,327 @@
+#include "text.h"
+#include <assert.h>
+#include <errno.h>
+#include <float.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : data_(0), size_(0)
+#if defined _WIN32
+    , file_(INVALID_HANDLE_VALUE), mapping_(0)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#if defined _WIN32
+int MappedFile::open(const char * filename)
+{
+    close();
+    file_ = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+    LARGE_INTEGER size;
+    if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_, &size))
+    {
+        fprintf(stderr, "open \"%s\" failed\n", filename);
+        close();
+        return -1;
+    }
+
+    size_ = (size_t)size.QuadPart;
+    if (size_ == 0)
+        return 0;
+
+    mapping_ = CreateFileMappingA(file_, 0, PAGE_READONLY, 0, 0, 0);
+    if (mapping_ != 0)
+        data_ = (const char *)MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+    if (data_ == 0)
+    {
+        fprintf(stderr, "map \"%s\" failed\n", filename);
+        close();
+        return -1;
+    }
+    return 0;
+}
+
+void MappedFile::close()
+{
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mapping_)
+        CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE)
+        CloseHandle(file_);
+    data_ = 0;
+    size_ = 0;
+    file_ = INVALID_HANDLE_VALUE;
+    mapping_ = 0;
+}
+#else
+int MappedFile::open(const char * filename)
+{
+    close();
+    int fd = ::open(filename, O_RDONLY);
+    struct stat st;
+    if (fd == -1 || fstat(fd, &st) == -1)
+    {
+        fprintf(stderr, "open \"%s\" failed\n", filename);
+        if (fd != -1)
+            ::close(fd);
+        return -1;
+    }
+
+    size_ = (size_t)st.st_size;
+    if (size_ == 0)
+    {
+        ::close(fd);
+        return 0;
+    }
+
+    void * data = mmap(0, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+        fprintf(stderr, "map \"%s\" failed: %s\n", filename, strerror(errno));
+        size_ = 0;
+        return -1;
+    }
+    // pages are read once from the beginning to the end by every chunk
+    madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = (const char *)data;
+    return 0;
+}
+
+void MappedFile::close()
+{
+    if (data_)
+        munmap((void *)data_, size_);
+    data_ = 0;
+    size_ = 0;
+}
+#endif
+
+void split_lines(
+    const char * begin,
+    const char * end,
+    size_t n,
+    std::vector<const char *> * bounds)
+{
+    assert(n != 0);
+    size_t size = (size_t)(end - begin);
+    bounds->clear();
+    bounds->push_back(begin);
+    for (size_t i=1; i<n; i++)
+    {
+        const char * bound = begin + size / n * i;
+        if (bound <= bounds->back())
+            continue;
+        // a chunk begins after a '\n'
+        const char * newline = (const char *)memchr(bound - 1, '\n', (size_t)(end - bound + 1));
+        if (newline == 0 || newline + 1 == end)
+            break;
+        bounds->push_back(newline + 1);
+    }
+    bounds->push_back(end);
+}
+
+bool LineReader::next(const char ** line, size_t * length)
+{
+    if (cur_ == end_)
+        return false;
+
+    const char * newline = (const char *)memchr(cur_, '\n', (size_t)(end_ - cur_));
+    if (newline)
+    {
+        *line = cur_;
+        *length = (size_t)(newline + 1 - cur_);
+        cur_ = newline + 1;
+    }
+    else
+    {
+        // the mapped file does not end with 0, copy the line
+        last_.assign(cur_, end_);
+        *line = last_.c_str();
+        *length = last_.size();
+        cur_ = end_;
+    }
+    return true;
+}
+
+static bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static bool is_alnum(char c)
+{
+    return is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// max number of significant digits parsed directly
+static const int MAX_DIGITS = 19;
+// 2^53, integers not greater than it are exact in double
+static const unsigned long long MAX_EXACT_INTEGER = 9007199254740992ULL;
+// powers of 10 exact in double
+static const double POW10[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+    1e21, 1e22,
+};
+static const int MAX_EXACT_POW10 = 22;
+
+// Spaces before a number are skipped by strtod and strtol, but lines end with '\n',
+// a number is not parsed from the next line.
+static bool before_newline(const char * str)
+{
+    for (; *str == ' ' || (*str >= '\t' && *str <= '\r'); str++)
+        if (*str == '\n')
+            return true;
+    return false;
+}
+
+static double slow_parse_double(const char * str, char ** end)
+{
+    errno = 0;
+    if (before_newline(str))
+    {
+        *end = (char *)str;
+        return 0.0;
+    }
+    return strtod(str, end);
+}
+
+double parse_double(const char * str, char ** end)
+{
+#if defined FLT_EVAL_METHOD && FLT_EVAL_METHOD == 0
+    // See "Clinger, How to read floating point numbers accurately".
+    // If the significand and 10^exponent are both exact in double,
+    // one multiplication or division rounds correctly, as strtod does.
+    const char * cur = str;
+    bool negative = false;
+    if (*cur == '-' || *cur == '+')
+    {
+        negative = (*cur == '-');
+        cur++;
+    }
+
+    unsigned long long m = 0;
+    int digits = 0, exponent = 0;
+    bool has_digit = false;
+    for (; is_digit(*cur); cur++)
+    {
+        has_digit = true;
+        if (m == 0 && *cur == '0')
+            continue;
+        if (++digits > MAX_DIGITS)
+            return slow_parse_double(str, end);
+        m = m * 10 + (unsigned long long)(*cur - '0');
+    }
+    if (*cur == '.')
+    {
+        for (cur++; is_digit(*cur); cur++)
+        {
+            has_digit = true;
+            exponent--;
+            if (m == 0 && *cur == '0')
+                continue;
+            if (++digits > MAX_DIGITS)
+                return slow_parse_double(str, end);
+            m = m * 10 + (unsigned long long)(*cur - '0');
+        }
+    }
+    if (!has_digit)
+        return slow_parse_double(str, end);
+
+    if (*cur == 'e' || *cur == 'E')
+    {
+        const char * e = cur + 1;
+        bool negative_e = false;
+        if (*e == '-' || *e == '+')
+        {
+            negative_e = (*e == '-');
+            e++;
+        }
+        if (!is_digit(*e))
+            return slow_parse_double(str, end);
+        int e10 = 0;
+        for (; is_digit(*e); e++)
+        {
+            if (e10 > 10000)
+                return slow_parse_double(str, end);
+            e10 = e10 * 10 + (*e - '0');
+        }
+        exponent += negative_e ? -e10 : e10;
+        cur = e;
+    }
+
+    // hexadecimals, "1.2.3" and others are left to strtod
+    if (is_alnum(*cur) || *cur == '.' || m > MAX_EXACT_INTEGER)
+        return slow_parse_double(str, end);
+
+    double value;
+    if (m == 0)
+        value = 0.0;
+    else if (exponent >= 0 && exponent <= MAX_EXACT_POW10)
+        value = (double)m * POW10[exponent];
+    else if (exponent < 0 && exponent >= -MAX_EXACT_POW10)
+        value = (double)m / POW10[-exponent];
+    else
+        return slow_parse_double(str, end);
+
+    errno = 0;
+    *end = (char *)cur;
+    return negative ? -value : value;
+#else
+    return slow_parse_double(str, end);
+#endif
+}
+
+// max number of digits parsed directly, they never overflow long
+static const int MAX_LONG_DIGITS = 18;
+
+long parse_long(const char * str, char ** end)
+{
+    const char * cur = str;
+    bool negative = false;
+    if (*cur == '-' || *cur == '+')
+    {
+        negative = (*cur == '-');
+        cur++;
+    }
+
+    const char * digit_begin = cur;
+    unsigned long long value = 0;
+    for (; is_digit(*cur) && cur - digit_begin < MAX_LONG_DIGITS; cur++)
+        value = value * 10 + (unsigned long long)(*cur - '0');
+    if (cur == digit_begin || is_digit(*cur) || value > (unsigned long long)LONG_MAX)
+    {
+        // spaces, overflows and others are left to strtol
+        errno = 0;
+        if (before_newline(str))
+        {
+            *end = (char *)str;
+            return 0;
+        }
+        return strtol(str, end, 10);
+    }
+
+    errno = 0;
+    *end = (char *)cur;
+    return negative ? -(long)value : (long)value;
+}
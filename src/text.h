@@ -0,0 +1,70 @@
+#ifndef GBDT_TEXT_H
+#define GBDT_TEXT_H
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+// a read-only memory map of a whole file
+class MappedFile
+{
+private:
+    const char * data_;
+    size_t size_;
+#if defined _WIN32
+    void * file_;
+    void * mapping_;
+#endif
+
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    // return -1 if failed
+    int open(const char * filename);
+    void close();
+
+    const char * data() const {return data_;}
+    size_t size() const {return size_;}
+    const char * begin() const {return data_;}
+    const char * end() const {return data_ + size_;}
+};
+
+// Split [begin, end) into at most 'n' chunks of whole lines,
+// the ith chunk is [(*bounds)[i], (*bounds)[i+1]).
+void split_lines(
+    const char * begin,
+    const char * end,
+    size_t n,
+    std::vector<const char *> * bounds);
+
+// Lines of a chunk of text, every line ends with '\n' or 0,
+// so that they can be parsed like lines read by fgets.
+class LineReader
+{
+private:
+    const char * cur_;
+    const char * end_;
+    // the last line not ending with '\n'
+    std::string last_;
+
+public:
+    LineReader(const char * begin, const char * end) : cur_(begin), end_(end) {}
+
+    // get the next line and its length including '\n', return false at the end
+    bool next(const char ** line, size_t * length);
+};
+
+// Parse a double like strtod and get the same value, but faster and locale free.
+// Decimals of at most 19 digits whose values are exact in double are parsed directly,
+// others are parsed by strtod.
+// Unlike strtod, spaces before a number do not go across '\n'.
+// errno is ERANGE only if this number is out of range.
+double parse_double(const char * str, char ** end);
+// parse a decimal integer like strtol(str, end, 10), but faster, see "parse_double"
+long parse_long(const char * str, char ** end);
+
+#endif// GBDT_TEXT_H
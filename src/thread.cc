@@ -0,0 +1,136 @@
+#include "thread.h"
+#include <assert.h>
+
+// the pool and the index of its queue that the current thread works for
+static thread_local const ThreadPool * current_pool = 0;
+static thread_local size_t current_queue = 0;
+
+ThreadPool::ThreadPool(size_t thread_number)
+    : stop_(false), job_size_(0)
+{
+    if (thread_number == 0)
+        thread_number = std::thread::hardware_concurrency();
+    if (thread_number == 0)
+        thread_number = 1;
+    for (size_t i=0; i<thread_number; i++)
+        queues_.push_back(new JobQueue);
+    for (size_t i=1; i<thread_number; i++)
+        threads_.push_back(std::thread(&ThreadPool::work, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (size_t i=0, s=threads_.size(); i<s; i++)
+        threads_[i].join();
+    for (size_t i=0, s=queues_.size(); i<s; i++)
+        delete queues_[i];
+}
+
+size_t ThreadPool::current_index() const
+{
+    return (current_pool == this) ? current_queue : 0;
+}
+
+bool ThreadPool::pop_job(size_t index, Job * job)
+{
+    if (job_size_ == 0)
+        return false;
+
+    size_t queue_size = queues_.size();
+    for (size_t i=0; i<queue_size; i++)
+    {
+        // its own queue first, then steal from others
+        JobQueue * queue = queues_[(index + i) % queue_size];
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (queue->jobs.empty())
+            continue;
+        if (i == 0)
+        {
+            *job = queue->jobs.back();
+            queue->jobs.pop_back();
+        }
+        else
+        {
+            *job = queue->jobs.front();
+            queue->jobs.pop_front();
+        }
+        job_size_--;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::run_job(const Job& job)
+{
+    job.task->run(job.i);
+    (*job.pending)--;
+}
+
+void ThreadPool::work(size_t index)
+{
+    current_pool = this;
+    current_queue = index;
+    for (;;)
+    {
+        Job job;
+        if (pop_job(index, &job))
+        {
+            run_job(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stop_ && job_size_ == 0)
+            wake_.wait(lock);
+        if (stop_)
+            return;
+    }
+}
+
+void ThreadPool::parallel_for(size_t n, ThreadTask * task)
+{
+    if (threads_.empty() || n <= 1)
+    {
+        for (size_t i=0; i<n; i++)
+            task->run(i);
+        return;
+    }
+
+    size_t index = current_index();
+    std::atomic<size_t> pending(n);
+    {
+        // counted before pushed, so that 'job_size_' never underflows
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_size_ += n - 1;
+    }
+    {
+        // part 0 is run by the calling thread at once,
+        // the others are pushed so that part 1 is popped first by the calling thread
+        JobQueue * queue = queues_[index];
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        for (size_t i=n-1; i>0; i--)
+        {
+            Job job = {task, i, &pending};
+            queue->jobs.push_back(job);
+        }
+    }
+    wake_.notify_all();
+
+    task->run(0);
+    pending--;
+
+    // help running jobs until all parts are finished
+    while (pending != 0)
+    {
+        Job job;
+        if (pop_job(index, &job))
+            run_job(job);
+        else
+            std::this_thread::yield();
+    }
+}
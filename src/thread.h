@@ -0,0 +1,71 @@
+#ifndef GBDT_THREAD_H
+#define GBDT_THREAD_H
+
+#include <stddef.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// a task of ThreadPool::parallel_for
+class ThreadTask
+{
+public:
+    virtual ~ThreadTask() {}
+    // run the ith part of the task
+    virtual void run(size_t i) = 0;
+};
+
+// A fixed number of threads running tasks in parallel,
+// the calling thread is one of them.
+// Every thread has its own deque of jobs,
+// it runs its own jobs last in first out and steals others' jobs first in first out when idle.
+// 'parallel_for' can be called in a task, which makes fork-join parallelism.
+class ThreadPool
+{
+private:
+    // the ith part of a task
+    struct Job
+    {
+        ThreadTask * task;
+        size_t i;
+        // number of parts of the task not finished
+        std::atomic<size_t> * pending;
+    };
+
+    struct JobQueue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::thread> threads_;
+    // queues_[0] is for threads not in the pool, queues_[i] is for threads_[i-1]
+    std::vector<JobQueue *> queues_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stop_;
+    // number of jobs in all queues
+    std::atomic<size_t> job_size_;
+
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+    void work(size_t index);
+    size_t current_index() const;
+    bool pop_job(size_t index, Job * job);
+    static void run_job(const Job& job);
+
+public:
+    // 0 means the number of CPU cores
+    explicit ThreadPool(size_t thread_number);
+    ~ThreadPool();
+
+    size_t size() const {return threads_.size() + 1;}
+    // run 'task->run(i)' for i in [0, n) and wait until all of them return
+    void parallel_for(size_t n, ThreadTask * task);
+};
+
+#endif// GBDT_THREAD_H